@@ -1,25 +1,483 @@
-#include "cpu.hpp"
-#include "pixel.hpp"
-
-#ifdef _MSC_VER
-#pragma warning(push, 0)
-#endif
-
-#include <iostream>
-
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
-
-int main(unsigned argc, const char* argv[]) {
-    if (argc > 1) {
-        CPU().emulate(argv[argc - 1]); // last arg is ROM
-    }
-    else {
-        std::string romName{};
-        std::cout << "Which ROM emulate ?" << std::endl;
-        std::getline(std::cin, romName);
-        CPU().emulate(std::move(romName));
-    }
-    return 0;
+#include "capture.hpp"
+#include "conformance.hpp"
+#include "control.hpp"
+#include "cpu.hpp"
+#include "debugger.hpp"
+#include "pixel.hpp"
+#include "recompiler.hpp"
+#include "rompack.hpp"
+#include "search.hpp"
+#include "sharedframes.hpp"
+#include "telemetry.hpp"
+#include "upscale.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+static void usage() {
+    std::cerr << "Usage :" << std::endl
+        << "  Chip8 [ROM]" << std::endl
+        << "  Chip8 --pack <pack> <ROM name>                      emulates a ROM stored in a pack" << std::endl
+        << "  Chip8 --pack-build <pack> [--quirks <hex>] <ROM>... writes a pack from ROM files" << std::endl
+        << "  Chip8 --pack-list <pack>                            lists the ROMs of a pack" << std::endl
+        << "  Chip8 --capture <file.y4m|file.gif> [--frames <n>] [--scale <n>] <ROM>" << std::endl
+        << "                                                      records frames, headless and unthrottled if --frames is given" << std::endl
+        << "  Chip8 --trace-record <trace> [--frames <n>] <ROM>   records a golden trace" << std::endl
+        << "  Chip8 --trace-check <trace> <ROM>                   compares a run with a golden trace" << std::endl
+        << "  Chip8 --conformance <directory>                     checks every <name>.ch8 against <name>.trace" << std::endl
+        << "  Chip8 --diff [--frames <n>] <ROM>                   runs the CPU with and without fusion and compares them each frame" << std::endl
+        << "  Chip8 --search [--frames <n>] [--depth <n>] [--states <n>] [--threads <n>] [--keys <hex>] [--quirks <hex>]" << std::endl
+        << "                 [--best-first <hex address>] [--goal <hex address>=<hex value>] <ROM>" << std::endl
+        << "                                                      explores the states reachable with the keypad" << std::endl
+        << "  Chip8 [--telemetry <file|unix:socket>] [--overlay] [--vip-timing] [--fusion] [--run-ahead <n>]" << std::endl
+        << "        [--upscale <n>] [--epx] [--scanlines] [--phosphor <decay>] <ROM>" << std::endl
+        << "                                                      exports performance counters every second, F1 toggles the overlay" << std::endl
+        << "                                                      --vip-timing runs opcodes at the speed of the COSMAC VIP" << std::endl
+        << "                                                      --fusion fuses common opcode sequences, then prints their hits" << std::endl
+        << "                                                      --run-ahead shows frames emulated 1 to 3 frames ahead, to cut input latency" << std::endl
+        << "                                                      --upscale draws <n> pixels per emulated pixel on the CPU (SSE/AVX2)," << std::endl
+        << "                                                      smoothed by --epx, dimmed by --scanlines, fading by <decay> per frame" << std::endl
+        << "  Chip8 --shared <name> [--slots <n>] [--lockstep] <ROM>" << std::endl
+        << "                                                      publishes frames and registers to shared memory, read back the keypad" << std::endl
+        << "                                                      --lockstep is headless and steps one frame per input" << std::endl
+        << "  Chip8 --control <socket> [<ROM>]                    headless, runs length-prefixed binary commands from a unix socket" << std::endl
+        << "  Chip8 --recompile <ROM> <file.cpp> [<function>]     translates a ROM to C++ running on the constexpr core" << std::endl
+        << "  Chip8 --startup <ROM>                               measures a headless cold start" << std::endl
+        << "  Chip8 --debug <ROM>                                 headless debugger console on the standard input" << std::endl;
+}
+
+// a whole number, nullopt if <text> isn't one (std::stoul alone takes "12abc" as 12 and "-1" as the largest value)
+static std::optional<std::size_t> parseCount(const std::string& text, int base = 10) {
+    const auto digit{ text.empty() ? '\0' : text.front() };
+    if (!(base == 16 ? std::isxdigit(static_cast<unsigned char>(digit)) : std::isdigit(static_cast<unsigned char>(digit)))) {
+        return std::nullopt;
+    }
+    try {
+        std::size_t parsed{ 0u };
+        const auto count{ std::stoull(text, &parsed, base) };
+        if (parsed == text.size() && count <= std::numeric_limits<std::size_t>::max()) {
+            return static_cast<std::size_t>(count);
+        }
+    }
+    catch (const std::logic_error&) {} // std::stoull, out of range
+    return std::nullopt;
+}
+
+static int conformanceCommand(const std::vector<std::string>& args) {
+    std::size_t frames{ 600u };
+    const auto framesOption{ std::find(args.cbegin(), args.cend(), "--frames") };
+    if (framesOption != args.cend() && framesOption + 1 != args.cend()) {
+        const auto count{ parseCount(*(framesOption + 1)) };
+        if (!count) {
+            usage();
+            return 1;
+        }
+        frames = *count;
+    }
+    if (args[0] == "--conformance" && args.size() == 2) {
+        return Conformance::checkCorpus(args[1]) ? 0 : 1;
+    }
+    if (args[0] == "--trace-record" && args.size() >= 3) {
+        return Conformance::record(args.back(), args[1], frames) ? 0 : 1;
+    }
+    if (args[0] == "--trace-check" && args.size() == 3) {
+        return Conformance::check(args.back(), args[1]) ? 0 : 1;
+    }
+    if (args[0] == "--diff" && args.size() >= 2) {
+        // the fused interpreter against the plain one : since CPU runs its opcodes through Core::execute(), fusion is what differs
+        // (recompiled ROMs are compared to the interpreter by recompiler_check.cpp)
+        CPU ROMloader{};
+        if (!ROMloader.loadGame(args.back())) {
+            return 1;
+        }
+        if (const auto divergence{ Conformance::checkFusion(&ROMloader.getMemory()[CPU::memoryStart], CPU::memoryUsableSize, frames) }) {
+            std::cerr << "Divergence at frame " << divergence->frame << " : " << divergence->what << std::endl;
+            return 1;
+        }
+        std::cout << "Engines agree" << std::endl;
+        return 0;
+    }
+    usage();
+    return 1;
+}
+
+static int captureCommand(const std::vector<std::string>& args) {
+    if (args.size() < 3 || args.size() % 2 == 0) {
+        usage();
+        return 1;
+    }
+    std::size_t frames{ 0u };
+    std::size_t scale{ Pixel::size };
+    for (std::size_t i{ 2u }; i + 1u < args.size(); i += 2u) {
+        const auto count{ parseCount(args[i + 1u]) };
+        if (args[i] == "--frames" && count) {
+            frames = *count;
+        }
+        else if (args[i] == "--scale" && count) {
+            scale = *count;
+        }
+        else {
+            usage();
+            return 1;
+        }
+    }
+    FrameRecorder recorder{};
+    if (!recorder.open(args[1], scale)) {
+        return 1;
+    }
+    CPU cpu{};
+    cpu.record(&recorder);
+    if (frames == 0u) {
+        cpu.emulate(args.back());
+        return 0;
+    }
+    if (!cpu.loadGame(args.back())) {
+        return 1;
+    }
+    for (std::size_t frame{ 0u }; frame < frames && cpu.stepFrame(); frame++) {}
+    return 0;
+}
+
+static std::string inputsToStr(const std::vector<StateSearch::input_t>& inputs) {
+    std::string str{};
+    for (const auto input : inputs) {
+        str += str.empty() ? "" : " ";
+        if (input == 0u) {
+            str += '-';
+        }
+        for (unsigned key{ 0u }; key < 0x10; key++) {
+            if ((input >> key) & 1u) {
+                str += "0123456789ABCDEF"[key];
+            }
+        }
+    }
+    return str;
+}
+
+static int searchCommand(const std::vector<std::string>& args) {
+    StateSearch::Options options{};
+    for (std::size_t i{ 1u }; i + 2u < args.size(); i += 2u) {
+        const auto& value{ args[i + 1u] };
+        const auto count{ parseCount(value) };
+        const auto hex{ parseCount(value, 16) };
+        // --goal <hex address>=<hex value>
+        const auto equals{ value.find('=') };
+        const auto goalAddress{ equals == std::string::npos ? std::nullopt : parseCount(value.substr(0u, equals), 16) };
+        const auto goalValue{ equals == std::string::npos ? std::nullopt : parseCount(value.substr(equals + 1u), 16) };
+        if (args[i] == "--frames" && count) {
+            options.framesPerInput = *count;
+        }
+        else if (args[i] == "--depth" && count) {
+            options.maxDepth = *count;
+        }
+        else if (args[i] == "--states" && count) {
+            options.maxStates = *count;
+        }
+        else if (args[i] == "--threads" && count) {
+            options.threads = *count;
+        }
+        else if (args[i] == "--keys" && hex) {
+            options.inputs = StateSearch::singleKeys(static_cast<StateSearch::input_t>(*hex));
+        }
+        else if (args[i] == "--quirks" && hex) {
+            // same mask as --pack-build's
+            options.quirks = static_cast<std::uint16_t>(*hex);
+            options.timing = options.quirks & RomPack::vipTiming ? CPU::Timing::cosmacVip : CPU::Timing::flat;
+        }
+        else if (args[i] == "--best-first" && hex) {
+            // e.g. the address where a game stores its level or its score
+            const auto address{ *hex % CPU::memorySize };
+            options.order = StateSearch::Order::bestFirst;
+            options.score = [address](const CPU::State& state) { return static_cast<double>(state.memory[address]); };
+        }
+        else if (args[i] == "--goal" && goalAddress && goalValue) {
+            const auto address{ *goalAddress % CPU::memorySize };
+            const auto expected{ *goalValue };
+            options.goal = [address, expected](const CPU::State& state) { return state.memory[address] == expected; };
+        }
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if (args.size() % 2u != 0u) {
+        usage();
+        return 1;
+    }
+    CPU cpu{};
+    cpu.seed(Conformance::seed);
+    if (!cpu.loadGame(args.back())) {
+        return 1;
+    }
+    const auto result{ StateSearch::run(cpu.snapshot(), options) };
+    std::cout << result.unique << " unique states (" << result.duplicates << " duplicates), " << result.expanded << " expanded, depth " << result.depth
+        << ", " << static_cast<std::size_t>((result.unique + result.duplicates) / std::max(result.seconds, 1e-9) * 60.) << " states/min" << std::endl
+        << result.ended << " ended, " << result.faulted << " faulted" << std::endl;
+    if (result.fault) {
+        std::cout << "First fault " << CPU::faultName(result.faultType) << " after inputs : " << inputsToStr(*result.fault) << std::endl;
+    }
+    if (options.goal) {
+        std::cout << (result.goal ? "Goal reached after inputs : " + inputsToStr(*result.goal) : std::string{ "Goal not reached" }) << std::endl;
+    }
+    return result.faulted ? 2 : 0;
+}
+
+static int emulateCommand(const std::vector<std::string>& args) {
+    Telemetry telemetry{};
+    bool monitored{ false };
+    CPU cpu{};
+    Upscaler upscaler{};
+    Upscaler::Options filters{};
+    bool upscaled{ false };
+    for (std::size_t i{ 0u }; i + 1u < args.size(); i++) {
+        // the number after an option taking one, which is never the ROM
+        const auto count{ parseCount(i + 2u < args.size() ? args[i + 1u] : std::string{}) };
+        if (args[i] == "--vip-timing") {
+            cpu.setTiming(CPU::Timing::cosmacVip);
+        }
+        else if (args[i] == "--fusion") {
+            cpu.setFusion(true);
+        }
+        else if (args[i] == "--run-ahead" && count) {
+            cpu.setRunAhead(*count);
+            i++;
+        }
+        else if (args[i] == "--upscale" && count) {
+            filters.scale = *count;
+            upscaled = true;
+            i++;
+        }
+        else if (args[i] == "--epx") {
+            filters.filter = Upscaler::Filter::epx;
+            upscaled = true;
+        }
+        else if (args[i] == "--scanlines") {
+            filters.scanlines = true;
+            upscaled = true;
+        }
+        else if (args[i] == "--phosphor" && count) {
+            filters.phosphorDecay = static_cast<std::uint8_t>(std::min<std::size_t>(*count, 255u));
+            upscaled = true;
+            i++;
+        }
+        else if (args[i] == "--overlay") {
+            monitored = true;
+            telemetry.showOverlay(true);
+        }
+        else if (args[i] == "--telemetry" && i + 2u < args.size()) {
+            if (!telemetry.exportTo(args[++i])) {
+                return 1;
+            }
+            monitored = true;
+        }
+        else {
+            usage();
+            return 1;
+        }
+    }
+    if (monitored) {
+        cpu.monitor(&telemetry);
+    }
+    if (upscaled) {
+        if (!upscaler.configure(filters)) {
+            return 1;
+        }
+        cpu.present(&upscaler);
+    }
+    cpu.emulate(args.back());
+    if (cpu.fusion()) {
+        for (unsigned fusion{ 0u }; fusion < CPU::nFusions; fusion++) {
+            std::cout << CPU::fusionName(static_cast<CPU::Fusion>(fusion)) << " : " << cpu.fusionHits()[fusion] << " hits" << std::endl;
+        }
+    }
+    return 0;
+}
+
+// headless workers must be ready within a millisecond
+static int startupCommand(const std::vector<std::string>& args) {
+    if (args.size() != 2) {
+        usage();
+        return 1;
+    }
+    using clock = std::chrono::steady_clock;
+    const auto start{ clock::now() };
+    CPU cpu{};
+    const auto constructed{ clock::now() };
+    if (!cpu.loadGame(args[1])) {
+        return 1;
+    }
+    const auto loaded{ clock::now() };
+    cpu.stepFrame();
+    const auto stepped{ clock::now() };
+    const auto micros{ [](clock::duration duration) { return std::chrono::duration<double, std::micro>(duration).count(); } };
+    std::cout << "CPU construction : " << micros(constructed - start) << " us" << std::endl
+        << "ROM loading      : " << micros(loaded - constructed) << " us" << std::endl
+        << "First frame      : " << micros(stepped - loaded) << " us" << std::endl
+        << "Total            : " << micros(stepped - start) << " us" << std::endl;
+    return stepped - start < std::chrono::milliseconds{ 1 } ? 0 : 1;
+}
+
+static int debugCommand(const std::vector<std::string>& args) {
+    CPU cpu{};
+    if (args.size() != 2 || !cpu.loadGame(args[1])) {
+        usage();
+        return 1;
+    }
+    Debugger debugger{};
+    cpu.attach(&debugger);
+    Debugger::console(cpu, debugger, std::cin, std::cout);
+    return 0;
+}
+
+// lets another process watch and play, e.g. an agent stepping thousands of frames per second with --lockstep
+static int sharedCommand(const std::vector<std::string>& args) {
+    std::size_t slots{ SharedFrames::defaultSlots };
+    bool lockstep{ false };
+    for (std::size_t i{ 2u }; i + 1u < args.size(); i++) {
+        const auto count{ parseCount(i + 2u < args.size() ? args[i + 1u] : std::string{}) };
+        if (args[i] == "--slots" && count) {
+            slots = *count;
+            i++;
+        }
+        else if (args[i] == "--lockstep") {
+            lockstep = true;
+        }
+        else {
+            usage();
+            return 1;
+        }
+    }
+    SharedFrames shared{};
+    if (args.size() < 3 || !shared.open(args[1], slots)) {
+        usage();
+        return 1;
+    }
+    CPU cpu{};
+    cpu.share(&shared);
+    if (!lockstep) {
+        cpu.emulate(args.back());
+        return 0;
+    }
+    if (!cpu.loadGame(args.back())) {
+        return 1;
+    }
+    // the reader is gone once it stops sending input
+    constexpr std::chrono::seconds readerTimeout{ 10 };
+    while (shared.waitInput(readerTimeout) && cpu.stepFrame()) {}
+    std::cout << shared.published() << " frames published" << std::endl;
+    return cpu.fault() == CPU::Fault::none ? 0 : 1;
+}
+
+static int controlCommand(const std::vector<std::string>& args) {
+    if (args.size() != 2 && args.size() != 3) {
+        usage();
+        return 1;
+    }
+    CPU cpu{};
+    ControlServer server{ cpu };
+    if ((args.size() == 3 && !server.load(args[2])) || !server.open(args[1])) {
+        return 1;
+    }
+    std::cout << "Listening on " << args[1] << std::endl;
+    server.serve();
+    return 1;
+}
+
+// returns the exit code
+static int packCommand(const std::vector<std::string>& args) {
+    if (args[0] == "--pack-build" && args.size() >= 3) {
+        std::uint16_t quirks{ RomPack::none };
+        auto firstROM{ args.cbegin() + 2 };
+        if (*firstROM == "--quirks" && args.size() >= 5) {
+            const auto mask{ parseCount(args[3], 16) };
+            if (!mask) {
+                usage();
+                return 1;
+            }
+            quirks = static_cast<std::uint16_t>(*mask);
+            firstROM += 2;
+        }
+        return RomPack::build(args[1], { firstROM, args.cend() }, quirks) ? 0 : 1;
+    }
+
+    RomPack pack{};
+    if (args.size() < 2 || !pack.open(args[1])) {
+        usage();
+        return 1;
+    }
+    if (args[0] == "--pack-list") {
+        pack.list(std::cout);
+        return 0;
+    }
+    if (args[0] == "--pack" && args.size() == 3) {
+        const auto entry{ pack.find(args[2]) };
+        if (!entry) {
+            std::cerr << "Error ROM " << args[2] << " isn't in pack " << args[1] << " !" << std::endl;
+            return 1;
+        }
+        CPU().emulate(pack, *entry);
+        return 0;
+    }
+    usage();
+    return 1;
+}
+
+int main(unsigned argc, const char* argv[]) {
+    const std::vector<std::string> args(argv + 1, argv + argc);
+    if (!args.empty() && args[0].starts_with("--pack")) {
+        return packCommand(args);
+    }
+    if (!args.empty() && args[0] == "--capture") {
+        return captureCommand(args);
+    }
+    if (!args.empty() && (args[0].starts_with("--trace") || args[0] == "--conformance" || args[0] == "--diff")) {
+        return conformanceCommand(args);
+    }
+    if (!args.empty() && args[0] == "--search") {
+        return searchCommand(args);
+    }
+    if (!args.empty() && (args[0] == "--telemetry" || args[0] == "--overlay" || args[0] == "--vip-timing" || args[0] == "--fusion" || args[0] == "--run-ahead"
+        || args[0] == "--upscale" || args[0] == "--epx" || args[0] == "--scanlines" || args[0] == "--phosphor")) {
+        return emulateCommand(args);
+    }
+    if (!args.empty() && args[0] == "--shared") {
+        return sharedCommand(args);
+    }
+    if (!args.empty() && args[0] == "--control") {
+        return controlCommand(args);
+    }
+    if (!args.empty() && args[0] == "--recompile" && (args.size() == 3 || args.size() == 4)) {
+        return Recompiler::recompile(args[1], args[2], args.size() == 4 ? args[3] : "") ? 0 : 1;
+    }
+    if (!args.empty() && args[0] == "--startup") {
+        return startupCommand(args);
+    }
+    if (!args.empty() && args[0] == "--debug") {
+        return debugCommand(args);
+    }
+    if (argc > 1) {
+        CPU().emulate(argv[argc - 1]); // last arg is ROM
+    }
+    else {
+        std::string romName{};
+        std::cout << "Which ROM emulate ?" << std::endl;
+        std::getline(std::cin, romName);
+        CPU().emulate(std::move(romName));
+    }
+    return 0;
 }
\ No newline at end of file
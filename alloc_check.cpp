@@ -0,0 +1,104 @@
+// Allocation check : once a ROM is loaded, emulating frames must never touch the heap.
+// Global operator new is replaced by a counting one, then 10,000 frames are emulated; any allocation fails the check.
+// A built-in ROM executing every opcode in a loop is checked, then every ROM given as argument (until it ends).
+//
+// Not part of Chip8.vcxproj, as it replaces operator new for the whole program :
+//	g++ -std=c++20 -O2 -DNDEBUG alloc_check.cpp capture.cpp cpu.cpp debugger.cpp rompack.cpp sharedframes.cpp telemetry.cpp upscale.cpp
+//		-lsfml-audio -lsfml-graphics -lsfml-window -lsfml-system -pthread -o chip8-alloc-check
+//	./chip8-alloc-check [ROM]...
+// NDEBUG is required : debug builds log every opcode, which allocates on purpose.
+
+#include "cpu.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace {
+	std::atomic<bool>			counting{ false };
+	std::atomic<std::size_t>	allocations{ 0u };
+
+	void* allocate(std::size_t size) {
+		if (counting) {
+			allocations++;
+		}
+		if (void* const pointer{ std::malloc(size ? size : 1u) }) {
+			return pointer;
+		}
+		throw std::bad_alloc{};
+	}
+
+	constexpr std::size_t frames{ 10'000u };
+
+	// every opcode but 0NNN, then BNNN back to the start; key 5 is held so that FX0A never waits
+	constexpr CPU::byte_t everyOpcode[]{
+		0x00, 0xE0, 0x60, 0x05, 0x61, 0x03, 0xA2, 0x50, 0xD0, 0x15, 0x22, 0x4E, 0x70, 0x01, 0x80, 0x14, // 00E0 6XNN ANNN DXYN 2NNN 7XNN 8XY4
+		0x80, 0x15, 0x80, 0x16, 0x80, 0x17, 0x80, 0x1E, 0x80, 0x11, 0x80, 0x12, 0x80, 0x13, 0x80, 0x10, // 8XY5 8XY6 8XY7 8XYE 8XY1 8XY2 8XY3 8XY0
+		0x30, 0x00, 0x40, 0x00, 0x50, 0x10, 0x90, 0x10, 0xC0, 0xFF, 0x62, 0x05, 0xE2, 0x9E, 0x73, 0x00, // 3XNN 4XNN 5XY0 9XY0 CXNN EX9E
+		0xE2, 0xA1, 0x73, 0x00, 0xF4, 0x0A, 0x63, 0x10, 0xF3, 0x15, 0xF3, 0x18, 0xF3, 0x07, 0xF3, 0x1E, // EXA1 FX0A FX15 FX18 FX07 FX1E
+		0xF0, 0x29, 0xA2, 0x55, 0xF3, 0x33, 0xF3, 0x55, 0xF3, 0x65, 0x60, 0x00, 0xB2, 0x00, 0x00, 0xEE, // FX29 FX33 FX55 FX65 BNNN 00EE
+		0xF0, 0x90, 0xF0, 0x90, 0xF0, 0x00, 0x00, 0x00, 0x00											 // sprite, FX33 buffer
+	};
+
+	// returns the number of allocations while emulating the CPU's ROM
+	std::size_t check(CPU& cpu, const std::string& name) {
+		cpu.seed(1u);
+		cpu.setKey(0x5, true);
+		allocations = 0u;
+		counting = true;
+		std::size_t frame{ 0u };
+		while (frame < frames && cpu.stepFrame()) {
+			frame++;
+		}
+		counting = false;
+		std::cout << (allocations ? "FAIL " : "PASS ") << name << " : " << allocations << " allocations across " << frame << " frames" << std::endl;
+		return allocations;
+	}
+}
+
+void* operator new(std::size_t size) {
+	return allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+	return allocate(size);
+}
+
+void operator delete(void* pointer) noexcept {
+	std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+	std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+	std::free(pointer);
+}
+
+int main(int argc, const char* argv[]) {
+	CPU cpu{};
+	std::size_t failures{ 0u };
+	cpu.loadImage(everyOpcode, sizeof(everyOpcode));
+	failures += check(cpu, "every opcode") != 0u;
+	for (int arg{ 1 }; arg < argc; arg++) {
+		if (cpu.loadGame(argv[arg])) {
+			failures += check(cpu, argv[arg]) != 0u;
+		}
+	}
+	return failures ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,2712 @@
+#pragma once
+
+// beep.wav, embedded so that the emulator doesn't depend on the working directory nor open any file to beep
+// generated from beep.wav (16 bytes per line), regenerate it whenever beep.wav changes
+inline constexpr unsigned char beepWav[]{
+	0x52, 0x49, 0x46, 0x46, 0x0B, 0xA9, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45, 0x4A, 0x55, 0x4E, 0x4B,
+	0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x66, 0x6D, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x80, 0xBB, 0x00, 0x00,
+	0x80, 0x32, 0x02, 0x00, 0x03, 0x00, 0x18, 0x00, 0x64, 0x61, 0x74, 0x61, 0xC3, 0xA8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xD7, 0xFE, 0xFF, 0xEE, 0x00, 0x00, 0x01, 0x0F, 0x00, 0x53, 0x2A, 0x00, 0x0D,
+	0x48, 0x00, 0x74, 0x53, 0x00, 0xDD, 0x37, 0x00, 0x71, 0xF4, 0xFF, 0x2A, 0xA8, 0xFF, 0x4E, 0x82,
+	0xFF, 0xF7, 0x9E, 0xFF, 0xE9, 0xF0, 0xFF, 0xE7, 0x41, 0x00, 0x3C, 0x50, 0x00, 0x3A, 0xEE, 0xFF,
+	0x68, 0x1F, 0xFF, 0xE1, 0x1D, 0xFE, 0xE2, 0x47, 0xFD, 0x63, 0xFA, 0xFC, 0x8C, 0x66, 0xFD, 0xE7,
+	0x6B, 0xFE, 0x79, 0x97, 0xFF, 0x04, 0x33, 0x00, 0xD8, 0x8B, 0xFF, 0x4E, 0x60, 0xFD, 0xC4, 0x56,
+	0xFA, 0x97, 0xD7, 0xF7, 0xE0, 0x2A, 0xF7, 0x1A, 0xB0, 0xF8, 0xF5, 0xAF, 0xFB, 0xF2, 0xBF, 0xFE,
+	0x26, 0x5F, 0x00, 0xAB, 0xA4, 0xFF, 0x47, 0xB1, 0xFC, 0x60, 0x97, 0xF8, 0xC8, 0x04, 0xF5, 0x3B,
+	0x85, 0xF3, 0x83, 0xFA, 0xF4, 0x3B, 0x1F, 0xF9, 0x11, 0x88, 0xFE, 0x58, 0xF4, 0x02, 0xD2, 0x02,
+	0x04, 0x59, 0x96, 0x00, 0x94, 0x33, 0xFA, 0xE5, 0x30, 0xF4, 0xF5, 0xE8, 0xF1, 0xAE, 0xCA, 0xF4,
+	0x94, 0xF6, 0xFB, 0x26, 0xA4, 0x04, 0x88, 0x6A, 0x0B, 0x13, 0xA0, 0x0D, 0x09, 0x84, 0x0A, 0x5A,
+	0x6F, 0x03, 0x43, 0x92, 0xFB, 0xAB, 0x7C, 0xF6, 0xE4, 0x0F, 0xF7, 0x35, 0x1A, 0xFE, 0x35, 0xF5,
+	0x09, 0x90, 0x56, 0x16, 0x56, 0x8E, 0x1D, 0x04, 0xE0, 0x1B, 0x1C, 0x83, 0x12, 0x88, 0x9F, 0x06,
+	0x21, 0x8B, 0xFE, 0xD5, 0x6E, 0xFE, 0x04, 0xC9, 0x06, 0x61, 0x4C, 0x14, 0xEE, 0x6D, 0x21, 0xB0,
+	0xD5, 0x28, 0x9D, 0x7B, 0x27, 0x4C, 0xF3, 0x1D, 0x39, 0x51, 0x10, 0xEE, 0x6E, 0x04, 0x43, 0xF4,
+	0xFF, 0x9E, 0x00, 0x06, 0xB7, 0x85, 0x15, 0xD9, 0x1D, 0x28, 0xC2, 0x68, 0x34, 0x15, 0x66, 0x33,
+	0xE0, 0x26, 0x25, 0xA0, 0x31, 0x10, 0xB0, 0xD3, 0xFD, 0x91, 0xD7, 0xF5, 0x8C, 0x31, 0xFB, 0xBD,
+	0xB5, 0x0A, 0x65, 0x1B, 0x1D, 0x4B, 0x98, 0x29, 0x24, 0x11, 0x2A, 0x41, 0x23, 0x1D, 0xE2, 0x2A,
+	0x07, 0x05, 0x4B, 0xF0, 0x7A, 0x71, 0xE1, 0x2E, 0x1F, 0xE1, 0x44, 0x5D, 0xF0, 0xAD, 0x79, 0x07,
+	0x79, 0x82, 0x19, 0x04, 0xF0, 0x1A, 0xC4, 0x33, 0x09, 0xB5, 0x25, 0xEB, 0x91, 0x6D, 0xCD, 0x7B,
+	0x4D, 0xBC, 0x2E, 0x36, 0xBE, 0x49, 0xD0, 0xD0, 0xE3, 0xEC, 0xEA, 0xE2, 0x0A, 0x00, 0xFD, 0x21,
+	0x06, 0x61, 0x2D, 0xF9, 0xB8, 0x46, 0xDD, 0x5F, 0x8D, 0xBC, 0x4B, 0x98, 0xA3, 0xFB, 0x46, 0x9E,
+	0xAB, 0x32, 0xB1, 0x6E, 0xAB, 0xD3, 0x4A, 0xF3, 0xF3, 0x1A, 0x2A, 0x01, 0x52, 0xD4, 0xF4, 0xA2,
+	0xBA, 0xD5, 0x0D, 0x12, 0xB3, 0x03, 0xAE, 0x9D, 0x67, 0x09, 0xA0, 0x5C, 0x0D, 0xBA, 0x45, 0xD9,
+	0xE0, 0xA3, 0x38, 0x04, 0x5F, 0xC6, 0x15, 0xDA, 0x07, 0x0F, 0xD5, 0x19, 0xF4, 0x8C, 0x43, 0xD0,
+	0x3E, 0xD7, 0xB3, 0xDB, 0x77, 0xAF, 0x0D, 0x24, 0xCB, 0xA2, 0xCF, 0xFC, 0x98, 0x00, 0x2E, 0x76,
+	0xC3, 0x48, 0xA2, 0x78, 0x43, 0x85, 0x79, 0x24, 0x1F, 0xD3, 0xFD, 0x1F, 0x1B, 0xE3, 0xC2, 0xF4,
+	0xE2, 0x92, 0xD8, 0xFE, 0x57, 0x06, 0x2B, 0x0F, 0xD8, 0x54, 0x67, 0xB3, 0x6B, 0x3E, 0x0B, 0x68,
+	0xA5, 0x9D, 0x4D, 0xB5, 0x36, 0x27, 0x69, 0x87, 0x05, 0xDE, 0x2B, 0xFB, 0x0D, 0xFB, 0x11, 0x1E,
+	0xB9, 0x40, 0xF7, 0xC4, 0x70, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0x4D, 0xB7, 0x5D, 0x98, 0x4F,
+	0x2C, 0xD2, 0x5F, 0x05, 0x8E, 0x48, 0xF9, 0xD8, 0x98, 0x0A, 0x68, 0xCD, 0x2D, 0x0B, 0xA6, 0x51,
+	0xC4, 0x76, 0x66, 0x03, 0xC3, 0x64, 0xA2, 0x65, 0x4C, 0xB7, 0xDF, 0x22, 0x96, 0xC1, 0xF6, 0x6D,
+	0x78, 0xDD, 0xB5, 0xF1, 0xE3, 0xB4, 0x9A, 0x04, 0x36, 0xB6, 0x2B, 0x83, 0xD5, 0x43, 0xF7, 0x20,
+	0x3E, 0x99, 0x98, 0x1B, 0xD3, 0xBC, 0xEB, 0x0E, 0xBD, 0xC3, 0x4A, 0x6C, 0xB3, 0x62, 0xF0, 0xBD,
+	0xCD, 0x89, 0xDA, 0x8E, 0x6E, 0xFA, 0x57, 0xAC, 0x11, 0xDC, 0x2C, 0x19, 0xE9, 0x62, 0x0C, 0x82,
+	0x33, 0xEA, 0x54, 0x6D, 0xBE, 0x06, 0x68, 0x9E, 0x82, 0x05, 0x9A, 0xE9, 0x87, 0xB1, 0xD4, 0x46,
+	0xD7, 0x13, 0x46, 0xF7, 0xEB, 0xEC, 0x01, 0x4F, 0x28, 0xF3, 0x97, 0x5E, 0xD4, 0x6C, 0xE5, 0xB5,
+	0x4E, 0xB1, 0xA5, 0xEA, 0x6E, 0xA9, 0xEB, 0x7F, 0xBC, 0x5F, 0xD3, 0xD4, 0x0E, 0x2D, 0xEB, 0x85,
+	0xD5, 0xFB, 0x24, 0x26, 0xFF, 0x27, 0x1A, 0xED, 0x62, 0xA4, 0xCA, 0x9D, 0x61, 0xA9, 0x6C, 0x5E,
+	0x9B, 0x32, 0x53, 0xA9, 0x6A, 0x00, 0xCD, 0xF8, 0x58, 0xF5, 0x60, 0x40, 0x10, 0x4F, 0x00, 0x14,
+	0xCF, 0x55, 0x03, 0x45, 0x54, 0xEA, 0x15, 0xBA, 0xD5, 0x81, 0x27, 0xCD, 0x1A, 0x7E, 0xCF, 0x4F,
+	0xE0, 0xD8, 0xDB, 0x23, 0xEB, 0xE0, 0x45, 0x07, 0x77, 0xDC, 0x1F, 0x19, 0x38, 0x23, 0xD0, 0x3B,
+	0x0E, 0xD5, 0xCA, 0xEE, 0xEF, 0x60, 0xD8, 0x0D, 0xFF, 0xD9, 0xB0, 0xB2, 0xF4, 0xAC, 0x44, 0x1B,
+	0xAB, 0x28, 0x3B, 0xA9, 0xF4, 0x46, 0xB7, 0x15, 0x3D, 0x15, 0x16, 0x26, 0x44, 0x1D, 0x0E, 0xE5,
+	0xAC, 0xFC, 0x41, 0xA7, 0xF2, 0x88, 0x81, 0xF1, 0x52, 0x72, 0x02, 0xBC, 0x02, 0x27, 0x39, 0x77,
+	0x4D, 0x12, 0x8B, 0x5F, 0x04, 0x23, 0x54, 0x76, 0x8A, 0x33, 0x0C, 0x67, 0x11, 0x2C, 0x4D, 0x00,
+	0x09, 0xCF, 0x07, 0x3D, 0x88, 0x20, 0xEB, 0x7F, 0x3A, 0xC9, 0xEE, 0x47, 0x43, 0x15, 0x44, 0x6B,
+	0x9C, 0x34, 0x3A, 0xB7, 0x23, 0xB1, 0xD8, 0x16, 0x4E, 0xC4, 0x0A, 0xB6, 0x8A, 0x00, 0x83, 0xD7,
+	0x05, 0xFC, 0x52, 0x21, 0x41, 0x94, 0x45, 0x21, 0xDE, 0x5C, 0x82, 0x88, 0x57, 0xCB, 0xCF, 0x36,
+	0xA7, 0x98, 0x0B, 0x0A, 0x51, 0xEB, 0x44, 0xD8, 0xE2, 0x38, 0x30, 0xF0, 0xA5, 0x53, 0x06, 0x2D,
+	0xF0, 0x17, 0x6A, 0xBF, 0x1E, 0x8A, 0xA0, 0x1E, 0xDA, 0xCD, 0x1E, 0x88, 0x7F, 0x1C, 0x3F, 0x0C,
+	0x0B, 0x40, 0x7F, 0xED, 0xA7, 0x19, 0xDB, 0x1B, 0x64, 0xE3, 0x4A, 0x33, 0xFF, 0xD7, 0x9F, 0x19,
+	0x12, 0x66, 0x1F, 0x11, 0x7F, 0x0A, 0x6D, 0x98, 0xE6, 0xC2, 0x88, 0xC7, 0x1C, 0x14, 0xBC, 0x64,
+	0xE6, 0xC5, 0xEF, 0x47, 0xDB, 0x8D, 0xA0, 0xEF, 0x42, 0xD2, 0xFC, 0x54, 0xC0, 0x05, 0x94, 0xAE,
+	0x0E, 0x37, 0x96, 0x0D, 0xEE, 0xB1, 0xF3, 0xA6, 0x27, 0xC9, 0x89, 0xC0, 0xA8, 0x4A, 0xF8, 0xA5,
+	0x38, 0x1B, 0xC0, 0xEF, 0xA6, 0xE4, 0xAA, 0x27, 0xFD, 0x42, 0x48, 0xFD, 0x8D, 0x1E, 0xEA, 0xC6,
+	0x0F, 0xD4, 0x8F, 0xB5, 0xC9, 0x5E, 0x32, 0xCF, 0xCC, 0x0C, 0xDD, 0x52, 0x22, 0xE8, 0xF9, 0x56,
+	0xEB, 0x9A, 0xE7, 0xED, 0xB7, 0x8C, 0xF8, 0x4D, 0xF7, 0xFF, 0x93, 0x61, 0xF1, 0xE0, 0xAD, 0xCF,
+	0x1D, 0xF5, 0xB0, 0x67, 0xA3, 0xAB, 0xBE, 0xCA, 0xC5, 0x5D, 0x0C, 0xF1, 0xE5, 0x8C, 0x15, 0x15,
+	0xC2, 0x22, 0x87, 0xD2, 0x18, 0x42, 0x43, 0x05, 0xFA, 0x50, 0xF6, 0xA8, 0x75, 0xF1, 0xF9, 0xC9,
+	0xF0, 0xF5, 0x87, 0xEA, 0x1E, 0xD3, 0xDE, 0x82, 0x67, 0xE0, 0xDD, 0xA3, 0xFB, 0xBC, 0x31, 0x1C,
+	0x2C, 0x38, 0x25, 0xC6, 0xD2, 0x11, 0x55, 0x03, 0xF5, 0xCD, 0x1C, 0xE7, 0x55, 0xE6, 0xF4, 0x71,
+	0xC6, 0x15, 0x02, 0x67, 0x34, 0xA0, 0x63, 0x3F, 0xDB, 0x67, 0x34, 0xDB, 0xDE, 0x1E, 0xA9, 0x02,
+	0x0D, 0xE5, 0x6A, 0x04, 0xB2, 0x75, 0xFF, 0x32, 0xB0, 0xF4, 0x9A, 0x51, 0xE9, 0xB4, 0xA2, 0xF4,
+	0x89, 0x2A, 0x1E, 0x86, 0xF9, 0x4B, 0x89, 0x31, 0x5F, 0x23, 0xDD, 0x4D, 0xCB, 0x56, 0x27, 0xA7,
+	0x85, 0x06, 0x8B, 0x36, 0xFE, 0xF1, 0x82, 0x0C, 0xBE, 0xE7, 0x1F, 0xE1, 0xAF, 0x27, 0x92, 0xC8,
+	0x1F, 0x85, 0x0F, 0x12, 0x64, 0x8B, 0x0B, 0xDA, 0xFE, 0x10, 0xD0, 0x4D, 0x19, 0xB1, 0xF8, 0x13,
+	0x77, 0xCD, 0x03, 0xCD, 0x59, 0x03, 0x78, 0xF4, 0x1E, 0x13, 0x8C, 0x43, 0x32, 0x8B, 0x53, 0x3D,
+	0xAB, 0x3F, 0xAE, 0xB1, 0x12, 0xAC, 0x3E, 0xE8, 0xB4, 0x67, 0xD6, 0x8B, 0x25, 0xDF, 0xC1, 0x0F,
+	0xF3, 0xF8, 0x45, 0x01, 0x0D, 0x57, 0x04, 0x04, 0xA7, 0x04, 0x02, 0x57, 0x0E, 0x2D, 0xC5, 0x23,
+	0x92, 0xA8, 0x31, 0x79, 0x15, 0x1E, 0x18, 0x30, 0xF2, 0xD1, 0x73, 0xD5, 0x25, 0x17, 0xDD, 0x48,
+	0xC1, 0xFA, 0x06, 0xD6, 0x10, 0x0F, 0x4F, 0x0A, 0xC9, 0xEC, 0xEB, 0xEC, 0x60, 0xCD, 0x0E, 0xDB,
+	0xC3, 0xDE, 0x55, 0xD2, 0xA5, 0x65, 0xEA, 0xD3, 0xD3, 0xFA, 0x20, 0x44, 0xFE, 0x77, 0x93, 0xFD,
+	0xB5, 0x11, 0x06, 0x0D, 0x3A, 0x18, 0xFB, 0x46, 0x1B, 0x07, 0x78, 0xF7, 0x17, 0xDD, 0xBE, 0xCB,
+	0xE7, 0x9A, 0x7C, 0x8B, 0xA2, 0xCF, 0x54, 0xCB, 0xDF, 0x9F, 0xF5, 0xD7, 0xAF, 0x06, 0x2E, 0xA4,
+	0xFC, 0xFA, 0xE7, 0xEA, 0xC3, 0x4B, 0xE5, 0x19, 0xE1, 0xEF, 0x52, 0xB2, 0xFD, 0x24, 0x45, 0xFF,
+	0xB5, 0x1E, 0xF1, 0xC8, 0xD1, 0xDE, 0x34, 0x77, 0xDC, 0x23, 0x72, 0xF0, 0xA8, 0x1C, 0x00, 0x28,
+	0x33, 0xEF, 0xA1, 0x97, 0xC8, 0x3D, 0xAA, 0xAF, 0xC5, 0x78, 0xBD, 0x33, 0x1D, 0xEC, 0x9B, 0x0F,
+	0x1C, 0x91, 0x0C, 0x31, 0xB4, 0x22, 0x27, 0xD5, 0x9A, 0x10, 0xB4, 0xDF, 0x01, 0x3F, 0x67, 0x00,
+	0xFD, 0xD9, 0x00, 0xF5, 0xF2, 0xF4, 0xFF, 0x37, 0xDA, 0x8D, 0xF8, 0xC1, 0x69, 0xCF, 0xCB, 0xDC,
+	0x75, 0xFD, 0xA4, 0x42, 0x2D, 0x70, 0x22, 0x34, 0x83, 0xF4, 0x17, 0x0A, 0x56, 0xFA, 0xC3, 0xB0,
+	0xF8, 0xBF, 0x04, 0x13, 0xCF, 0xC0, 0x2F, 0x12, 0x2A, 0x36, 0x0F, 0x1C, 0x23, 0x60, 0x96, 0x08,
+	0x38, 0xB5, 0xFA, 0xA2, 0xD4, 0xFD, 0x50, 0x31, 0x05, 0x96, 0xD1, 0x00, 0xED, 0x7A, 0xED, 0x01,
+	0x19, 0xE0, 0x81, 0xBF, 0xF9, 0x80, 0x51, 0x36, 0x31, 0x82, 0x67, 0xF7, 0x4A, 0x69, 0x75, 0x73,
+	0x3F, 0x25, 0xB4, 0x0C, 0x3C, 0x67, 0xF3, 0x6E, 0x84, 0xF9, 0xAA, 0x20, 0x0A, 0x72, 0x9B, 0x0E,
+	0x4B, 0x09, 0x03, 0xB3, 0x00, 0xF7, 0x06, 0x62, 0xFB, 0xA5, 0x5E, 0x11, 0x80, 0xFF, 0x29, 0xDF,
+	0x8D, 0x31, 0x61, 0xDC, 0x1D, 0x9C, 0x99, 0x02, 0x5B, 0x25, 0x05, 0x50, 0xC5, 0x27, 0x85, 0x02,
+	0x46, 0x80, 0xDE, 0x3E, 0x04, 0x1F, 0x12, 0xD2, 0xB0, 0xE0, 0xAE, 0x52, 0xCB, 0x64, 0x89, 0xD7,
+	0xB4, 0xD8, 0xF0, 0xB7, 0x02, 0x00, 0xED, 0x02, 0x00, 0x59, 0x8A, 0xFE, 0x43, 0xE4, 0x0A, 0x36,
+	0xFE, 0x25, 0xA4, 0x6F, 0x40, 0x35, 0x78, 0x3E, 0x4D, 0xC4, 0x0F, 0x19, 0x2A, 0xD4, 0x75, 0x8D,
+	0xBE, 0x8F, 0xE5, 0xD5, 0xA7, 0xD8, 0xF8, 0x8F, 0xD3, 0x03, 0x41, 0xDA, 0xF0, 0x07, 0x72, 0xD8,
+	0x45, 0xF4, 0xD4, 0x86, 0xD9, 0xE9, 0xDA, 0x75, 0x03, 0x3A, 0xD5, 0x0C, 0x2F, 0x3F, 0x03, 0x01,
+	0x2D, 0xF6, 0x40, 0x9F, 0xF6, 0x53, 0x8A, 0x07, 0xC6, 0x8E, 0x19, 0x83, 0x4F, 0x0D, 0x6A, 0xE5,
+	0xD7, 0x4A, 0x85, 0xA0, 0x17, 0x95, 0x94, 0xDB, 0xF1, 0xB9, 0x2F, 0x2E, 0xF0, 0xDB, 0x4C, 0x10,
+	0x6C, 0xE6, 0x0E, 0x39, 0x53, 0xFF, 0x03, 0xA9, 0xF9, 0x8D, 0x26, 0x03, 0x3D, 0x5B, 0x0C, 0x8C,
+	0x75, 0x04, 0xC3, 0x47, 0xEB, 0x72, 0x24, 0xD1, 0xD8, 0xA7, 0xC7, 0x2E, 0x60, 0xD7, 0x11, 0xA8,
+	0xF6, 0x6F, 0x44, 0x03, 0xA2, 0x40, 0xEB, 0xD4, 0xA8, 0xCA, 0x79, 0x41, 0xC7, 0x61, 0xE6, 0xEA,
+	0x8C, 0xF2, 0x19, 0x63, 0x57, 0x31, 0xFF, 0x0C, 0x27, 0x88, 0x73, 0x0D, 0x3B, 0x20, 0xFD, 0xD4,
+	0x31, 0xFD, 0x83, 0xAF, 0x00, 0x1C, 0xA4, 0xF7, 0x49, 0x38, 0xE0, 0x60, 0x60, 0xC7, 0x4F, 0x46,
+	0xC1, 0xF9, 0x97, 0xE1, 0x27, 0x45, 0x1D, 0xEF, 0x55, 0x43, 0x0C, 0x36, 0x39, 0x0E, 0x94, 0x15,
+	0x42, 0x09, 0xFF, 0x9B, 0xBF, 0x06, 0xBE, 0x61, 0x1C, 0x34, 0x5F, 0x24, 0x3B, 0x9D, 0x14, 0x72,
+	0x1A, 0xFC, 0x1B, 0xCF, 0xF0, 0xD8, 0xAA, 0xF9, 0x5B, 0xF5, 0x09, 0x8E, 0x84, 0x0F, 0x73, 0xFC,
+	0x03, 0xF4, 0x71, 0xF0, 0xC0, 0x69, 0xEC, 0x4D, 0x24, 0x0F, 0x4A, 0x0E, 0x48, 0xD8, 0x43, 0x67,
+	0x4C, 0x78, 0x54, 0xB1, 0xFA, 0x21, 0x4B, 0x35, 0xF7, 0x7B, 0x51, 0xEC, 0x69, 0xA9, 0xF8, 0x40,
+	0xC0, 0x03, 0xF9, 0xEF, 0xFF, 0xCD, 0xCA, 0xF5, 0x00, 0x29, 0xF7, 0xFF, 0xF6, 0x0A, 0x27, 0x1B,
+	0x26, 0x1D, 0xA6, 0x36, 0xF9, 0xC9, 0x31, 0xBE, 0x9C, 0x17, 0xF6, 0xDA, 0xFD, 0xE6, 0x6B, 0x03,
+	0xAF, 0xC9, 0x22, 0xA3, 0x59, 0x37, 0x20, 0x1A, 0x27, 0x7D, 0xE9, 0xFB, 0x2A, 0x0A, 0xD8, 0xF6,
+	0x08, 0xD3, 0xF3, 0x6E, 0xE7, 0x6A, 0x88, 0xFD, 0x84, 0x96, 0x04, 0xBA, 0x90, 0x00, 0xF0, 0xAB,
+	0x01, 0xB1, 0xAA, 0x11, 0xDC, 0x77, 0x2A, 0x5A, 0xFB, 0x3B, 0x1D, 0xF1, 0x31, 0xC9, 0xA1, 0x02,
+	0x03, 0x08, 0xCD, 0x6B, 0xE3, 0xBD, 0xBE, 0x8C, 0xD7, 0xBC, 0x10, 0xF8, 0x30, 0xB8, 0x00, 0x0B,
+	0x3E, 0xF0, 0x19, 0xFB, 0xDE, 0xF9, 0x35, 0xE2, 0x91, 0xB5, 0xF7, 0x1A, 0x3D, 0x0B, 0xDE, 0x87,
+	0x0C, 0xEC, 0x5C, 0xFE, 0x62, 0x94, 0xF1, 0xC6, 0xD1, 0xF3, 0xDF, 0x48, 0x04, 0x7F, 0xBE, 0x13,
+	0x85, 0x33, 0x08, 0xB1, 0x6C, 0xD8, 0xA4, 0xAF, 0xA7, 0x50, 0x45, 0x9F, 0xA1, 0x5B, 0xC3, 0x58,
+	0x2E, 0xF5, 0x91, 0x77, 0x11, 0xE4, 0x4D, 0x0F, 0x69, 0x12, 0x01, 0x04, 0x7D, 0xFC, 0x1D, 0xC6,
+	0x04, 0x90, 0x45, 0x0B, 0x67, 0x9B, 0x01, 0x69, 0x37, 0xE9, 0x96, 0xC5, 0xD1, 0xA1, 0x59, 0xCA,
+	0x4A, 0x57, 0xD9, 0x90, 0x97, 0xF6, 0x4A, 0x87, 0x04, 0x63, 0xB1, 0xF0, 0x31, 0xB2, 0xD2, 0x09,
+	0x98, 0xCD, 0x71, 0x22, 0xEC, 0x92, 0x99, 0x16, 0x01, 0xD4, 0x2C, 0xC0, 0x4A, 0x24, 0x10, 0xDD,
+	0x0C, 0x94, 0x2D, 0xFD, 0x90, 0xC2, 0xFC, 0xCC, 0x6F, 0x00, 0x8F, 0x3C, 0xF9, 0x35, 0x82, 0xE4,
+	0xBC, 0x99, 0xCD, 0x49, 0x2C, 0xC6, 0xB7, 0x08, 0xE1, 0xE6, 0xA4, 0x17, 0xDF, 0x66, 0x3E, 0x8A,
+	0x89, 0x38, 0x1F, 0x02, 0x18, 0x0F, 0x5B, 0x00, 0xCE, 0x94, 0x04, 0xB3, 0x17, 0x18, 0xB7, 0x22,
+	0x21, 0x8D, 0x67, 0x14, 0xA6, 0xD9, 0xFD, 0xD4, 0x0D, 0xF2, 0x99, 0x1B, 0xF9, 0xD5, 0x91, 0x08,
+	0x61, 0x65, 0x0F, 0xD5, 0x1F, 0x06, 0x08, 0x1C, 0xF4, 0xF0, 0x9D, 0xED, 0xF1, 0x08, 0x0A, 0xA1,
+	0x7A, 0x3E, 0x21, 0x1B, 0x5F, 0x4B, 0xC6, 0x51, 0xFA, 0x02, 0x24, 0xE8, 0xF5, 0xF9, 0xB8, 0xB8,
+	0xEC, 0x9F, 0x2B, 0xF7, 0x90, 0x9B, 0x02, 0xC5, 0xA7, 0x00, 0x7D, 0x4E, 0xF7, 0x50, 0x22, 0xF7,
+	0x34, 0x36, 0x08, 0xD9, 0xA9, 0x21, 0x21, 0xBC, 0x32, 0x56, 0x62, 0x30, 0xDD, 0x22, 0x19, 0x80,
+	0x14, 0xFF, 0x3B, 0x5E, 0x00, 0xDD, 0x5A, 0x1C, 0x3F, 0x03, 0x32, 0xBB, 0x7F, 0x26, 0x7A, 0xB5,
+	0xFF, 0x9D, 0x7C, 0xDC, 0x42, 0xFC, 0xD4, 0x2A, 0xB9, 0xE6, 0xC5, 0x51, 0xFC, 0xAB, 0x84, 0x04,
+	0xB1, 0x18, 0x01, 0x8A, 0xE4, 0x00, 0xBE, 0x59, 0x0E, 0x88, 0x2B, 0x25, 0xF3, 0x0D, 0x37, 0x47,
+	0xD5, 0x30, 0x73, 0x03, 0x07, 0x51, 0xEA, 0xD2, 0x05, 0x3B, 0xC0, 0x06, 0xAE, 0xD5, 0x37, 0x9A,
+	0xF5, 0x86, 0xF1, 0x00, 0xB8, 0x68, 0xF3, 0xD1, 0x6E, 0xE2, 0x7E, 0x3D, 0xE3, 0x0C, 0x52, 0xF6,
+	0x18, 0x8D, 0x09, 0xF9, 0x76, 0x0C, 0x6D, 0xC5, 0xFF, 0x3C, 0x9E, 0xF2, 0x76, 0xF1, 0xF2, 0xE5,
+	0x4C, 0x01, 0x87, 0x0A, 0x11, 0x67, 0xC8, 0x09, 0x08, 0x9C, 0xDF, 0x6C, 0x2B, 0xB0, 0x93, 0xE1,
+	0xA3, 0xC6, 0xC2, 0xC2, 0xF3, 0x30, 0xF2, 0x7B, 0xD0, 0x0F, 0xAB, 0x17, 0x10, 0x66, 0xB5, 0x02,
+	0x0E, 0xBC, 0xFC, 0x1E, 0x87, 0x03, 0x87, 0x65, 0x0A, 0x55, 0xEC, 0x02, 0xC7, 0xB7, 0xEC, 0x82,
+	0xB3, 0xD5, 0x01, 0xB5, 0xCC, 0x88, 0xDB, 0xD8, 0x28, 0x84, 0xF4, 0xF4, 0xF5, 0x04, 0xC5, 0x82,
+	0xF5, 0x2E, 0x91, 0xD8, 0xAB, 0x74, 0xD0, 0xAC, 0x31, 0xEA, 0xAC, 0x51, 0x12, 0x78, 0xD5, 0x29,
+	0x87, 0x23, 0x24, 0x1B, 0x36, 0x0E, 0x33, 0xEF, 0xFD, 0x9F, 0x5C, 0xFC, 0xDB, 0x3E, 0x00, 0x74,
+	0xFF, 0xFA, 0x68, 0x8E, 0xE8, 0xD0, 0x70, 0xD2, 0xE1, 0x30, 0xC9, 0xD3, 0x3D, 0xDF, 0x8A, 0x22,
+	0x12, 0xB6, 0x50, 0x3A, 0x7C, 0xE4, 0x38, 0x33, 0xB8, 0x1A, 0x2A, 0xE8, 0x01, 0x04, 0xEB, 0x02,
+	0x02, 0xB0, 0x14, 0xE2, 0x00, 0x1F, 0x89, 0xD4, 0x14, 0xEA, 0xA3, 0xFF, 0x0A, 0xFC, 0xF2, 0xF0,
+	0x4B, 0xF8, 0x1A, 0x26, 0x07, 0x31, 0x32, 0x0F, 0x54, 0x16, 0x08, 0x2A, 0x20, 0xF7, 0x06, 0xB4,
+	0xEE, 0x7D, 0xDC, 0x05, 0x1A, 0xB8, 0x36, 0xB6, 0xFD, 0x58, 0x74, 0x77, 0x50, 0xDB, 0x7C, 0x26,
+	0x18, 0xA2, 0xFC, 0x9F, 0x10, 0xED, 0x55, 0x9D, 0xF5, 0xC1, 0x82, 0x01, 0x90, 0x34, 0x01, 0x3D,
+	0x8C, 0xF8, 0xD5, 0x10, 0xF7, 0x48, 0xE0, 0x05, 0xC3, 0x0D, 0x1E, 0xF9, 0xCF, 0x2F, 0x79, 0xAB,
+	0x2F, 0xBC, 0xF9, 0x1A, 0xD1, 0x88, 0x00, 0xAC, 0xE6, 0xFD, 0x4D, 0xFC, 0x16, 0xBF, 0x86, 0x2D,
+	0x41, 0x49, 0x26, 0xFE, 0x1B, 0x03, 0x73, 0x2E, 0xE0, 0xE9, 0x47, 0xD6, 0x2F, 0xB9, 0xE5, 0x7D,
+	0xFE, 0xFA, 0x19, 0x60, 0x04, 0xEA, 0xA7, 0x01, 0x4A, 0x60, 0x00, 0xBD, 0xA6, 0x0B, 0x8E, 0xF7,
+	0x20, 0xE9, 0x2A, 0x33, 0x18, 0x3E, 0x30, 0x1E, 0x00, 0x0B, 0x3C, 0xFC, 0xD7, 0x9F, 0xC3, 0xC1,
+	0x43, 0x9D, 0xD3, 0xAC, 0xE0, 0xF2, 0x71, 0xD9, 0x00, 0x98, 0x0A, 0xF6, 0x7B, 0x39, 0xE5, 0xE4,
+	0xF7, 0xE3, 0x0E, 0xEF, 0xF4, 0xCA, 0x03, 0x08, 0x97, 0x72, 0x0C, 0x3A, 0x16, 0x01, 0x0A, 0x99,
+	0xF3, 0x59, 0x15, 0xF2, 0x93, 0xC3, 0xFE, 0x70, 0x88, 0x0E, 0xA1, 0xFD, 0x0A, 0x06, 0x99, 0xE5,
+	0xAD, 0x03, 0xB7, 0xC1, 0x2F, 0xA7, 0xB2, 0x87, 0xC1, 0x70, 0x0F, 0xEF, 0xC1, 0x2F, 0x0E, 0x20,
+	0xE6, 0x10, 0x72, 0x46, 0x04, 0x92, 0x13, 0xFD, 0xF9, 0x7C, 0x02, 0xC2, 0x9F, 0x09, 0xC8, 0x07,
+	0x04, 0xDF, 0xA8, 0xEF, 0x77, 0xDD, 0xD8, 0x82, 0x62, 0xCE, 0x2D, 0xF7, 0xD7, 0x10, 0x4B, 0xF2,
+	0x25, 0x0B, 0x05, 0xF3, 0x6D, 0xF9, 0x9E, 0xBA, 0xDD, 0x68, 0xB6, 0xD2, 0xBC, 0x58, 0xE8, 0x55,
+	0x8A, 0x0E, 0x7B, 0x66, 0x27, 0xBA, 0x51, 0x24, 0x4F, 0xBD, 0x0F, 0xB9, 0xC6, 0xFE, 0xFD, 0xFB,
+	0xFB, 0xE1, 0xF7, 0xFF, 0xDE, 0x65, 0xFC, 0xDC, 0xD6, 0xEB, 0x4C, 0x6F, 0xD6, 0x9F, 0x7B, 0xCB,
+	0xDD, 0x6B, 0xDD, 0x22, 0x2D, 0x0D, 0x1B, 0xF4, 0x36, 0x84, 0x8B, 0x39, 0x19, 0xC4, 0x1D, 0x8E,
+	0xA0, 0x03, 0xDC, 0xA6, 0x01, 0xF5, 0xDC, 0x11, 0xE2, 0x36, 0x1D, 0xED, 0x62, 0x15, 0xE0, 0x58,
+	0x01, 0x7F, 0xD5, 0xF3, 0x6F, 0x81, 0xF7, 0x6E, 0xCD, 0x05, 0xAF, 0x0C, 0x0F, 0x09, 0xC4, 0x09,
+	0xF8, 0xF1, 0xF9, 0x7D, 0xC2, 0xEF, 0x53, 0x67, 0x02, 0xDE, 0x37, 0x30, 0xF1, 0x08, 0x54, 0x3F,
+	0xED, 0x4F, 0x47, 0x44, 0x29, 0xDE, 0x58, 0xFF, 0x46, 0x66, 0xED, 0xDA, 0x23, 0xF4, 0x1E, 0x5C,
+	0x00, 0x65, 0x98, 0x01, 0x90, 0xA5, 0xF9, 0x4C, 0x0E, 0xF7, 0xFE, 0xDF, 0x03, 0x0C, 0x00, 0x1B,
+	0xAA, 0x76, 0x2D, 0x65, 0x6F, 0x2F, 0xA0, 0xEC, 0x1C, 0x5B, 0x37, 0x02, 0x48, 0x0F, 0xFC, 0x9C,
+	0x2D, 0x12, 0xB5, 0xBE, 0x29, 0xA5, 0x2C, 0x26, 0xF4, 0x3C, 0x06, 0x8D, 0x6D, 0xE3, 0x11, 0x39,
+	0xD7, 0x08, 0x7E, 0xE4, 0x5D, 0x92, 0xF9, 0xE1, 0x2C, 0x04, 0x1C, 0x33, 0x02, 0x07, 0x0F, 0x00,
+	0x62, 0x75, 0x09, 0xE3, 0x62, 0x1D, 0xDA, 0x03, 0x30, 0x3E, 0xEE, 0x2F, 0xCE, 0xBA, 0x0E, 0xF0,
+	0x87, 0xDC, 0x13, 0xFE, 0xC2, 0x77, 0x2D, 0xD1, 0x8A, 0x0E, 0xF0, 0x62, 0x6D, 0x00, 0xB0, 0x36,
+	0xF8, 0x33, 0xB4, 0xE7, 0xE9, 0x7B, 0xE4, 0x84, 0x8F, 0xF3, 0xC9, 0x8B, 0x06, 0x08, 0x72, 0x0C,
+	0x4C, 0x57, 0x02, 0xC2, 0x83, 0xF4, 0x65, 0x62, 0xF1, 0x16, 0x5B, 0xFC, 0x84, 0x41, 0x0C, 0x58,
+	0xDB, 0x0B, 0xD3, 0xAC, 0xEA, 0x91, 0xD2, 0xBC, 0xAB, 0xAA, 0xA9, 0x16, 0xDD, 0xBF, 0xAB, 0xCE,
+	0xEB, 0xA3, 0x86, 0x0C, 0x01, 0xBF, 0x11, 0x06, 0xDE, 0x05, 0x6B, 0x90, 0xFD, 0x75, 0x99, 0x01,
+	0x4F, 0xE1, 0x08, 0x5D, 0xF7, 0x04, 0xA3, 0x38, 0xF2, 0xB7, 0x8E, 0xDB, 0xA8, 0x99, 0xCF, 0xCB,
+	0xEA, 0xD6, 0x32, 0xE2, 0xEF, 0x20, 0xBA, 0x04, 0xC4, 0xE9, 0xFC, 0xE9, 0x36, 0xE2, 0x33, 0xCC,
+	0xD4, 0xFC, 0x90, 0xE6, 0xE9, 0x10, 0x0B, 0xE6, 0x48, 0x25, 0x81, 0xBD, 0x24, 0xC9, 0x60, 0x11,
+	0xBA, 0xB6, 0xFF, 0x02, 0xAE, 0xFB, 0x52, 0x98, 0xFF, 0xFE, 0x7B, 0xFD, 0xEA, 0xAD, 0xEE, 0x01,
+	0xC7, 0xD9, 0x37, 0x61, 0xCD, 0x89, 0x9D, 0xDB, 0x7C, 0x90, 0x08, 0x68, 0xDF, 0x33, 0x70, 0x8C,
+	0x3A, 0xEE, 0xDE, 0x20, 0x58, 0xA8, 0x05, 0xE0, 0xBE, 0x00, 0xBC, 0x51, 0x0F, 0x40, 0xAD, 0x1B,
+	0x22, 0xF7, 0x15, 0x24, 0x04, 0x03, 0xE3, 0xAA, 0xF4, 0xEA, 0xC3, 0xF6, 0x99, 0x81, 0x04, 0xE1,
+	0xD0, 0x0E, 0x11, 0x4D, 0x0B, 0x63, 0x7C, 0xFC, 0x91, 0xE6, 0xF0, 0x59, 0x84, 0xFF, 0x19, 0x87,
+	0x2A, 0x31, 0xD9, 0x4F, 0xC8, 0xDC, 0x4F, 0xE3, 0x4A, 0x2C, 0xBC, 0x27, 0x02, 0xBA, 0xBF, 0xED,
+	0x56, 0xAC, 0xF2, 0xD7, 0x13, 0xFF, 0xA6, 0xD8, 0x01, 0x29, 0xA9, 0xFA, 0x40, 0x18, 0xF7, 0x24,
+	0x1F, 0x02, 0x48, 0x51, 0x18, 0x86, 0x84, 0x2B, 0xA4, 0x68, 0x2F, 0x93, 0x0F, 0x1F, 0x84, 0x1E,
+	0x04, 0x16, 0x95, 0xFA, 0xC3, 0xFD, 0x0D, 0x16, 0x25, 0x26, 0x7E, 0x25, 0x26, 0xF1, 0x2B, 0x09,
+	0x98, 0x6C, 0xE6, 0x36, 0xF6, 0xD7, 0xBF, 0x26, 0xE3, 0x66, 0x05, 0xF8, 0x38, 0xDE, 0x03, 0xD3,
+	0xC3, 0x02, 0xE7, 0xE8, 0xFF, 0x96, 0x92, 0x07, 0x91, 0x51, 0x1A, 0x5A, 0x3D, 0x2D, 0x31, 0xC5,
+	0x2F, 0x1E, 0x3F, 0x12, 0xE8, 0xD2, 0xE0, 0x95, 0xF3, 0xC3, 0x85, 0xB9, 0xCE, 0x7D, 0xF0, 0xEC,
+	0xB8, 0xBA, 0xFF, 0x3F, 0x1A, 0xFA, 0x88, 0xE7, 0xE9, 0x84, 0xF7, 0xE4, 0x13, 0x35, 0xF2, 0x12,
+	0x19, 0x05, 0xB0, 0x67, 0x0C, 0xA9, 0x8B, 0x03, 0x5C, 0x76, 0xF5, 0x39, 0xC6, 0xF0, 0x09, 0x34,
+	0xFA, 0x78, 0x09, 0x0A, 0x8F, 0x5F, 0x0C, 0xE3, 0x21, 0xEF, 0x5A, 0x0E, 0xC2, 0x2C, 0xB0, 0xAB,
+	0xFE, 0xEC, 0xBD, 0x74, 0x69, 0xE8, 0xA2, 0xC6, 0x0A, 0x51, 0x78, 0x12, 0x87, 0x8F, 0x07, 0x4B,
+	0x27, 0xFE, 0xD2, 0xD5, 0x00, 0xF0, 0x2A, 0x08, 0xC6, 0xBF, 0x05, 0x28, 0x83, 0xF4, 0x3E, 0xF2,
+	0xDD, 0x99, 0x9B, 0xD0, 0x49, 0xB0, 0xD5, 0xD1, 0x63, 0xED, 0xEC, 0x19, 0x04, 0x6B, 0xD6, 0xFF,
+	0xA2, 0x84, 0xE6, 0x37, 0xB2, 0xD6, 0x1E, 0xF0, 0xE4, 0xFD, 0xC8, 0x07, 0xB1, 0x51, 0x23, 0x85,
+	0x3F, 0x25, 0xB3, 0x25, 0x13, 0xFF, 0xC4, 0x00, 0x2B, 0x6B, 0xFB, 0x0C, 0x2A, 0xFF, 0x22, 0x5A,
+	0xFE, 0x64, 0x1F, 0xF1, 0xAB, 0xCD, 0xDC, 0x16, 0x04, 0xCF, 0x0D, 0xE7, 0xD9, 0x13, 0x2D, 0x04,
+	0x3F, 0xFB, 0x30, 0x54, 0x86, 0x3B, 0xC0, 0x3B, 0x24, 0x89, 0xE0, 0x07, 0xA1, 0x25, 0x00, 0xFE,
+	0x11, 0x0D, 0x0E, 0x2E, 0x1A, 0x1C, 0x8B, 0x16, 0xED, 0xA7, 0x04, 0xF4, 0x86, 0xF5, 0x48, 0x14,
+	0xF6, 0xF5, 0x37, 0x03, 0x76, 0x85, 0x0E, 0x45, 0xC9, 0x0C, 0x84, 0xE9, 0xFE, 0xEC, 0x3B, 0xF2,
+	0xAA, 0x15, 0xFD, 0x5C, 0x54, 0x25, 0x51, 0x13, 0x4C, 0xB5, 0x0A, 0x50, 0xA6, 0x72, 0x2F, 0xFD,
+	0x1C, 0x05, 0xFF, 0x42, 0xEE, 0x9E, 0x29, 0xF1, 0x78, 0xBF, 0xFD, 0xC5, 0xF0, 0x01, 0xBF, 0x96,
+	0xFB, 0x43, 0x38, 0xF7, 0x5A, 0x90, 0x00, 0xDC, 0xDC, 0x15, 0xDC, 0xC1, 0x29, 0x1E, 0x8D, 0x2F,
+	0x4C, 0x32, 0x21, 0x80, 0x40, 0x06, 0xF9, 0x94, 0xF9, 0xEF, 0x03, 0x0A, 0xF2, 0xCE, 0x22, 0xB0,
+	0xF6, 0x25, 0x7D, 0xF1, 0x0B, 0x7E, 0x4E, 0xE9, 0xCE, 0xA6, 0xD8, 0x0C, 0xBA, 0xE1, 0x11, 0x60,
+	0xF6, 0xBE, 0x76, 0x03, 0x59, 0x4C, 0x03, 0x8A, 0xE8, 0xFF, 0x53, 0xFD, 0x05, 0x0C, 0x82, 0x17,
+	0xD7, 0xC3, 0x2A, 0x26, 0x9C, 0x2F, 0xB7, 0x95, 0x15, 0x9C, 0xF9, 0xE4, 0x39, 0xF8, 0xC4, 0xF8,
+	0x16, 0xCC, 0xC9, 0xBA, 0xE9, 0x97, 0xB2, 0xFE, 0x41, 0xAF, 0xFB, 0xD6, 0xF9, 0xEB, 0x64, 0x6B,
+	0xE5, 0xF2, 0xE4, 0xF0, 0xBC, 0xA3, 0x03, 0xB8, 0x4D, 0x0C, 0x96, 0xB6, 0x04, 0x6D, 0x72, 0xF6,
+	0x6B, 0x37, 0xF0, 0xCB, 0x2C, 0xF8, 0x3C, 0xBC, 0x07, 0xF5, 0x9F, 0x0C, 0x3F, 0x23, 0xF3, 0xCB,
+	0xDD, 0xC6, 0x2B, 0x8B, 0xAD, 0x0C, 0xE6, 0xBB, 0x40, 0xDD, 0xE4, 0x62, 0xD7, 0x08, 0xED, 0x25,
+	0x13, 0x47, 0x3A, 0x09, 0x78, 0xEA, 0xFE, 0xB6, 0x31, 0x00, 0x80, 0x6E, 0x07, 0xB1, 0x65, 0x06,
+	0x0A, 0x9D, 0xF6, 0xDB, 0x2A, 0xE0, 0x3C, 0x78, 0xD1, 0x41, 0x7A, 0xD4, 0x4B, 0xC0, 0xEA, 0xC0,
+	0x20, 0x03, 0x59, 0x7D, 0x02, 0x9B, 0x79, 0xEA, 0xD5, 0xBB, 0xD8, 0x99, 0x70, 0xE3, 0x4C, 0xA1,
+	0x04, 0x40, 0x65, 0x21, 0x04, 0xC9, 0x25, 0xF4, 0xF6, 0x14, 0xEE, 0xF2, 0x01, 0x1A, 0x41, 0xFB,
+	0x92, 0xA8, 0xFE, 0x42, 0x01, 0xFF, 0xD6, 0x58, 0xF3, 0x4E, 0x88, 0xDF, 0x2F, 0x99, 0xD0, 0x81,
+	0x4F, 0xD8, 0x97, 0xEE, 0xFF, 0xE4, 0x05, 0x2E, 0xB2, 0x75, 0x3C, 0xFA, 0x91, 0x27, 0xCD, 0x59,
+	0x0A, 0x08, 0xDA, 0xFF, 0x59, 0xFF, 0x0A, 0xDC, 0xBF, 0x18, 0x3D, 0x10, 0x17, 0xB4, 0x46, 0x06,
+	0x47, 0x72, 0xF6, 0x28, 0x75, 0xF5, 0x4A, 0xEE, 0x01, 0x0D, 0x2C, 0x0E, 0xCE, 0x10, 0x0E, 0x6F,
+	0x5A, 0x01, 0xD8, 0xA4, 0xF3, 0xDB, 0x13, 0xFB, 0xDE, 0x92, 0x20, 0xEB, 0x71, 0x48, 0x51, 0x47,
+	0x50, 0xB0, 0xB1, 0x32, 0x03, 0x39, 0x08, 0xA8, 0xE7, 0xEE, 0x26, 0xC4, 0xEF, 0xF9, 0x43, 0xFC,
+	0xE7, 0xE5, 0x01, 0xCD, 0x77, 0xFC, 0x23, 0x6A, 0xF7, 0x46, 0x2D, 0xFF, 0x01, 0x92, 0x13, 0xDC,
+	0x1B, 0x28, 0x17, 0xAD, 0x2F, 0x03, 0x68, 0x23, 0x68, 0x91, 0x08, 0x02, 0xE7, 0xF8, 0xC2, 0x73,
+	0x06, 0xF4, 0x5E, 0x1F, 0xDE, 0xB1, 0x25, 0xB0, 0x8A, 0x0E, 0x70, 0x22, 0xEC, 0xFD, 0x5C, 0xD9,
+	0x6A, 0x4F, 0xE0, 0xC7, 0x9C, 0xF4, 0xA4, 0xED, 0x02, 0x70, 0xD4, 0x03, 0xE0, 0x07, 0x00, 0x02,
+	0x9A, 0x04, 0xEF, 0xF9, 0x14, 0xD2, 0x60, 0x28, 0x85, 0x6A, 0x2F, 0x12, 0xBE, 0x18, 0x66, 0x1D,
+	0xE9, 0x84, 0x19, 0xC6, 0x32, 0x9A, 0xC9, 0x47, 0x5A, 0xE6, 0x39, 0x66, 0xFD, 0x4E, 0x06, 0xFD,
+	0x73, 0x09, 0xEE, 0xDF, 0xEF, 0xE5, 0xD9, 0xA7, 0xEF, 0x77, 0x26, 0x02, 0xE1, 0x1D, 0x0C, 0x7F,
+	0xD4, 0x05, 0x13, 0x79, 0xF7, 0x5F, 0xD7, 0xEF, 0x5A, 0x2D, 0xF6, 0xBB, 0x80, 0x05, 0xF9, 0x87,
+	0x0C, 0xE2, 0xB4, 0xF6, 0xE0, 0x80, 0xCB, 0x28, 0x57, 0xAF, 0xDD, 0xDE, 0xB9, 0xFB, 0x3C, 0xE1,
+	0x60, 0xBA, 0x06, 0x10, 0xA3, 0x13, 0xD9, 0xFB, 0x0A, 0xFD, 0xC9, 0xFF, 0xA2, 0xAC, 0xFF, 0x1F,
+	0xB3, 0x06, 0x15, 0xE7, 0x06, 0x40, 0x8D, 0xF8, 0x4C, 0x4A, 0xE2, 0xA3, 0x54, 0xD2, 0x4B, 0x3D,
+	0xD3, 0xD4, 0x16, 0xE8, 0x57, 0xD9, 0x01, 0x9B, 0xAE, 0x04, 0x41, 0x72, 0xEE, 0x78, 0xC8, 0xDA,
+	0x0D, 0x2F, 0xE2, 0xCB, 0x90, 0x01, 0xF9, 0x6B, 0x1F, 0x95, 0x40, 0x26, 0xB2, 0xD9, 0x16, 0xD2,
+	0x41, 0x03, 0xD9, 0x2A, 0xFB, 0x88, 0x1F, 0xFE, 0x6B, 0x7D, 0xFF, 0xB8, 0x51, 0xF5, 0x18, 0x1C,
+	0xE2, 0x20, 0x22, 0xD2, 0xDE, 0xE5, 0xD6, 0xB9, 0xD1, 0xFB, 0xE5, 0xF7, 0x2A, 0x07, 0x59, 0x3D,
+	0xB5, 0xF2, 0x2A, 0xCC, 0x26, 0x0D, 0xE4, 0xD9, 0xFF, 0x10, 0x08, 0x09, 0xAE, 0x49, 0x17, 0x72,
+	0x74, 0x17, 0x2F, 0xDF, 0x07, 0x8A, 0x70, 0xF7, 0x16, 0xEE, 0xF4, 0x9D, 0xA4, 0x00, 0xA8, 0xAE,
+	0x0D, 0x0D, 0x48, 0x0F, 0x81, 0xA2, 0x03, 0x2A, 0x49, 0xF5, 0x06, 0x71, 0xF9, 0xB1, 0x11, 0x1C,
+	0x6A, 0xE9, 0x44, 0x23, 0x6E, 0x50, 0xF0, 0xEC, 0x35, 0x6D, 0x81, 0x0B, 0xC6, 0xC8, 0xEF, 0x7D,
+	0x61, 0xEE, 0xFC, 0xBC, 0xFA, 0xD0, 0xAE, 0x01, 0x89, 0x46, 0xFD, 0x76, 0xB5, 0xF7, 0xE8, 0xF0,
+	0xFD, 0xED, 0x60, 0x11, 0x59, 0x79, 0x26, 0x4D, 0xCC, 0x2F, 0x26, 0x86, 0x25, 0x85, 0x17, 0x0B,
+	0xCD, 0xA8, 0xF8, 0x2C, 0x03, 0x03, 0x95, 0x08, 0x1C, 0x7C, 0x21, 0x25, 0x32, 0xFD, 0x10, 0xB4,
+	0xF9, 0xEE, 0x0A, 0x2D, 0xDA, 0xCC, 0xE8, 0xDE, 0xBD, 0xC5, 0xF2, 0xCE, 0x43, 0x02, 0x4B, 0x4D,
+	0x04, 0xE4, 0x43, 0x00, 0xF6, 0x6F, 0x03, 0x16, 0x9C, 0x12, 0x39, 0x1B, 0x26, 0x0C, 0x1A, 0x2F,
+	0x87, 0xB1, 0x1B, 0x3C, 0x42, 0xED, 0x4B, 0x5C, 0xC7, 0xAC, 0x35, 0xC7, 0x66, 0xBB, 0xE2, 0xC1,
+	0xCD, 0xFB, 0x5C, 0x25, 0xFE, 0x3E, 0xFF, 0xEF, 0x93, 0x9A, 0xE6, 0xBC, 0x7E, 0xEE, 0x82, 0xA2,
+	0x00, 0x60, 0xD3, 0x0B, 0xB1, 0xE5, 0x06, 0x5D, 0x93, 0xF8, 0x67, 0x8D, 0xEF, 0x22, 0x61, 0xF4,
+	0x43, 0x27, 0x03, 0x22, 0x32, 0x0C, 0xD7, 0xED, 0xF9, 0x55, 0xF6, 0xCF, 0x00, 0x46, 0xB1, 0xA3,
+	0xF2, 0xB7, 0xBD, 0x83, 0xDD, 0xE4, 0x62, 0x04, 0xC3, 0x00, 0x14, 0x46, 0xAF, 0x0C, 0x05, 0xD9,
+	0x00, 0xFA, 0x46, 0xFF, 0x28, 0xEF, 0x05, 0x37, 0x48, 0x07, 0xFA, 0x5C, 0xFA, 0xD3, 0x5E, 0xE4,
+	0x5B, 0x36, 0xD3, 0x4F, 0x23, 0xD2, 0xE8, 0x59, 0xE5, 0x17, 0x43, 0x00, 0x13, 0x9E, 0x06, 0x15,
+	0x2E, 0xF2, 0xF2, 0x1E, 0xDD, 0x52, 0x20, 0xE1, 0xAF, 0x97, 0xFE, 0xB4, 0x5E, 0x1D, 0x48, 0x9E,
+	0x26, 0x0F, 0xB9, 0x18, 0x08, 0xB0, 0x04, 0xE6, 0x33, 0xFB, 0x93, 0x8E, 0xFD, 0xAF, 0xCD, 0xFF,
+	0x06, 0x1C, 0xF7, 0x75, 0xA4, 0xE4, 0x29, 0xB6, 0xD3, 0x82, 0xB6, 0xD5, 0x5E, 0xD3, 0xF7, 0x5E,
+	0xC8, 0x27, 0x9A, 0xEE, 0x3D, 0x0B, 0x6F, 0x2E, 0xBC, 0x1B, 0x10, 0x0B, 0x2A, 0x00, 0xD9, 0x41,
+	0x07, 0xA1, 0xB6, 0x15, 0xD1, 0xBE, 0x17, 0x28, 0x6C, 0x09, 0xDD, 0x83, 0xF8, 0x28, 0x7F, 0xF4,
+	0x72, 0x5A, 0xFF, 0xC6, 0x1A, 0x0D, 0x2C, 0x49, 0x10, 0x52, 0xF1, 0x05, 0x8A, 0x01, 0xF7, 0x29,
+	0x33, 0xF8, 0x0A, 0xDC, 0x17, 0x0D, 0x46, 0x41, 0x34, 0x6A, 0x50, 0xA6, 0x1C, 0x39, 0x83, 0xEE,
+	0x0E, 0x0A, 0xDE, 0xF0, 0x14, 0x29, 0xED, 0xD3, 0x11, 0xF9, 0x0A, 0x54, 0x01, 0x3D, 0x07, 0xFE,
+	0x10, 0x13, 0xF8, 0x5E, 0xDB, 0xFC, 0xE6, 0x46, 0x0F, 0xAF, 0xD2, 0x24, 0x17, 0xCB, 0x2F, 0x81,
+	0x9F, 0x27, 0x11, 0xBD, 0x0D, 0x8B, 0xBD, 0xF8, 0x63, 0xF0, 0xFF, 0xE1, 0x7F, 0x18, 0xD3, 0x64,
+	0x24, 0xB1, 0x3E, 0x13, 0x1A, 0xD2, 0xF1, 0xF6, 0x1F, 0xDB, 0x29, 0x9B, 0xDD, 0xC7, 0xDC, 0xF0,
+	0x60, 0x75, 0x01, 0xEA, 0xB8, 0x04, 0x09, 0x9C, 0x00, 0xFC, 0x73, 0x02, 0xCB, 0x54, 0x10, 0xE1,
+	0xDA, 0x23, 0xAA, 0x97, 0x2E, 0x3F, 0x6E, 0x1E, 0xE6, 0x6E, 0xF1, 0xC9, 0xF2, 0xC8, 0xA6, 0xE1,
+	0xC4, 0x88, 0x1C, 0xDF, 0x81, 0xDB, 0xF9, 0xE2, 0xFF, 0xFE, 0xAD, 0xFB, 0xF1, 0x4E, 0x5A, 0xE7,
+	0x37, 0x75, 0xED, 0x7B, 0x16, 0xFF, 0xC6, 0x6A, 0x0B, 0x21, 0xE4, 0x07, 0xBB, 0xBB, 0xF9, 0x0C,
+	0x76, 0xEF, 0x8D, 0x9F, 0xF2, 0xF9, 0xDE, 0x00, 0x26, 0x84, 0x0B, 0xE5, 0xC6, 0xFC, 0x95, 0x63,
+	0xD4, 0x66, 0x57, 0xB3, 0x5B, 0x35, 0xB6, 0x29, 0xC9, 0xD9, 0xA6, 0xD4, 0x01, 0x0C, 0x1F, 0x14,
+	0xF4, 0x6E, 0x0E, 0x45, 0x02, 0x02, 0xBF, 0x04, 0xFF, 0xA6, 0x2C, 0x05, 0x50, 0x84, 0x07, 0x40,
+	0x0B, 0xFC, 0x41, 0x70, 0xE6, 0xF7, 0x31, 0xD4, 0x55, 0x1C, 0xD1, 0xA6, 0xA9, 0xE2, 0xC5, 0x62,
+	0xFE, 0xA2, 0x1B, 0x08, 0xED, 0xD2, 0xF5, 0xEA, 0x89, 0xDF, 0x90, 0x54, 0xE0, 0x78, 0xB5, 0xFB,
+	0x1B, 0x35, 0x1B, 0x30, 0xD4, 0x26, 0x9B, 0x95, 0x1A, 0x2A, 0x40, 0x06, 0x26, 0x5B, 0xFB, 0x71,
+	0xF4, 0xFC, 0xE3, 0xF7, 0xFF, 0x7A, 0xC5, 0xF8, 0x7C, 0x0A, 0xE7, 0x4B, 0x6C, 0xD5, 0x34, 0xC0,
+	0xD4, 0x4F, 0xF8, 0xF3, 0x62, 0x61, 0x24, 0x45, 0x50, 0x3E, 0x0A, 0xBE, 0x31, 0xDB, 0x5D, 0x13,
+	0x36, 0xC5, 0x00, 0x46, 0x97, 0x05, 0x13, 0x1F, 0x14, 0x68, 0xD9, 0x17, 0x2D, 0xED, 0x0A, 0x2F,
+	0xAE, 0xF9, 0x5D, 0x2F, 0xF4, 0x76, 0x12, 0xFE, 0x17, 0x61, 0x0C, 0xCF, 0x32, 0x11, 0xB5, 0x16,
+	0x08, 0xFA, 0xF3, 0xF8, 0x6A, 0x4C, 0xF7, 0x65, 0xDA, 0x13, 0x79, 0x9B, 0x3D, 0xFA, 0x22, 0x50,
+	0xB5, 0x2A, 0x3C, 0xC4, 0x80, 0x12, 0x3F, 0x38, 0xF2, 0x6E, 0x02, 0xEC, 0x30, 0x62, 0xF7, 0x4D,
+	0xC9, 0x00, 0xCD, 0xB2, 0xFE, 0x49, 0x89, 0xF8, 0xC1, 0xE9, 0xFB, 0x84, 0x3C, 0x0D, 0x56, 0x1D,
+	0x23, 0x1A, 0xB1, 0x2F, 0xBB, 0x90, 0x29, 0x66, 0x84, 0x10, 0x72, 0x3E, 0xF9, 0x58, 0x1E, 0xFD,
+	0x97, 0x07, 0x15, 0x4A, 0x64, 0x23, 0x60, 0x4C, 0x15, 0xB1, 0xBD, 0xF4, 0x94, 0x48, 0xDC, 0xCF,
+	0x68, 0xDC, 0xFB, 0xD7, 0xEE, 0x16, 0x78, 0x00, 0xCF, 0x12, 0x05, 0x68, 0x07, 0x01, 0xC4, 0x9D,
+	0x01, 0xE5, 0x33, 0x0E, 0x36, 0x82, 0x21, 0x86, 0xED, 0x2D, 0x50, 0xF2, 0x20, 0x6D, 0xB4, 0xF5,
+	0x09, 0xDB, 0xCA, 0xEB, 0xE6, 0xC2, 0xEE, 0x4B, 0xDB, 0x0A, 0xA6, 0xF7, 0x44, 0x9E, 0xFF, 0x02,
+	0xE9, 0xF3, 0x15, 0x4C, 0xE8, 0x23, 0x76, 0xEC, 0x89, 0x66, 0xFD, 0x42, 0xC7, 0x0A, 0x5D, 0xC8,
+	0x08, 0xD2, 0x01, 0xFB, 0xB1, 0x8C, 0xEF, 0x17, 0x1C, 0xF1, 0xB3, 0x7B, 0xFE, 0x3B, 0xA5, 0x0A,
+	0xA6, 0x5E, 0xFF, 0x1D, 0xD3, 0xD8, 0x24, 0xC2, 0xB5, 0xDC, 0xA3, 0xB4, 0x8C, 0xD9, 0xD5, 0x61,
+	0xD6, 0xFE, 0x36, 0xF0, 0x13, 0xC1, 0x12, 0x10, 0x9D, 0x5E, 0x03, 0x14, 0xDA, 0xFE, 0x93, 0x4E,
+	0x04, 0x44, 0x97, 0x07, 0x63, 0xB1, 0xFD, 0x82, 0xB0, 0xE8, 0x33, 0x75, 0xD5, 0x4B, 0x56, 0xD0,
+	0x3E, 0xF1, 0xDF, 0x18, 0x22, 0xFC, 0x40, 0x2E, 0x09, 0xBE, 0x83, 0xF9, 0x40, 0x24, 0xE2, 0x2A,
+	0xB8, 0xDF, 0xEC, 0x9D, 0xF8, 0x0E, 0xA0, 0x18, 0x98, 0xCA, 0x26, 0xEF, 0x97, 0x1C, 0x85, 0x30,
+	0x08, 0x49, 0xCF, 0xFB, 0x2C, 0x69, 0xFC, 0xF5, 0xFD, 0xFF, 0xFF, 0x50, 0xFA, 0x51, 0x98, 0xE9,
+	0x37, 0x47, 0xD7, 0x37, 0xF9, 0xD3, 0xED, 0xF3, 0xEF, 0xF1, 0x6A, 0x20, 0x3D, 0x11, 0x3E, 0x96,
+	0x11, 0x35, 0x1A, 0xDE, 0x16, 0x63, 0xC4, 0x01, 0x2A, 0x0A, 0x04, 0xD6, 0x54, 0x12, 0x4F, 0xFA,
+	0x17, 0x42, 0xC3, 0x0C, 0xB7, 0x60, 0xFB, 0xAA, 0x35, 0xF4, 0x07, 0xB5, 0xFC, 0xFD, 0x49, 0x0B,
+	0x6B, 0xB1, 0x11, 0x34, 0x32, 0x0A, 0xF4, 0xEF, 0xFA, 0x91, 0xA0, 0xF6, 0xF5, 0xC3, 0x0F, 0xCB,
+	0x69, 0x39, 0xA9, 0x8E, 0x4F, 0xD4, 0x79, 0x3F, 0x0B, 0xD1, 0x16, 0x97, 0x4F, 0xF4, 0x72, 0x39,
+	0xEB, 0xE9, 0x84, 0xF5, 0x7A, 0x1C, 0x00, 0x77, 0x7A, 0xFF, 0xD3, 0x40, 0xF9, 0x90, 0x0A, 0xFB,
+	0x3C, 0xDA, 0x0A, 0x47, 0xCE, 0x20, 0x82, 0x16, 0x2F, 0x02, 0x68, 0x2B, 0x9C, 0xB2, 0x13, 0x8E,
+	0x59, 0xFA, 0xFB, 0x81, 0xFA, 0x88, 0x78, 0x11, 0xE8, 0x2D, 0x22, 0xE7, 0xAD, 0x17, 0x29, 0x57,
+	0xF8, 0x45, 0xFB, 0xDD, 0x04, 0x2B, 0xDB, 0x57, 0x45, 0xEC, 0xE0, 0xD5, 0xFE, 0x3F, 0x1E, 0x05,
+	0x78, 0x8A, 0x01, 0x97, 0xE9, 0x00, 0x83, 0xE7, 0x0B, 0x79, 0xEF, 0x1E, 0x09, 0x03, 0x2D, 0x08,
+	0x9C, 0x23, 0xBC, 0xA9, 0xFA, 0xE2, 0xB4, 0xCD, 0x40, 0x45, 0xC1, 0xBB, 0x5F, 0xD7, 0xEE, 0xE0,
+	0xF4, 0x85, 0xF6, 0xFF, 0x34, 0xFB, 0xF5, 0x6A, 0x44, 0xE9, 0xA5, 0x27, 0xEB, 0xE9, 0xFF, 0xFA,
+	0x2E, 0x82, 0x09, 0x1F, 0x8F, 0x09, 0x46, 0xB3, 0xFC, 0x61, 0x3F, 0xF0, 0x08, 0xDA, 0xEF, 0xCA,
+	0x32, 0xFC, 0xF1, 0x86, 0x09, 0x65, 0xEF, 0x01, 0x2A, 0xBD, 0xDD, 0xE2, 0xA8, 0xB8, 0x7E, 0x22,
+	0xB3, 0xE9, 0x48, 0xD1, 0x65, 0xE4, 0xFA, 0x95, 0x16, 0x13, 0xEE, 0xA8, 0x11, 0xEB, 0xE9, 0x04,
+	0xBB, 0xBF, 0xFE, 0x5E, 0x3D, 0x03, 0xD6, 0x79, 0x07, 0x0A, 0x8B, 0xFF, 0x17, 0x8E, 0xEB, 0x9E,
+	0x5E, 0xD7, 0x43, 0xE4, 0xCF, 0x8D, 0x04, 0xDD, 0x48, 0x4A, 0xF9, 0xAE, 0xBE, 0x09, 0x70, 0xF3,
+	0xFC, 0xBE, 0x09, 0xE5, 0xEC, 0xFE, 0xDE, 0xD3, 0x03, 0xF5, 0xBF, 0x5F, 0x15, 0xCA, 0x7A, 0x26,
+	0xF4, 0xF5, 0x1E, 0x9D, 0xDD, 0x0A, 0x30, 0xD0, 0xFC, 0x79, 0xF0, 0xFB, 0xDB, 0xDB, 0xFF, 0x82,
+	0xDC, 0xFB, 0x3E, 0x50, 0xEC, 0xFA, 0x79, 0xD9, 0x68, 0x44, 0xD3, 0xB2, 0x8F, 0xEB, 0xA0, 0x8F,
+	0x1B, 0x31, 0x19, 0x3D, 0xA6, 0x24, 0x38, 0x42, 0xE1, 0x1A, 0xBC, 0x36, 0x03, 0x9A, 0x93, 0x02,
+	0x6B, 0x78, 0x10, 0xDA, 0x1E, 0x18, 0x0C, 0x19, 0x0F, 0x3D, 0xC4, 0xFD, 0xFC, 0xA2, 0xF4, 0xBA,
+	0x2B, 0xFB, 0xF5, 0x9F, 0x09, 0x5E, 0xBC, 0x11, 0xAD, 0x06, 0x0C, 0x68, 0x1F, 0xFD, 0xF8, 0x22,
+	0xF6, 0xE0, 0x8A, 0x0B, 0xD1, 0xC5, 0x34, 0x04, 0x88, 0x4E, 0x85, 0xF6, 0x42, 0xE4, 0xE4, 0x1B,
+	0x91, 0x3C, 0xF7, 0xCC, 0xCA, 0xEA, 0xC1, 0x94, 0xF3, 0xEF, 0x33, 0xFF, 0x6F, 0x44, 0x00, 0x96,
+	0x2F, 0xFA, 0x47, 0x3D, 0xFA, 0x42, 0x1F, 0x08, 0x12, 0xDE, 0x1D, 0x20, 0xF5, 0x2D, 0x33, 0x22,
+	0x2D, 0x1D, 0x2D, 0x17, 0xB0, 0x18, 0xFC, 0xA0, 0x6B, 0xF8, 0x57, 0xB5, 0x0D, 0xA8, 0xDD, 0x20,
+	0x34, 0x27, 0x1A, 0x3F, 0x7C, 0xFC, 0x8D, 0x39, 0xE0, 0xCA, 0xF9, 0xD9, 0x59, 0x29, 0xE9, 0x96,
+	0x8A, 0xFC, 0xF5, 0xD5, 0x04, 0x61, 0x1A, 0x02, 0xC0, 0x5E, 0x00, 0x1B, 0x9E, 0x09, 0xD2, 0x0C,
+	0x1C, 0x9D, 0xE1, 0x2B, 0x51, 0x43, 0x26, 0x41, 0x32, 0x00, 0x4D, 0x6E, 0xD1, 0x2D, 0x43, 0xC0,
+	0xA0, 0x30, 0xD3, 0xFD, 0xA1, 0xF1, 0x44, 0xED, 0xFF, 0x4C, 0x02, 0xF8, 0x1C, 0x68, 0xEA, 0x58,
+	0x9F, 0xE9, 0x2C, 0x04, 0xF8, 0x55, 0xA5, 0x07, 0xCE, 0x30, 0x0A, 0xA1, 0xC8, 0xFE, 0x47, 0x81,
+	0xF1, 0xE7, 0x0D, 0xEF, 0x67, 0xDD, 0xF9, 0xA1, 0x42, 0x08, 0xC8, 0x5C, 0x04, 0x54, 0xEB, 0xE2,
+	0x93, 0x11, 0xBC, 0x75, 0xB6, 0xB1, 0x17, 0x21, 0xCC, 0x69, 0x01, 0xF6, 0x4C, 0x93, 0x11, 0x95,
+	0x3B, 0x13, 0xF0, 0xBC, 0x06, 0x09, 0xD7, 0xFE, 0x29, 0x0D, 0x02, 0x2D, 0x2E, 0x07, 0x9B, 0x8D,
+	0x01, 0x98, 0xFC, 0xEE, 0xE3, 0xEC, 0xD9, 0x01, 0xC1, 0xCF, 0x55, 0xFE, 0xD9, 0x8D, 0xC6, 0xF5,
+	0x01, 0x8F, 0x09, 0x37, 0x50, 0x00, 0x69, 0xF3, 0xE7, 0x18, 0x58, 0xDE, 0x3D, 0xEF, 0xF0, 0xDC,
+	0x78, 0x11, 0x16, 0xED, 0x25, 0x49, 0xC4, 0x21, 0xEF, 0x52, 0x0E, 0xEB, 0x6A, 0xFE, 0xF3, 0x9A,
+	0xFB, 0x68, 0x87, 0xFF, 0xEC, 0x44, 0xFD, 0x27, 0x3B, 0xEF, 0xA6, 0xD7, 0xDB, 0x36, 0xA4, 0xD2,
+	0xED, 0xB8, 0xE6, 0xCB, 0xC2, 0x15, 0x78, 0x45, 0x3B, 0xDD, 0x40, 0x3B, 0xFC, 0x58, 0x1F, 0xEA,
+	0x4E, 0x05, 0x97, 0x5D, 0x01, 0xD2, 0x7E, 0x0E, 0x51, 0x6C, 0x18, 0x9D, 0xF5, 0x11, 0x88, 0xDD,
+	0x00, 0xD4, 0x6B, 0xF5, 0x7D, 0x5F, 0xF9, 0xF8, 0x4D, 0x07, 0xAF, 0x22, 0x11, 0xB3, 0xB5, 0x0D,
+	0x18, 0x52, 0xFF, 0x1F, 0xD4, 0xF5, 0x2D, 0x31, 0x07, 0xD9, 0xA5, 0x2F, 0x84, 0x55, 0x4D, 0x9B,
+	0xF8, 0x46, 0xFA, 0x13, 0x22, 0x33, 0x27, 0xFB, 0xA9, 0xA9, 0xEA, 0xAF, 0x67, 0xF1, 0xFE, 0xEB,
+	0xFD, 0xC9, 0x03, 0x01, 0xE5, 0x48, 0xFB, 0x6F, 0x5F, 0xF9, 0x98, 0xE2, 0x04, 0x50, 0x34, 0x1A,
+	0x97, 0x57, 0x2C, 0x27, 0xD0, 0x2E, 0x8B, 0x45, 0x1B, 0x73, 0xBC, 0xFE, 0xC0, 0xC4, 0xF6, 0x4E,
+	0x1B, 0x0A, 0x70, 0x67, 0x1F, 0xED, 0x0B, 0x1D, 0x29, 0x57, 0x01, 0xAF, 0xE9, 0xE2, 0x31, 0x83,
+	0xD8, 0x3E, 0x33, 0xE5, 0xA1, 0x59, 0xF9, 0xA7, 0x23, 0x04, 0x22, 0xC9, 0x02, 0x73, 0x0D, 0x00,
+	0x79, 0x46, 0x07, 0x7D, 0x07, 0x19, 0x50, 0x99, 0x2A, 0xE6, 0x37, 0x29, 0x2D, 0x9D, 0x06, 0xDD,
+	0x41, 0xD6, 0xE7, 0xA1, 0xBF, 0x4D, 0xBF, 0xCE, 0x75, 0x90, 0xED, 0xB6, 0x63, 0xFF, 0x5C, 0x04,
+	0xFA, 0x52, 0x80, 0xEB, 0xDC, 0xC5, 0xE7, 0x28, 0x4D, 0xF4, 0x30, 0x24, 0x05, 0x3B, 0xBF, 0x0A,
+	0x4E, 0x69, 0x01, 0x80, 0x8A, 0xF3, 0x47, 0xBB, 0xEE, 0xDC, 0xB0, 0xF7, 0x01, 0xC9, 0x06, 0x0E,
+	0xB1, 0x06, 0x20, 0x78, 0xE8, 0x2C, 0x0C, 0xC0, 0xA8, 0x47, 0xB0, 0xDE, 0x2B, 0xC6, 0x63, 0xF3,
+	0xEF, 0x24, 0x46, 0x0F, 0x86, 0xA7, 0x14, 0xFA, 0xFA, 0x08, 0x13, 0x2E, 0xFF, 0xE9, 0xC5, 0x00,
+	0x0C, 0xB6, 0x06, 0xD0, 0xB3, 0x03, 0xDB, 0x04, 0xF3, 0x21, 0x3A, 0xDD, 0xDC, 0x16, 0xD0, 0xC0,
+	0xCC, 0xD6, 0x58, 0x92, 0xF1, 0x5A, 0x9A, 0x08, 0x1C, 0x43, 0x03, 0x71, 0x2D, 0xEB, 0x2D, 0xB3,
+	0xDD, 0xE4, 0x73, 0xEC, 0x78, 0xD8, 0x0C, 0xCA, 0xF2, 0x24, 0xF8, 0xDD, 0x24, 0xC4, 0xA3, 0x12,
+	0xEF, 0xC9, 0x00, 0xB4, 0x7D, 0xFB, 0x05, 0x01, 0xFF, 0x0D, 0x80, 0xFE, 0x7A, 0x36, 0xF2, 0x41,
+	0x9A, 0xDE, 0x26, 0x39, 0xD2, 0xA2, 0x9D, 0xE1, 0xA7, 0xF8, 0x0E, 0x73, 0x71, 0x38, 0x2A, 0xEF,
+	0x3D, 0xDE, 0x61, 0x24, 0x9B, 0x11, 0x08, 0xAC, 0x74, 0x00, 0x2C, 0x6E, 0x0C, 0x47, 0x89, 0x18,
+	0x0B, 0x2F, 0x15, 0x03, 0xBF, 0x04, 0x82, 0xE1, 0xF6, 0x8F, 0xA2, 0xF7, 0xFD, 0x69, 0x04, 0x2E,
+	0xD6, 0x0F, 0x5F, 0xF1, 0x0E, 0x6F, 0x9D, 0x01, 0x31, 0xF1, 0xF5, 0xA5, 0xE1, 0x02, 0x12, 0xDF,
+	0x29, 0x02, 0x6F, 0x4B, 0x5F, 0xE3, 0x4A, 0x42, 0x05, 0x29, 0xED, 0x2F, 0x00, 0x72, 0x44, 0xEB,
+	0x43, 0x20, 0xEF, 0x5D, 0x49, 0xFC, 0x04, 0x98, 0x01, 0xE1, 0xA4, 0xFC, 0xA1, 0xDB, 0xF8, 0x4F,
+	0x8B, 0x01, 0x33, 0xDC, 0x15, 0x7E, 0xDE, 0x29, 0xBD, 0x06, 0x30, 0x98, 0x7E, 0x1F, 0xE5, 0x2A,
+	0x02, 0x37, 0xE1, 0xF5, 0x2E, 0x5B, 0x06, 0x32, 0xA2, 0x1D, 0x4E, 0xBE, 0x1F, 0xE6, 0xC4, 0x06,
+	0x63, 0x88, 0xE6, 0xB7, 0x8F, 0xD7, 0xCA, 0xE5, 0xE0, 0x5E, 0x51, 0xF5, 0x41, 0xC6, 0x02, 0x5B,
+	0x5C, 0x03, 0x1E, 0x06, 0x00, 0x49, 0x1A, 0x05, 0x3C, 0xA3, 0x15, 0x97, 0xC7, 0x28, 0x6F, 0xBC,
+	0x2B, 0x2A, 0x68, 0x0D, 0x2E, 0x3A, 0xDC, 0x41, 0x1F, 0xC0, 0x9D, 0x60, 0xCA, 0x6F, 0xFE, 0xE8,
+	0xCF, 0x33, 0xFE, 0xDA, 0xEB, 0xFB, 0x6C, 0xFD, 0xEC, 0x82, 0x16, 0xE6, 0x5A, 0x1C, 0xF0, 0xC1,
+	0xB2, 0x01, 0xB9, 0x96, 0x0A, 0x31, 0x10, 0x04, 0xA9, 0x35, 0xF6, 0x0B, 0x03, 0xEF, 0xEF, 0xB9,
+	0xF5, 0x8B, 0xE9, 0x04, 0xDA, 0x9B, 0x08, 0x46, 0x47, 0xEE, 0x7C, 0xDC, 0xC4, 0x06, 0xAD, 0xAF,
+	0x04, 0x28, 0xC0, 0xCE, 0xE9, 0xE8, 0x61, 0xD2, 0x0B, 0x41, 0xA2, 0x15, 0x38, 0x64, 0x0B, 0x3F,
+	0xF1, 0xFF, 0x51, 0x75, 0xFF, 0xF0, 0xBE, 0x05, 0xF0, 0x7B, 0x05, 0x1D, 0x52, 0xF7, 0x15, 0x62,
+	0xE1, 0xCF, 0x4F, 0xD1, 0x99, 0x0F, 0xD4, 0x26, 0xE8, 0xEC, 0x2E, 0xB9, 0x06, 0xE3, 0xE6, 0x05,
+	0x89, 0x93, 0xEE, 0x02, 0xA6, 0xDD, 0xBE, 0xD6, 0xE7, 0xD7, 0x55, 0x07, 0xFF, 0xFA, 0x22, 0xF8,
+	0xA9, 0x27, 0x84, 0x82, 0x17, 0x46, 0x13, 0x04, 0x09, 0xE9, 0xFB, 0x78, 0x5B, 0xFE, 0x02, 0x65,
+	0xFF, 0x5B, 0x47, 0xF5, 0x26, 0xD7, 0xE1, 0x3D, 0x93, 0xD2, 0x35, 0xC5, 0xDC, 0x5D, 0x71, 0x07,
+	0xD5, 0x40, 0x34, 0xE5, 0xE0, 0x3F, 0x6B, 0x73, 0x29, 0x58, 0x89, 0x0B, 0x81, 0x03, 0x00, 0xB4,
+	0x23, 0x0A, 0xDF, 0x33, 0x18, 0x7A, 0x60, 0x18, 0x58, 0x5A, 0x09, 0xB2, 0x5F, 0xF9, 0x42, 0x76,
+	0xF6, 0x23, 0x46, 0x01, 0xAE, 0xD7, 0x0D, 0xD5, 0xA0, 0x0F, 0xFC, 0x04, 0x04, 0x64, 0x7D, 0xF6,
+	0x9C, 0xD5, 0xFE, 0x14, 0x90, 0x23, 0x01, 0x65, 0x48, 0x92, 0x2D, 0x4E, 0xB0, 0x67, 0x30, 0xD9,
+	0x67, 0x06, 0x02, 0xD9, 0xEC, 0xDD, 0x1F, 0xED, 0x53, 0x35, 0xFA, 0xF7, 0xE6, 0x01, 0xBB, 0x4C,
+	0xFE, 0x0E, 0xF0, 0xF8, 0x70, 0x73, 0xFE, 0x96, 0x01, 0x11, 0x14, 0x63, 0x26, 0x6C, 0x50, 0x30,
+	0xEE, 0x9A, 0x23, 0xE6, 0x4B, 0x06, 0xA1, 0xBB, 0xF5, 0xC6, 0xD5, 0x02, 0x1F, 0x2F, 0x1B, 0x07,
+	0x18, 0x22, 0x35, 0xA0, 0x0C, 0x59, 0x42, 0xEB, 0x14, 0x8C, 0xD7, 0xA0, 0xA6, 0xDC, 0x22, 0x7B,
+	0xF0, 0x25, 0x87, 0x00, 0x44, 0xA9, 0x03, 0x55, 0x45, 0x00, 0x63, 0x29, 0x03, 0x42, 0x0A, 0x12,
+	0x88, 0x25, 0x26, 0x6E, 0x85, 0x2D, 0x17, 0x3C, 0x14, 0x29, 0x53, 0xE3, 0x13, 0xEC, 0xC1, 0x52,
+	0xA2, 0xC6, 0x67, 0xFD, 0xE3, 0x06, 0x50, 0xFC, 0xF1, 0xA6, 0xFD, 0x76, 0x05, 0xEF, 0xDB, 0xE3,
+	0xE4, 0xF0, 0xB5, 0xEB, 0x7F, 0x46, 0xFD, 0x37, 0x64, 0x09, 0x0F, 0x5D, 0x06, 0x99, 0x57, 0xF9,
+	0x0C, 0x1A, 0xF0, 0xA4, 0x0C, 0xF4, 0xED, 0xD7, 0x02, 0x08, 0xEA, 0x09, 0x2F, 0x17, 0xF4, 0x26,
+	0xB4, 0xCA, 0xEE, 0x31, 0xB0, 0x9A, 0x7E, 0xBA, 0xCE, 0x1A, 0xE1, 0x9A, 0x19, 0x07, 0xF1, 0xC2,
+	0x15, 0xCF, 0xEF, 0x0D, 0x6B, 0x20, 0x01, 0xA6, 0x3B, 0xFE, 0x1B, 0x42, 0x04, 0x77, 0x9A, 0x06,
+	0xEF, 0x91, 0xFB, 0x4B, 0x51, 0xE6, 0x4A, 0xB0, 0xD3, 0xC0, 0x0B, 0xD2, 0xE1, 0x20, 0xE8, 0x37,
+	0xFD, 0x03, 0xBD, 0xD6, 0x07, 0xBB, 0x60, 0xF2, 0x5C, 0x2F, 0xDE, 0x29, 0x74, 0xE3, 0x41, 0x08,
+	0x01, 0x6E, 0xBB, 0x1F, 0x74, 0xAF, 0x29, 0x48, 0xAC, 0x1C, 0x5C, 0x4A, 0x08, 0x6D, 0x0E, 0xFD,
+	0x8A, 0xC4, 0xFD, 0x3F, 0xEB, 0xFF, 0xC8, 0x30, 0xF8, 0x28, 0x9B, 0xE5, 0x89, 0xD5, 0xD3, 0x77,
+	0x93, 0xD8, 0x99, 0x72, 0xFF, 0xF5, 0xAD, 0x2E, 0xA8, 0x90, 0x40, 0xDF, 0x5B, 0x2E, 0x2E, 0xBE,
+	0x0F, 0x3F, 0x29, 0x00, 0xBA, 0xA5, 0x07, 0x57, 0x32, 0x17, 0x69, 0x2C, 0x1B, 0x4B, 0x81, 0x0E,
+	0x4F, 0x0B, 0xFD, 0xC1, 0x3E, 0xF6, 0x36, 0x37, 0xFE, 0xA7, 0x28, 0x0B, 0xB8, 0xAF, 0x0F, 0x88,
+	0x35, 0x06, 0x1F, 0xA5, 0xF7, 0x53, 0x47, 0xFB, 0xA2, 0xBF, 0x1C, 0x8F, 0x25, 0x44, 0x61, 0x5E,
+	0x50, 0xEF, 0xC9, 0x37, 0x60, 0xBA, 0x0D, 0xFC, 0xB6, 0xEF, 0x19, 0x90, 0xEB, 0x7D, 0xE0, 0xF7,
+	0x70, 0xC5, 0x01, 0xBF, 0x22, 0x00, 0xA0, 0xC8, 0xF9, 0x58, 0xF5, 0xFB, 0x18, 0xEC, 0x0B, 0xC9,
+	0xE0, 0x21, 0x28, 0x76, 0x2F, 0x30, 0x20, 0x27, 0xB7, 0xF1, 0x0A, 0xEF, 0x8E, 0xF6, 0x06, 0x70,
+	0xFF, 0x1A, 0x48, 0x18, 0xE8, 0xAB, 0x23, 0x69, 0xA7, 0x12, 0x1D, 0x23, 0xF1, 0x15, 0xD6, 0xD8,
+	0xF0, 0xDF, 0xD8, 0xFD, 0x16, 0xEB, 0xFF, 0x4C, 0xFD, 0x7A, 0x6C, 0x03, 0x03, 0xB5, 0x00, 0x6F,
+	0xA1, 0x01, 0xAA, 0x52, 0x0E, 0xBA, 0xC1, 0x22, 0x9F, 0x3B, 0x2E, 0x1D, 0xB0, 0x1A, 0x6B, 0x57,
+	0xEB, 0x52, 0x2D, 0xC5, 0x5C, 0xC7, 0xC3, 0x1A, 0xAE, 0xDE, 0xC2, 0xA9, 0xF9, 0xB8, 0x10, 0xFF,
+	0xF5, 0x7A, 0xF1, 0x91, 0x81, 0xE4, 0xD2, 0x69, 0xE7, 0x6B, 0xFB, 0xF7, 0x8C, 0xE6, 0x06, 0x08,
+	0xE6, 0x07, 0xD6, 0xAE, 0xFC, 0x25, 0xE9, 0xF1, 0x5E, 0xFF, 0xF2, 0xC3, 0x80, 0x00, 0xCA, 0x8D,
+	0x0A, 0xE6, 0xB0, 0xF9, 0x2C, 0x5E, 0xD1, 0xF7, 0x33, 0xB2, 0x80, 0xB2, 0xB5, 0x7B, 0xDB, 0xD8,
+	0x35, 0x11, 0x01, 0xC2, 0xD9, 0x14, 0x37, 0x3D, 0x10, 0xB6, 0xD3, 0x02, 0xC3, 0x3F, 0xFD, 0xC4,
+	0x44, 0x02, 0x09, 0xD6, 0x06, 0x56, 0x60, 0xFF, 0x8C, 0xC6, 0xEB, 0x41, 0x45, 0xD7, 0xC4, 0x30,
+	0xD1, 0x6B, 0x80, 0xE3, 0xF9, 0x73, 0x00, 0x67, 0x1F, 0x09, 0xCF, 0x2D, 0xF6, 0x4E, 0xAA, 0xDF,
+	0x9A, 0x8B, 0xDF, 0x35, 0x27, 0xFA, 0xB3, 0x14, 0x1B, 0x94, 0x82, 0x2A, 0xBA, 0xAA, 0x21, 0xA4,
+	0x51, 0x0D, 0xD1, 0x20, 0xFF, 0xC6, 0x6D, 0xFD, 0x80, 0x10, 0x00, 0xFB, 0xD0, 0xFA, 0x0E, 0xD6,
+	0xE9, 0xB1, 0x30, 0xD6, 0xFD, 0x79, 0xD5, 0xBD, 0x6B, 0xF7, 0x2F, 0xD5, 0x27, 0xBA, 0xCD, 0x3F,
+	0x8B, 0xD9, 0x32, 0x92, 0x62, 0x14, 0xAE, 0x0B, 0x01, 0x97, 0x32, 0x05, 0xDA, 0x59, 0x15, 0x9A,
+	0x48, 0x1D, 0x13, 0xD9, 0x13, 0xAC, 0xE0, 0x01, 0x4E, 0x51, 0xF7, 0xAD, 0xAB, 0xFB, 0xA5, 0x0C,
+	0x08, 0xEE, 0xE8, 0x0E, 0x84, 0x2F, 0x08, 0xD4, 0x39, 0xF9, 0xA2, 0x77, 0xF8, 0xA9, 0xD0, 0x15,
+	0xCF, 0x8E, 0x3E, 0xCB, 0x1A, 0x51, 0xBA, 0xAC, 0x3E, 0xD9, 0xDB, 0x15, 0x39, 0xEE, 0xF3, 0x48,
+	0xE0, 0xEA, 0x7F, 0x57, 0xF5, 0xF1, 0x29, 0x01, 0x1C, 0xFA, 0x01, 0xD8, 0x66, 0xFB, 0x5C, 0x68,
+	0xFA, 0x0F, 0x0B, 0x07, 0xE2, 0x89, 0x1C, 0x8E, 0x3A, 0x2D, 0x6C, 0xC4, 0x29, 0xD5, 0xC2, 0x0F,
+	0x5D, 0x40, 0xF8, 0x2B, 0x9C, 0xFC, 0xFD, 0xB3, 0x14, 0x28, 0x67, 0x24, 0x2D, 0x70, 0x18, 0x7C,
+	0x01, 0xF8, 0xF8, 0xB0, 0xDB, 0x7A, 0x19, 0xD6, 0x63, 0x7E, 0xE5, 0x20, 0x1D, 0xF9, 0x7F, 0x72,
+	0x02, 0x14, 0x31, 0x01, 0x03, 0x91, 0x00, 0x9A, 0xA9, 0x0A, 0x35, 0x9F, 0x1E, 0xE7, 0x92, 0x2D,
+	0x1C, 0x40, 0x20, 0x13, 0xDD, 0xF3, 0xE0, 0x02, 0xCA, 0x1C, 0x0F, 0xC2, 0x3D, 0x9A, 0xD9, 0x92,
+	0x3C, 0xF6, 0xAA, 0xEF, 0xFF, 0x99, 0x62, 0xF4, 0x8A, 0x0B, 0xE5, 0x2C, 0xB3, 0xE3, 0x67, 0x1F,
+	0xF2, 0x47, 0x09, 0x03, 0xE7, 0x3F, 0x08, 0x77, 0xCE, 0xFF, 0xBB, 0x63, 0xF4, 0x3C, 0x8D, 0xF2,
+	0xCB, 0x3B, 0xFE, 0xFA, 0x5C, 0x0A, 0x30, 0xBA, 0xFE, 0x7E, 0xBD, 0xD8, 0xF8, 0xBD, 0xB5, 0xC2,
+	0x3E, 0xB2, 0xC7, 0xB2, 0xD0, 0xB3, 0xE4, 0xF9, 0x2D, 0x99, 0x12, 0x81, 0x24, 0x12, 0xD3, 0xDC,
+	0x04, 0x5F, 0xB6, 0xFC, 0x03, 0xF4, 0xFF, 0xE9, 0x08, 0x06, 0xCC, 0x52, 0x02, 0xFF, 0x5A, 0xF1,
+	0x5B, 0xFB, 0xDB, 0xB4, 0xAC, 0xD1, 0xB2, 0x8A, 0xDF, 0x18, 0x5C, 0xFC, 0x05, 0x76, 0x09, 0x19,
+	0x13, 0xFA, 0x7F, 0xE5, 0xE1, 0x1C, 0x82, 0xDC, 0x0B, 0x13, 0xF3, 0x93, 0x0F, 0x15, 0x9C, 0xC0,
+	0x29, 0xEE, 0xFE, 0x25, 0xB0, 0xE4, 0x12, 0xA8, 0x2E, 0x02, 0xAC, 0x8E, 0xFD, 0x1E, 0xEB, 0xFF,
+	0x8D, 0xFF, 0xFC, 0x74, 0x2F, 0xEE, 0x8C, 0xB0, 0xD9, 0xEA, 0xC7, 0xD3, 0xDD, 0xE9, 0xEF, 0x14,
+	0xFD, 0x1F, 0x81, 0x89, 0x3D, 0x7C, 0x55, 0x36, 0x0B, 0x61, 0x19, 0xE8, 0xAF, 0x02, 0x5E, 0xEB,
+	0x02, 0xB3, 0xCF, 0x12, 0x6F, 0x4D, 0x1E, 0x61, 0xF0, 0x18, 0x83, 0xA2, 0x07, 0xC0, 0xDE, 0xF9,
+	0x62, 0x14, 0xFA, 0x78, 0xD4, 0x04, 0x33, 0x73, 0x0D, 0x7C, 0x98, 0x09, 0x0B, 0x48, 0xFB, 0x61,
+	0x89, 0xF6, 0x2B, 0x08, 0x0F, 0x2C, 0xE9, 0x37, 0x39, 0x14, 0x50, 0x28, 0x80, 0x44, 0xC4, 0x63,
+	0x1E, 0x9A, 0x7F, 0xF9, 0x48, 0x37, 0xEB, 0xFD, 0xFA, 0xF2, 0xA0, 0xF8, 0xFF, 0xCE, 0x9B, 0x03,
+	0xF9, 0xB4, 0xFD, 0x4C, 0x05, 0xFA, 0x30, 0xD5, 0x02, 0x20, 0xBD, 0x16, 0x2B, 0xAE, 0x29, 0x68,
+	0x16, 0x2B, 0x25, 0x5C, 0x14, 0x3F, 0xC8, 0xFA, 0xC0, 0x64, 0xFA, 0x1F, 0xE0, 0x10, 0x43, 0x0B,
+	0x24, 0x6C, 0x99, 0x1D, 0x07, 0x87, 0xFF, 0xF0, 0x2E, 0xE0, 0x0D, 0xC2, 0xD4, 0x7E, 0x29, 0xE0,
+	0xB5, 0x29, 0xF4, 0xE8, 0x96, 0x00, 0x39, 0x7D, 0x01, 0xBD, 0xFC, 0xFF, 0x4A, 0x65, 0x07, 0x84,
+	0xEB, 0x19, 0x59, 0x8D, 0x2B, 0xCC, 0x75, 0x24, 0x53, 0x5E, 0xFC, 0x56, 0x23, 0xD0, 0x31, 0xE5,
+	0xC1, 0xC5, 0xE6, 0xD4, 0xD1, 0x4E, 0xF2, 0x08, 0x20, 0x00, 0xA2, 0x6C, 0xF7, 0x7D, 0xB2, 0xE6,
+	0x2E, 0xEC, 0xE0, 0x48, 0x2B, 0xEC, 0x4E, 0xF0, 0xFD, 0xE0, 0x25, 0x07, 0xB7, 0x44, 0x02, 0xE6,
+	0x34, 0xF7, 0x54, 0xE7, 0xF2, 0xED, 0x0C, 0xFC, 0x9B, 0x7D, 0x09, 0xA1, 0xE9, 0x02, 0xE3, 0x52,
+	0xE0, 0xB8, 0xD7, 0xBA, 0x45, 0x80, 0xB0, 0x6B, 0x2C, 0xC9, 0x4D, 0xF1, 0xF1, 0x33, 0x04, 0x0F,
+	0x95, 0x36, 0x13, 0xFF, 0x2F, 0x07, 0x4D, 0xB4, 0xFC, 0xC5, 0x8F, 0xFD, 0x75, 0x40, 0x04, 0xBE,
+	0x10, 0x04, 0x97, 0x87, 0xF6, 0x6D, 0x7B, 0xE1, 0x0E, 0xA8, 0xD3, 0x54, 0x97, 0xDC, 0x2C, 0x0F,
+	0xF8, 0xCE, 0xF2, 0x08, 0x69, 0x93, 0xFD, 0x13, 0xEC, 0xE4, 0x74, 0xB7, 0xDA, 0x1C, 0x4A, 0xEC,
+	0x43, 0xF3, 0x0D, 0xD8, 0x3E, 0x27, 0x47, 0x2D, 0x29, 0x7C, 0x87, 0x18, 0x63, 0x24, 0x06, 0x7E,
+	0x60, 0xFE, 0xF0, 0x9F, 0xFF, 0x39, 0x92, 0xFE, 0x8A, 0x70, 0xF2, 0x17, 0x08, 0xDE, 0x5E, 0xBC,
+	0xD3, 0x75, 0x76, 0xE9, 0xA7, 0xA8, 0x17, 0x17, 0xAF, 0x39, 0x3D, 0xBB, 0x38, 0x00, 0x37, 0x1E,
+	0xCA, 0x1E, 0x05, 0x2F, 0x1A, 0x01, 0x94, 0x9C, 0x0F, 0xEE, 0x21, 0x1E, 0xEC, 0x3F, 0x1D, 0x5A,
+	0xE4, 0x0D, 0x0B, 0xDE, 0xFD, 0x4B, 0xCF, 0xF9, 0xD3, 0xF3, 0x01, 0xE0, 0x62, 0x0B, 0xE5, 0x79,
+	0x0A, 0x51, 0x75, 0xFD, 0x29, 0xA6, 0xF5, 0xB2, 0xE3, 0x08, 0xE7, 0x73, 0x30, 0xCA, 0x50, 0x4D,
+	0x50, 0xCC, 0x48, 0x10, 0xB5, 0x26, 0xFB, 0x21, 0x00, 0xCC, 0xD8, 0xEC, 0x0B, 0xEF, 0xF0, 0x52,
+	0x5B, 0xFE, 0x9D, 0xC4, 0x04, 0x7C, 0x6E, 0x00, 0x58, 0xDE, 0xFA, 0xD5, 0xBC, 0xFF, 0xA3, 0x02,
+	0x11, 0x95, 0x05, 0x25, 0x5B, 0xF6, 0x2A, 0xD5, 0x62, 0x18, 0xAA, 0xDE, 0xFD, 0x21, 0xD1, 0xF8,
+	0x51, 0xE0, 0x0C, 0xBD, 0x72, 0x22, 0xEA, 0xB5, 0x21, 0x3F, 0x32, 0x07, 0xE8, 0x1C, 0xE6, 0xCA,
+	0x20, 0xD5, 0x72, 0xAB, 0xDB, 0x82, 0xC6, 0xEE, 0xDB, 0xD2, 0xFD, 0x70, 0x68, 0x01, 0x93, 0xD2,
+	0xFF, 0xBF, 0xAD, 0x04, 0xDA, 0x19, 0x15, 0x85, 0x33, 0x28, 0xC3, 0x02, 0x27, 0xD2, 0x3E, 0x04,
+	0x0B, 0x3A, 0xD7, 0x9C, 0x28, 0xC3, 0xD3, 0x21, 0xD1, 0x65, 0xF9, 0xED, 0x90, 0x8E, 0xFF, 0xE3,
+	0x6C, 0xFA, 0x03, 0x43, 0xE9, 0x99, 0x78, 0xDF, 0x8F, 0xA6, 0xE6, 0x12, 0xFB, 0xF7, 0x74, 0x83,
+	0x04, 0x97, 0xA9, 0x03, 0xDF, 0x07, 0xFA, 0xBF, 0xDB, 0xF3, 0xDA, 0x50, 0xFA, 0xFE, 0xEE, 0x07,
+	0xB2, 0x06, 0x06, 0xB8, 0xBE, 0xE7, 0xD9, 0x15, 0xC1, 0x32, 0xA5, 0xB0, 0x2B, 0xDB, 0xC2, 0xE0,
+	0xB6, 0xE9, 0x20, 0x2E, 0x0A, 0xF2, 0x5D, 0x13, 0x07, 0x70, 0x09, 0xEB, 0x4C, 0xFD, 0xED, 0x62,
+	0xFB, 0x27, 0xB0, 0x01, 0xE9, 0x70, 0x04, 0x7D, 0xCB, 0xFA, 0xB1, 0x44, 0xE7, 0x16, 0xF2, 0xD6,
+	0xA3, 0xDC, 0xDA, 0xAF, 0xED, 0xF3, 0x6B, 0xBA, 0x07, 0xFA, 0x9F, 0x00, 0x71, 0xB0, 0xE8, 0x6D,
+	0x26, 0xDA, 0x57, 0x50, 0xE6, 0xF2, 0x39, 0x06, 0xB7, 0x0C, 0x23, 0x96, 0xCB, 0x2A, 0x7F, 0xC8,
+	0x1D, 0x82, 0xBF, 0x0A, 0x36, 0xFA, 0xFF, 0xE2, 0x67, 0xFF, 0xF7, 0x8A, 0xFF, 0x00, 0x34, 0xF6,
+	0x97, 0xF9, 0xE2, 0x2A, 0x42, 0xD5, 0x02, 0x88, 0xE4, 0x72, 0x70, 0x0F, 0x67, 0xAA, 0x34, 0xBF,
+	0xAF, 0x39, 0x4E, 0xC4, 0x22, 0x2C, 0x1C, 0x08, 0xC3, 0xE7, 0xFF, 0x4A, 0x24, 0x0C, 0x6D, 0xA6,
+	0x1C, 0x99, 0x66, 0x20, 0xAF, 0x12, 0x14, 0x32, 0x05, 0x03, 0x10, 0x05, 0xFB, 0xCD, 0xD3, 0xFF,
+	0x00, 0x17, 0x09, 0xCF, 0xA5, 0x0A, 0xBB, 0xB5, 0xFF, 0x39, 0xAB, 0xF5, 0x24, 0xAD, 0x03, 0xCE,
+	0xC9, 0x28, 0xBD, 0xF4, 0x48, 0x1D, 0x4D, 0x4B, 0xEB, 0x4B, 0x2E, 0xF2, 0x6C, 0x07, 0x4B, 0xB1,
+	0xEF, 0x03, 0x98, 0xEF, 0xFC, 0x6B, 0xFC, 0xE5, 0x56, 0x05, 0x89, 0x3F, 0x03, 0x9C, 0xCF, 0xFC,
+	0xF9, 0x05, 0xFE, 0x26, 0xE5, 0x0B, 0x31, 0xB8, 0x1F, 0x58, 0x76, 0x29, 0x0D, 0x6B, 0x1B, 0x95,
+	0x34, 0x01, 0x24, 0x18, 0xF8, 0x8B, 0xD2, 0x08, 0x72, 0xF8, 0x1F, 0x33, 0x6D, 0x24, 0xD3, 0x77,
+	0x0E, 0xC8, 0x16, 0xED, 0x2F, 0x47, 0xD7, 0x5E, 0x65, 0xD8, 0xEF, 0x71, 0xE9, 0xD9, 0x46, 0xFA,
+	0x8D, 0xC1, 0x00, 0xB9, 0xEA, 0xFF, 0x4C, 0xB1, 0x02, 0xEF, 0x74, 0x10, 0x1A, 0xF2, 0x23, 0x21,
+	0xC9, 0x27, 0xB6, 0xF8, 0x0A, 0x36, 0xAB, 0xDE, 0x81, 0xD6, 0xC5, 0xC8, 0x47, 0xCE, 0x33, 0xB0,
+	0xE9, 0x99, 0x33, 0xFE, 0xFD, 0x07, 0xFD, 0x47, 0x9D, 0xEC, 0x1F, 0x62, 0xDF, 0x4C, 0x19, 0xE2,
+	0x35, 0xB2, 0xF1, 0x22, 0x89, 0x00, 0xE8, 0xBC, 0x03, 0xC4, 0x6E, 0xFC, 0x3C, 0x53, 0xF5, 0xA1,
+	0xFD, 0xF8, 0x48, 0x0D, 0x06, 0x9D, 0xF7, 0x07, 0x1D, 0x7B, 0xEE, 0x20, 0x12, 0xC8, 0x86, 0x89,
+	0xB2, 0x6B, 0x16, 0xBE, 0xCE, 0xC6, 0xE1, 0xE5, 0x6B, 0x04, 0xB2, 0x63, 0x12, 0xDD, 0x6F, 0x0B,
+	0x9F, 0x84, 0xFE, 0xB0, 0xB1, 0xF9, 0x9D, 0xAF, 0xFE, 0x4C, 0x80, 0x03, 0xD3, 0xC9, 0xFD, 0xEE,
+	0xCA, 0xEC, 0x7E, 0x2B, 0xDB, 0xFA, 0x89, 0xDA, 0xA5, 0x49, 0xF0, 0xB7, 0xE8, 0x05, 0x92, 0x30,
+	0x03, 0x76, 0xAB, 0xEC, 0x14, 0xF8, 0xDA, 0x3E, 0x7D, 0xE1, 0x0A, 0x75, 0xFE, 0xEE, 0x7D, 0x1D,
+	0xC6, 0xBA, 0x2A, 0xD6, 0x21, 0x22, 0xAB, 0xAA, 0x0F, 0xA4, 0x57, 0x02, 0xC8, 0x71, 0xFF, 0xCA,
+	0xFB, 0xFF, 0x33, 0x4E, 0xF9, 0x0C, 0xFA, 0xE7, 0x5E, 0x24, 0xD8, 0x86, 0x4D, 0xE1, 0x73, 0xE3,
+	0x07, 0x86, 0xD4, 0x2E, 0x62, 0x73, 0x39, 0x00, 0x93, 0x26, 0x75, 0x93, 0x0B, 0xA8, 0x73, 0xFF,
+	0x05, 0xA0, 0x08, 0xC2, 0x26, 0x1A, 0x2B, 0x1A, 0x22, 0x3B, 0xA6, 0x19, 0xF2, 0xDB, 0x08, 0x90,
+	0xA4, 0xFD, 0xE7, 0xC0, 0xFE, 0xDF, 0xD8, 0x06, 0x73, 0x51, 0x0A, 0x2E, 0xAB, 0x01, 0xA2, 0x7A,
+	0xF6, 0x25, 0xA2, 0xFF, 0xF6, 0x5A, 0x21, 0xC8, 0x7D, 0x43, 0x77, 0xFD, 0x4B, 0xE9, 0xAC, 0x34,
+	0xCB, 0xE0, 0x0E, 0x2C, 0x8E, 0xF3, 0xA7, 0x0C, 0xEF, 0x47, 0x4B, 0xFA, 0x78, 0x3C, 0x05, 0xF8,
+	0xCA, 0x05, 0xD7, 0x85, 0xFF, 0x32, 0xBE, 0xFD, 0x99, 0xD7, 0x07, 0xEC, 0x50, 0x1A, 0x5B, 0xC3,
+	0x26, 0x53, 0x61, 0x1D, 0x4D, 0x79, 0x04, 0xE9, 0xFC, 0xF7, 0xFD, 0x32, 0x05, 0xEE, 0x9C, 0x1C,
+	0x88, 0xCB, 0x25, 0x29, 0xD8, 0x14, 0x21, 0x8D, 0xF4, 0xD0, 0xFB, 0xDA, 0xED, 0xA2, 0xD6, 0x20,
+	0x8D, 0xE4, 0x7C, 0x39, 0xF6, 0x97, 0x78, 0xFF, 0x31, 0x0F, 0x00, 0x07, 0x68, 0x01, 0xDD, 0x67,
+	0x0C, 0x92, 0x23, 0x1F, 0xDB, 0xFD, 0x26, 0xF7, 0x3A, 0x10, 0xB1, 0xF8, 0xE5, 0x01, 0x77, 0xC9,
+	0x57, 0xA0, 0xCC, 0xEB, 0x84, 0xE5, 0x6C, 0x3B, 0xFC, 0xF9, 0x13, 0xFF, 0x41, 0x4E, 0xF0, 0x02,
+	0xAB, 0xE0, 0xA3, 0xCE, 0xDE, 0x86, 0xA4, 0xEB, 0x2A, 0x96, 0xFB, 0xEF, 0x76, 0x02, 0x22, 0x1C,
+	0xFE, 0x90, 0xFC, 0xF6, 0x24, 0x43, 0xF8, 0x38, 0x02, 0x04, 0x4C, 0xDA, 0x08, 0x41, 0x3F, 0xF4,
+	0x64, 0x53, 0xCF, 0x35, 0xE0, 0xB5, 0x32, 0x01, 0xBB, 0x03, 0x96, 0xDA, 0xF2, 0x24, 0xFE, 0xA9,
+	0x67, 0x10, 0x56, 0x0E, 0x0D, 0xDA, 0x1A, 0x00, 0x4C, 0xB4, 0xF8, 0xAC, 0xA3, 0xFB, 0x3B, 0x7F,
+	0x01, 0xE4, 0x5A, 0xFF, 0xDC, 0x8F, 0xF1, 0x4D, 0xE3, 0xDF, 0xC5, 0x63, 0xDB, 0xB6, 0x6C, 0xED,
+	0xA2, 0xCD, 0x03, 0xD8, 0x01, 0x05, 0x55, 0xD9, 0xF0, 0x28, 0xC7, 0xDC, 0xC7, 0x15, 0xDE, 0x1E,
+	0x29, 0xF7, 0xA3, 0x09, 0x17, 0x69, 0x0A, 0x29, 0x6B, 0x58, 0x25, 0x27, 0x78, 0x14, 0x9C, 0x58,
+	0x05, 0xF8, 0xE7, 0xFF, 0xA2, 0x11, 0x00, 0x88, 0x96, 0xFB, 0xEF, 0xB9, 0xEC, 0xCF, 0xE7, 0xDB,
+	0x86, 0xC6, 0xDF, 0x43, 0x6A, 0x01, 0x9A, 0xBF, 0x28, 0xD3, 0x09, 0x38, 0x07, 0xB6, 0x29, 0x71,
+	0x24, 0x0F, 0xDE, 0xC5, 0xFF, 0xED, 0x72, 0x05, 0x33, 0xD3, 0x16, 0x6A, 0x67, 0x22, 0xDE, 0x2D,
+	0x1E, 0xB1, 0xDA, 0x0E, 0x87, 0x68, 0x01, 0x7B, 0xDC, 0xFE, 0xC3, 0x00, 0x05, 0xD3, 0x8A, 0x09,
+	0x90, 0x48, 0x03, 0x73, 0xE7, 0xF7, 0x58, 0xC7, 0xFC, 0x92, 0x85, 0x1A, 0x22, 0x62, 0x3D, 0xDB,
+	0x10, 0x4B, 0xC3, 0xA4, 0x39, 0x31, 0x10, 0x16, 0xA9, 0x33, 0xF8, 0x10, 0x4A, 0xEF, 0xE2, 0x53,
+	0xF8, 0xDF, 0x70, 0x04, 0x6C, 0xD2, 0x07, 0xA2, 0x9B, 0x02, 0xE7, 0xB7, 0xFE, 0xCB, 0x15, 0x05,
+	0xE8, 0x4B, 0x15, 0xE3, 0x51, 0x23, 0x3E, 0x30, 0x1E, 0x88, 0x70, 0x07, 0xE0, 0x7C, 0xF8, 0x4E,
+	0xE9, 0x01, 0x61, 0xEB, 0x18, 0x04, 0xC5, 0x25, 0xBD, 0x11, 0x1A, 0x1B, 0xFD, 0xFB, 0x01, 0xE1,
+	0xDF, 0x40, 0x5D, 0xD6, 0xCB, 0x7C, 0xE0, 0xF8, 0xED, 0xF1, 0x9C, 0x92, 0xFD, 0x26, 0x11, 0x00,
+	0xA1, 0xBB, 0x00, 0x7D, 0x14, 0x09, 0xC3, 0x51, 0x1A, 0x6B, 0xE9, 0x24, 0x1D, 0xEB, 0x13, 0xDF,
+	0xA6, 0xEC, 0xAC, 0xC1, 0xCD, 0xDF, 0xDF, 0xCB, 0xF8, 0xDA, 0xE1, 0x52, 0xB6, 0xF9, 0x59, 0x68,
+	0x00, 0xDE, 0x17, 0xF4, 0x49, 0xF9, 0xE2, 0x2E, 0xEC, 0xDC, 0xD1, 0x47, 0xE6, 0xA5, 0x24, 0xF6,
+	0xD6, 0xFE, 0xFF, 0x15, 0xDD, 0xFE, 0x66, 0x8C, 0xF8, 0xD3, 0xFE, 0xF7, 0x60, 0xF2, 0x01, 0xA5,
+	0xDB, 0x08, 0x2B, 0xEB, 0xF8, 0x18, 0x4A, 0xD6, 0x2F, 0x41, 0xBA, 0x33, 0x84, 0xB9, 0x8C, 0x66,
+	0xD4, 0xA2, 0xBC, 0xF7, 0x0A, 0x9C, 0x0D, 0xDB, 0x05, 0x0E, 0x79, 0x02, 0x02, 0xB2, 0x66, 0xF8,
+	0xB1, 0xE7, 0xF8, 0xA6, 0xCE, 0xFE, 0x1B, 0x93, 0xFF, 0x1F, 0x43, 0xF5, 0xAD, 0x96, 0xE4, 0x8D,
+	0x3C, 0xDD, 0xF8, 0x5E, 0xEB, 0xD2, 0x9A, 0x01, 0x5B, 0x4D, 0x06, 0x2A, 0xBD, 0xF4, 0x0B, 0x85,
+	0xDF, 0x1E, 0x03, 0xDC, 0xF7, 0xBB, 0xF0, 0xCC, 0x33, 0x10, 0x62, 0x04, 0x26, 0x0C, 0x3B, 0x27,
+	0x14, 0xE3, 0x18, 0x6E, 0xC1, 0x08, 0xC6, 0xDB, 0x00, 0xF4, 0xFF, 0xFF, 0xE6, 0x1E, 0xFD, 0xE0,
+	0xD6, 0xF0, 0x7A, 0x28, 0xE0, 0x8D, 0xAD, 0xDF, 0xC6, 0x36, 0xFC, 0x58, 0xCA, 0x22, 0xE2, 0xEA,
+	0x35, 0xD2, 0xF2, 0x2B, 0x99, 0xAF, 0x12, 0x11, 0xC0, 0x00, 0x8A, 0xC9, 0x02, 0x57, 0x25, 0x13,
+	0x77, 0x70, 0x21, 0x58, 0x79, 0x21, 0x4A, 0x87, 0x14, 0xBD, 0xED, 0x05, 0xDE, 0x17, 0x00, 0x52,
+	0xC8, 0x03, 0x6B, 0x95, 0x08, 0xCF, 0x8F, 0x04, 0xBB, 0x91, 0xF9, 0x21, 0x04, 0xFB, 0x88, 0x9D,
+	0x14, 0xF2, 0x09, 0x37, 0x45, 0xE8, 0x48, 0x1C, 0x34, 0x3D, 0x1B, 0xA1, 0x1C, 0xDC, 0x48, 0xFD,
+	0x63, 0x62, 0xF0, 0x37, 0x8C, 0xF6, 0xF6, 0x30, 0x03, 0x53, 0x22, 0x09, 0x38, 0xB1, 0x05, 0x77,
+	0xA4, 0x00, 0xB3, 0xA7, 0x03, 0x60, 0x09, 0x11, 0x09, 0x7F, 0x1F, 0x26, 0x12, 0x1E, 0x2C, 0xE7,
+	0x09, 0x18, 0x4F, 0xF9, 0xEE, 0x41, 0xFF, 0x67, 0xEB, 0x14, 0xFB, 0xBB, 0x24, 0x9C, 0xF6, 0x1D,
+	0x69, 0xF4, 0x02, 0x68, 0x83, 0xE5, 0x2F, 0x7A, 0xD7, 0x46, 0x60, 0xDD, 0xEA, 0xBC, 0xED, 0x81,
+	0x26, 0xFB, 0xC2, 0xC9, 0xFF, 0xAA, 0x7A, 0x00, 0x3C, 0x9A, 0x06, 0x64, 0xC7, 0x15, 0x80, 0x09,
+	0x22, 0x80, 0x29, 0x16, 0x92, 0x7A, 0xF2, 0x75, 0x46, 0xD2, 0x11, 0x0A, 0xCC, 0x09, 0xAF, 0xDE,
+	0xDE, 0xEF, 0xF6, 0x2E, 0x04, 0x01, 0xF1, 0x97, 0xF7, 0x24, 0x05, 0xE6, 0x74, 0x69, 0xDC, 0x21,
+	0xE6, 0xE1, 0xFA, 0xA5, 0xF0, 0x95, 0x9D, 0xFC, 0xE0, 0xA7, 0xFE, 0xA6, 0xD6, 0xF9, 0x7F, 0x08,
+	0xF8, 0xB7, 0x29, 0x00, 0xA9, 0x2C, 0x08, 0x0C, 0x75, 0xFC, 0xF8, 0xBE, 0xDC, 0xE2, 0x29, 0xBF,
+	0xB8, 0x61, 0xB9, 0x27, 0x63, 0xCF, 0xA6, 0x82, 0xF1, 0x28, 0x26, 0x0A, 0x45, 0x6D, 0x0E, 0xD7,
+	0xE7, 0x03, 0x6C, 0xD3, 0xF8, 0xBD, 0xB0, 0xF6, 0xE8, 0xD0, 0xFB, 0x00, 0xAC, 0xFE, 0xE2, 0xC4,
+	0xF7, 0x94, 0xE7, 0xE8, 0xA5, 0xA9, 0xDF, 0x36, 0x2A, 0xEA, 0xBB, 0x83, 0xFF, 0xEC, 0x00, 0x07,
+	0x08, 0x6E, 0xF8, 0x28, 0xAD, 0xE2, 0xFC, 0x3E, 0xDB, 0x71, 0x5B, 0xEB, 0x03, 0x6A, 0x09, 0xEC,
+	0xFF, 0x21, 0x58, 0xE6, 0x27, 0x86, 0xA1, 0x1C, 0xFE, 0x63, 0x0C, 0x4B, 0x4B, 0x02, 0xEA, 0xF6,
+	0xFF, 0xEF, 0x00, 0xFE, 0x50, 0x3C, 0xF4, 0x62, 0x6B, 0xE4, 0x1F, 0xAD, 0xE0, 0x69, 0x46, 0xF8,
+	0xD9, 0x44, 0x1D, 0x47, 0x3B, 0x33, 0x9F, 0x78, 0x2D, 0x35, 0x2B, 0x16, 0x3B, 0x48, 0x02, 0x3B,
+	0xC0, 0x00, 0xC1, 0x5F, 0x0F, 0xEC, 0x6D, 0x1F, 0xDD, 0x7E, 0x23, 0x49, 0x8C, 0x19, 0xAB, 0xD0,
+	0x0A, 0x5E, 0x48, 0x02, 0xD6, 0x46, 0x03, 0x6D, 0xA9, 0x07, 0x8B, 0x62, 0x05, 0x69, 0x62, 0xFB,
+	0x52, 0x22, 0xFA, 0x2C, 0x5B, 0x0F, 0x34, 0x0C, 0x2F, 0xF2, 0xDE, 0x41, 0x1F, 0xAB, 0x3A, 0x3B,
+	0x46, 0x1F, 0x64, 0x67, 0x02, 0xAA, 0x15, 0xF4, 0x39, 0xE4, 0xF6, 0x1C, 0x44, 0x01, 0xA7, 0xFA,
+	0x07, 0xB8, 0xE2, 0x06, 0x5B, 0xAC, 0x02, 0xAE, 0xAC, 0x02, 0xC2, 0xED, 0x09, 0x8F, 0x79, 0x13,
+	0x07, 0x0D, 0x14, 0xBC, 0x0E, 0x08, 0x87, 0x7D, 0xFC, 0x6C, 0x24, 0xFE, 0xA7, 0x74, 0x0A, 0xAA,
+	0xDC, 0x14, 0x75, 0x64, 0x13, 0xC9, 0x19, 0x06, 0x2F, 0xF9, 0xF5, 0xA7, 0xAD, 0xEC, 0x73, 0x98,
+	0xED, 0x82, 0xDA, 0xF4, 0xFC, 0x09, 0xFC, 0x4A, 0x7A, 0xFF, 0x99, 0x44, 0x00, 0xB8, 0xF2, 0x01,
+	0x96, 0x86, 0x06, 0x30, 0x18, 0x0B, 0x91, 0x59, 0x08, 0x8A, 0x2C, 0xFD, 0x79, 0xF5, 0xF1, 0xE5,
+	0xA5, 0xEE, 0x8C, 0xC6, 0xF3, 0x95, 0xDF, 0xFB, 0xF6, 0x5B, 0x00, 0xD2, 0xBE, 0xFE, 0xC1, 0x95,
+	0xF9, 0x9D, 0x8F, 0xF5, 0x9E, 0x96, 0xF5, 0xC2, 0xFA, 0xF8, 0xBD, 0xD0, 0xFC, 0xFE, 0xAF, 0xFE,
+	0x8F, 0x7E, 0xFE, 0xC4, 0x2C, 0xFE, 0x95, 0xAD, 0xFF, 0x84, 0x9F, 0x01, 0x98, 0xDA, 0xFF, 0xF2,
+	0xB9, 0xF9, 0xB0, 0x6D, 0xF3, 0x53, 0x63, 0xF1, 0x5E, 0xCF, 0xF4, 0x71, 0x23, 0xFB, 0x6A, 0x65,
+	0x00, 0x3E, 0x33, 0x02, 0xA1, 0xF9, 0x00, 0x97, 0xE1, 0xFE, 0x4B, 0xD8, 0xFD, 0xBB, 0x2D, 0xFE,
+	0x2F, 0xE0, 0xFE, 0xB8, 0xBC, 0xFE, 0x18, 0x82, 0xFD, 0x4F, 0x6A, 0xFC, 0x59, 0x4D, 0xFD, 0xD8,
+	0xB1, 0xFF, 0x7E, 0xDC, 0x00, 0x27, 0x7B, 0xFF, 0x9C, 0xE8, 0xFC, 0x3A, 0x74, 0xFB, 0xE9, 0x7B,
+	0xFC, 0x33, 0x6A, 0xFF, 0xF9, 0x6E, 0x02, 0x11, 0xED, 0x03, 0xAF, 0x86, 0x03, 0x38, 0x13, 0x02,
+	0x53, 0xB7, 0x00, 0x59, 0x07, 0x00, 0x62, 0xBE, 0xFF, 0x85, 0x35, 0xFF, 0x35, 0x3A, 0xFE, 0xDE,
+	0xD5, 0xFD, 0xAD, 0x3B, 0xFF, 0x4C, 0xBC, 0x01, 0x0B, 0x6F, 0x03, 0x5C, 0x53, 0x03, 0xF8, 0xDD,
+	0x01, 0xA4, 0x5A, 0x00, 0xB8, 0xD4, 0xFF, 0xA0, 0x6F, 0x00, 0x21, 0x7D, 0x01, 0x2C, 0x27, 0x02,
+	0x21, 0x0F, 0x02, 0xB7, 0x79, 0x01, 0x36, 0xD1, 0x00, 0xD1, 0x72, 0x00, 0x58, 0x5D, 0x00, 0x68,
+	0x3E, 0x00, 0x84, 0xE2, 0xFF, 0x17, 0xC4, 0xFF, 0x34, 0x7A, 0x00, 0xFC, 0xC1, 0x01, 0xDE, 0xC0,
+	0x02, 0x86, 0xD0, 0x02, 0xE7, 0xF0, 0x01, 0xD9, 0xB7, 0x00, 0x54, 0xD7, 0xFF, 0x30, 0xA6, 0xFF,
+	0x93, 0xFD, 0xFF, 0x37, 0x70, 0x00, 0xAB, 0xA8, 0x00, 0x3B, 0x9A, 0x00, 0x63, 0x77, 0x00, 0x51,
+	0x78, 0x00, 0x8D, 0xA1, 0x00, 0x8D, 0xA6, 0x00, 0x87, 0x4B, 0x00, 0x52, 0xE2, 0xFF, 0x6E, 0xE3,
+	0xFF, 0xF9, 0x51, 0x00, 0xFC, 0xCD, 0x00, 0xAD, 0xF0, 0x00, 0xAD, 0x9C, 0x00, 0x23, 0x06, 0x00,
+	0x07, 0x84, 0xFF, 0x6E, 0x4B, 0xFF, 0x9E, 0x63, 0xFF, 0xF6, 0xA6, 0xFF, 0xA6, 0xE5, 0xFF, 0xAB,
+	0x09, 0x00, 0x96, 0x1D, 0x00, 0xA8, 0x3A, 0x00, 0x93, 0x5B, 0x00, 0x4C, 0x49, 0x00, 0xC4, 0xE8,
+	0xFF, 0x3B, 0x78, 0xFF, 0x43, 0x47, 0xFF, 0xE0, 0x6B, 0xFF, 0xB9, 0xBE, 0xFF, 0x92, 0x01, 0x00,
+	0x5A, 0x0A, 0x00, 0xF4, 0xDC, 0xFF, 0x16, 0x9F, 0xFF, 0x42, 0x79, 0xFF, 0xC8, 0x7C, 0xFF, 0x22,
+	0x9E, 0xFF, 0x6E, 0xC4, 0xFF, 0x0A, 0xDE, 0xFF, 0x6B, 0xEB, 0xFF, 0xBC, 0xFA, 0xFF, 0x82, 0x0A,
+	0x00, 0x8D, 0xFE, 0xFF, 0x76, 0xCB, 0xFF, 0xB1, 0x8E, 0xFF, 0x8C, 0x6F, 0xFF, 0xA3, 0x7F, 0xFF,
+	0x55, 0xB2, 0xFF, 0x11, 0xE8, 0xFF, 0xE3, 0x08, 0x00, 0x78, 0x0A, 0x00, 0x75, 0xF6, 0xFF, 0x86,
+	0xDF, 0xFF, 0x1E, 0xD4, 0xFF, 0xDA, 0xD5, 0xFF, 0xA6, 0xDC, 0xFF, 0x23, 0xDF, 0xFF, 0xA5, 0xDE,
+	0xFF, 0x75, 0xE8, 0xFF, 0xD3, 0xFD, 0xFF, 0xFC, 0x09, 0x00, 0x08, 0xFE, 0xFF, 0x0C, 0xE2, 0xFF,
+	0x37, 0xCB, 0xFF, 0x86, 0xCA, 0xFF, 0x64, 0xE1, 0xFF, 0x03, 0x03, 0x00, 0xF8, 0x1D, 0x00, 0x7C,
+	0x27, 0x00, 0x11, 0x20, 0x00, 0x93, 0x10, 0x00, 0x62, 0x02, 0x00, 0xDC, 0xF9, 0xFF, 0xE4, 0xF4,
+	0xFF, 0x1F, 0xF0, 0xFF, 0x45, 0xEF, 0xFF, 0xE7, 0xFA, 0xFF, 0x0F, 0x10, 0x00, 0x38, 0x20, 0x00,
+	0x6E, 0x21, 0x00, 0x3E, 0x16, 0x00, 0x7A, 0x06, 0x00, 0xC5, 0xFC, 0xFF, 0x61, 0xFE, 0xFF, 0x12,
+	0x09, 0x00, 0x98, 0x15, 0x00, 0xEE, 0x1C, 0x00, 0x5B, 0x1C, 0x00, 0xF0, 0x15, 0x00, 0xFE, 0x0D,
+	0x00, 0xD2, 0x07, 0x00, 0x72, 0x03, 0x00, 0x79, 0xFF, 0xFF, 0x56, 0xFE, 0xFF, 0xDD, 0x04, 0x00,
+	0xBF, 0x11, 0x00, 0x78, 0x1D, 0x00, 0x28, 0x21, 0x00, 0x04, 0x1B, 0x00, 0xF5, 0x0E, 0x00, 0xA0,
+	0x03, 0x00, 0x14, 0xFE, 0xFF, 0x4A, 0xFF, 0xFF, 0x86, 0x04, 0x00, 0xAE, 0x09, 0x00, 0x1B, 0x0C,
+	0x00, 0x8D, 0x0B, 0x00, 0xAE, 0x09, 0x00, 0x11, 0x08, 0x00, 0x1F, 0x06, 0x00, 0x69, 0x02, 0x00,
+	0xB3, 0xFE, 0xFF, 0x7B, 0xFE, 0xFF, 0x8B, 0x02, 0x00, 0x39, 0x08, 0x00, 0xA3, 0x0B, 0x00, 0x7F,
+	0x0A, 0x00, 0x42, 0x05, 0x00, 0xA7, 0xFE, 0xFF, 0xC8, 0xF9, 0xFF, 0x62, 0xF8, 0xFF, 0x2B, 0xFA,
+	0xFF, 0x7E, 0xFD, 0xFF, 0x8B, 0x00, 0x00, 0x7F, 0x02, 0x00, 0x92, 0x03, 0x00, 0x05, 0x04, 0x00,
+	0xBB, 0x02, 0x00, 0xDB, 0xFE, 0xFF, 0x3D, 0xFA, 0xFF, 0xD4, 0xF7, 0xFF, 0xD7, 0xF8, 0xFF, 0x3F,
+	0xFC, 0xFF, 0xB5, 0xFF, 0xFF, 0x3C, 0x01, 0x00, 0x2F, 0x00, 0x00, 0x79, 0xFD, 0xFF, 0xBE, 0xFA,
+	0xFF, 0x55, 0xF9, 0xFF, 0xA5, 0xF9, 0xFF, 0x29, 0xFB, 0xFF, 0xFE, 0xFC, 0xFF, 0x82, 0xFE, 0xFF,
+	0xA1, 0xFF, 0xFF, 0x53, 0x00, 0x00, 0xEE, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0x57, 0xFB, 0xFF, 0x75,
+	0xF9, 0xFF, 0x5B, 0xF9, 0xFF, 0x04, 0xFB, 0xFF, 0x7D, 0xFD, 0xFF, 0x88, 0xFF, 0xFF, 0x4E, 0x00,
+	0x00, 0xC1, 0xFF, 0xFF, 0x7E, 0xFE, 0xFF, 0x4E, 0xFD, 0xFF, 0xBE, 0xFC, 0xFF, 0xDC, 0xFC, 0xFF,
+	0x5C, 0xFD, 0xFF, 0xFB, 0xFD, 0xFF, 0xD4, 0xFE, 0xFF, 0xE1, 0xFF, 0xFF, 0x7A, 0x00, 0x00, 0x0D,
+	0x00, 0x00, 0xD1, 0xFE, 0xFF, 0x95, 0xFD, 0xFF, 0x19, 0xFD, 0xFF, 0xAC, 0xFD, 0xFF, 0xFE, 0xFE,
+	0xFF, 0x69, 0x00, 0x00, 0x52, 0x01, 0x00, 0x78, 0x01, 0x00, 0xFD, 0x00, 0x00, 0x42, 0x00, 0x00,
+	0xA0, 0xFF, 0xFF, 0x3A, 0xFF, 0xFF, 0x0D, 0xFF, 0xFF, 0x26, 0xFF, 0xFF, 0xB4, 0xFF, 0xFF, 0xA4,
+	0x00, 0x00, 0x76, 0x01, 0x00, 0xB1, 0x01, 0x00, 0x43, 0x01, 0x00, 0x7D, 0x00, 0x00, 0xD5, 0xFF,
+	0xFF, 0xA7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x00, 0x46, 0x01, 0x00, 0x96, 0x01, 0x00,
+	0x82, 0x01, 0x00, 0x27, 0x01, 0x00, 0xB3, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8,
+	0xFF, 0xFF, 0x28, 0x00, 0x00, 0xB7, 0x00, 0x00, 0x4C, 0x01, 0x00, 0x96, 0x01, 0x00, 0x74, 0x01,
+	0x00, 0xFE, 0x00, 0x00, 0x72, 0x00, 0x00, 0x10, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x23, 0x00, 0x00,
+	0x6A, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xC8, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x6E,
+	0x00, 0x00, 0x2F, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0x16, 0x00, 0x00, 0x62, 0x00,
+	0x00, 0xA2, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x85, 0x00, 0x00, 0x35, 0x00, 0x00, 0xE6, 0xFF, 0xFF,
+	0xB6, 0xFF, 0xFF, 0xB3, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x45,
+	0x00, 0x00, 0x49, 0x00, 0x00, 0x34, 0x00, 0x00, 0x03, 0x00, 0x00, 0xC9, 0xFF, 0xFF, 0xA4, 0xFF,
+	0xFF, 0xA6, 0xFF, 0xFF, 0xC9, 0xFF, 0xFF, 0xF6, 0xFF, 0xFF, 0x15, 0x00, 0x00, 0x17, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xC3,
+	0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x05, 0x00, 0x00, 0xEF, 0xFF,
+	0xFF, 0xCC, 0xFF, 0xFF, 0xAD, 0xFF, 0xFF, 0xA2, 0xFF, 0xFF, 0xAE, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
+	0xEA, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xCE,
+	0xFF, 0xFF, 0xC8, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xD6, 0xFF, 0xFF, 0xE6, 0xFF, 0xFF, 0xF8, 0xFF,
+	0xFF, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xD9, 0xFF, 0xFF,
+	0xD9, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x0D,
+	0x00, 0x00, 0x05, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xEC, 0xFF,
+	0xFF, 0xF4, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x15, 0x00, 0x00, 0x12, 0x00, 0x00,
+	0x09, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x09,
+	0x00, 0x00, 0x11, 0x00, 0x00, 0x15, 0x00, 0x00, 0x13, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x0D, 0x00, 0x00,
+	0x12, 0x00, 0x00, 0x14, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x09, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0E, 0x00,
+	0x00, 0x0D, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF,
+	0xFF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB,
+	0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
+	0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x34, 0xFF, 0xFF, 0x35, 0xEE, 0xFF, 0x46, 0xC3, 0xFF, 0xBE, 0x81, 0xFF, 0x89,
+	0x3B, 0xFF, 0xF5, 0x0B, 0xFF, 0xB8, 0x0C, 0xFF, 0xAA, 0x4A, 0xFF, 0x2F, 0xB9, 0xFF, 0x4B, 0x33,
+	0x00, 0xC4, 0x7D, 0x00, 0x89, 0x5C, 0x00, 0x63, 0xA5, 0xFF, 0xDD, 0x5D, 0xFE, 0xC4, 0xD5, 0xFC,
+	0x3F, 0xA2, 0xFB, 0xE4, 0x5A, 0xFB, 0x36, 0x46, 0xFC, 0xAF, 0x20, 0xFE, 0x63, 0x3E, 0x00, 0x0F,
+	0xB9, 0x01, 0xF2, 0xDB, 0x01, 0x14, 0x5B, 0x00, 0x2F, 0x84, 0xFD, 0x00, 0x2A, 0xFA, 0x9E, 0x67,
+	0xF7, 0x1C, 0x43, 0xF6, 0x89, 0x58, 0xF7, 0xF8, 0x89, 0xFA, 0x41, 0x15, 0xFF, 0x71, 0x9C, 0x03,
+	0xEE, 0xB9, 0x06, 0xD7, 0x39, 0x07, 0x66, 0xD7, 0x04, 0x3E, 0x23, 0x00, 0xA2, 0x7D, 0xFA, 0xB9,
+	0xB9, 0xF5, 0xD6, 0x9B, 0xF3, 0xE9, 0x6F, 0xF5, 0x76, 0x84, 0xFB, 0x98, 0xEF, 0x04, 0x36, 0xE8,
+	0x0E, 0x70, 0xE9, 0x15, 0x6B, 0xFC, 0x16, 0x17, 0x79, 0x11, 0xA8, 0x27, 0x07, 0x36, 0xB6, 0xFB,
+	0x23, 0x56, 0xF3, 0xE8, 0x4F, 0xF1, 0xC3, 0xBF, 0xF6, 0x79, 0x6D, 0x02, 0xA3, 0xD7, 0x10, 0x3E,
+	0xD2, 0x1D, 0x43, 0x53, 0x25, 0xC4, 0x3E, 0x25, 0x93, 0xBA, 0x1D, 0xDF, 0x62, 0x11, 0x7C, 0x5B,
+	0x04, 0xF8, 0x06, 0xFB, 0xB1, 0xB0, 0xF8, 0x30, 0x9D, 0xFE, 0x50, 0x83, 0x0B, 0xCC, 0x59, 0x1C,
+	0xA8, 0xD5, 0x2C, 0x76, 0xDC, 0x38, 0x27, 0x09, 0x3D, 0x84, 0x4E, 0x37, 0x8A, 0x7C, 0x28, 0xEA,
+	0x54, 0x15, 0x22, 0x37, 0x05, 0x85, 0xBD, 0xFE, 0x34, 0x14, 0x05, 0xAE, 0xB3, 0x16, 0x8E, 0xCE,
+	0x2D, 0xD7, 0xE3, 0x42, 0xC2, 0xD0, 0x4E, 0xBB, 0xB7, 0x4D, 0x8C, 0x18, 0x40, 0x1B, 0x95, 0x2A,
+	0xBF, 0x67, 0x14, 0x7A, 0x96, 0x04, 0x92, 0x13, 0x00, 0x65, 0xDC, 0x07, 0x83, 0xF2, 0x18, 0x2F,
+	0x6D, 0x2D, 0xED, 0xC9, 0x3E, 0xCB, 0xA5, 0x47, 0x0E, 0x95, 0x45, 0x04, 0x91, 0x39, 0xA3, 0x12,
+	0x27, 0x0D, 0xD7, 0x12, 0x44, 0x20, 0x01, 0xEC, 0xCF, 0xF6, 0x08, 0x3E, 0xF8, 0x46, 0xC7, 0x06,
+	0xFF, 0x64, 0x1E, 0x4C, 0xD9, 0x36, 0xE0, 0x36, 0x47, 0xA1, 0x53, 0x49, 0xCF, 0x16, 0x3C, 0xE2,
+	0x2A, 0x24, 0xB9, 0x54, 0x09, 0xAF, 0x84, 0xF4, 0x28, 0xF3, 0xEB, 0xBB, 0xD0, 0xF1, 0x26, 0xF5,
+	0x02, 0x61, 0x9D, 0x18, 0xBB, 0xE8, 0x2A, 0xF9, 0xA4, 0x33, 0x76, 0x32, 0x30, 0x66, 0x49, 0x22,
+	0x21, 0x6B, 0x0E, 0x26, 0x87, 0xFA, 0x79, 0x1C, 0xEB, 0x85, 0xA3, 0xE2, 0xE7, 0x82, 0xE0, 0xF2,
+	0x3A, 0xE3, 0xC7, 0x8B, 0xEA, 0xEC, 0xD8, 0xF6, 0xB7, 0x2C, 0x05, 0xF8, 0xEC, 0x0E, 0x05, 0xEC,
+	0x0D, 0x09, 0x7E, 0x00, 0x80, 0x0A, 0xEA, 0x35, 0x28, 0xD2, 0xD5, 0xD2, 0xC0, 0xA1, 0x33, 0xBC,
+	0x59, 0x87, 0xC5, 0x5C, 0x29, 0xD9, 0xAF, 0xC6, 0xEF, 0x80, 0x7E, 0x01, 0x89, 0xB5, 0x08, 0x50,
+	0xE7, 0x03, 0x64, 0xF7, 0xF5, 0x4B, 0x52, 0xE4, 0x02, 0x29, 0xD5, 0xCA, 0xB0, 0xCC, 0x81, 0x73,
+	0xCC, 0x78, 0xE8, 0xD2, 0xF7, 0xE8, 0xDC, 0xE2, 0x69, 0xE7, 0xAF, 0xEF, 0xF0, 0x50, 0x31, 0xFA,
+	0xFA, 0xA2, 0x02, 0x75, 0x8B, 0x05, 0xEA, 0x15, 0xFD, 0x84, 0xDD, 0xE8, 0xD8, 0x4B, 0xCF, 0xDE,
+	0x38, 0xBA, 0xA3, 0x42, 0xB2, 0xE3, 0xD7, 0xBA, 0x65, 0x7F, 0xD0, 0xB2, 0x13, 0xEB, 0x5C, 0x83,
+	0x00, 0x90, 0x79, 0x09, 0x53, 0x78, 0x03, 0x58, 0x25, 0xF2, 0x6F, 0x24, 0xDD, 0xFB, 0xBA, 0xCC,
+	0xCE, 0xAB, 0xC6, 0x1B, 0x57, 0xCC, 0xA2, 0x9E, 0xDA, 0x2E, 0x51, 0xEC, 0x34, 0x3C, 0xFC, 0x8E,
+	0xCC, 0x07, 0x2E, 0x27, 0x0F, 0x98, 0xDC, 0x14, 0x20, 0xF6, 0x1A, 0x6F, 0x2E, 0x1F, 0x14, 0xD9,
+	0x1A, 0x28, 0x94, 0x0B, 0xB7, 0xDE, 0xF8, 0x07, 0xA3, 0xEE, 0xE5, 0x94, 0xF4, 0x4C, 0x29, 0x0A,
+	0x0B, 0xCC, 0x26, 0x28, 0x07, 0x3F, 0xA1, 0x8B, 0x48, 0x41, 0x94, 0x3F, 0x6B, 0xEE, 0x27, 0x0A,
+	0x5A, 0x0B, 0x19, 0xCC, 0xF4, 0x73, 0xC6, 0xEB, 0xD0, 0xA9, 0xF1, 0x8E, 0xA3, 0x01, 0x19, 0x15,
+	0x14, 0x7B, 0x98, 0x21, 0xF1, 0x9D, 0x26, 0x1A, 0xBF, 0x23, 0xDF, 0xFF, 0x1C, 0xBF, 0xC7, 0x16,
+	0x45, 0x5D, 0x13, 0x41, 0x9D, 0x11, 0x5D, 0x24, 0x0D, 0x9F, 0xD2, 0x02, 0x61, 0xDE, 0xF7, 0x7E,
+	0xA0, 0xF8, 0x9C, 0x25, 0x0C, 0x11, 0x75, 0x2D, 0x24, 0xE7, 0x4E, 0xAA, 0xCA, 0x61, 0xF5, 0xF9,
+	0x5D, 0xC1, 0xFF, 0x45, 0x59, 0xD0, 0x24, 0xED, 0xDB, 0x08, 0x0B, 0xF4, 0xFC, 0xA6, 0x4F, 0x04,
+	0x47, 0x15, 0x19, 0x63, 0x29, 0x30, 0x48, 0xFB, 0x3E, 0xC9, 0xDC, 0x3F, 0x03, 0x09, 0x34, 0x51,
+	0xE4, 0x21, 0xCB, 0xC9, 0x10, 0x54, 0x61, 0x05, 0xDF, 0x50, 0xFF, 0x5B, 0x64, 0xFA, 0xD5, 0x49,
+	0xF1, 0x50, 0x80, 0xE1, 0x22, 0x96, 0xCF, 0xB1, 0xF8, 0xC8, 0x3F, 0x60, 0xD8, 0x9F, 0x7A, 0xF7,
+	0x6C, 0xB7, 0x12, 0x6C, 0xBB, 0x18, 0xE6, 0x3B, 0x05, 0x2E, 0x97, 0xE2, 0xE7, 0xE4, 0xC1, 0xA0,
+	0xBF, 0xB3, 0x5A, 0x4F, 0xBF, 0x3B, 0x66, 0xDF, 0xD4, 0x31, 0x05, 0x52, 0xAF, 0x20, 0x69, 0xB0,
+	0x28, 0xEA, 0xFA, 0x1D, 0xDC, 0xC8, 0x09, 0xE9, 0x48, 0xF7, 0x6E, 0x83, 0xEE, 0xE3, 0x30, 0xF0,
+	0x59, 0xF1, 0xF6, 0xB5, 0x13, 0xFB, 0x2C, 0xC6, 0xF7, 0xD7, 0x00, 0xEE, 0x2D, 0xFD, 0xE3, 0xA2,
+	0x5C, 0xE2, 0xFD, 0xF2, 0xEE, 0x38, 0x27, 0x04, 0x71, 0x4D, 0x0E, 0xA9, 0xA1, 0xFC, 0x2F, 0x48,
+	0xD1, 0x03, 0xBC, 0x9F, 0x00, 0x00, 0x80, 0x50, 0x53, 0x80, 0xF8, 0x26, 0x9F, 0x15, 0xF7, 0xCB,
+	0xAE, 0x5E, 0xF1, 0xC5, 0x07, 0x00, 0x22, 0xA5, 0xF5, 0x25, 0x3E, 0xDD, 0x30, 0x5B, 0xC7, 0x25,
+	0x61, 0xC0, 0x3F, 0x4A, 0xCB, 0x15, 0xFA, 0xE0, 0xEA, 0xEE, 0xF5, 0x43, 0x86, 0x01, 0x8E, 0xBA,
+	0x02, 0x5A, 0xFF, 0xFF, 0xA4, 0xBA, 0x02, 0x5D, 0x50, 0x11, 0x42, 0x0E, 0x2B, 0xDC, 0x39, 0x47,
+	0x8A, 0x27, 0x54, 0xFC, 0x40, 0x41, 0xA8, 0xFB, 0x12, 0x0A, 0x97, 0xE4, 0xCC, 0xE4, 0xD1, 0xFE,
+	0x65, 0xE3, 0x02, 0x2B, 0x0B, 0x3E, 0xA3, 0x30, 0x16, 0x64, 0x3E, 0xE0, 0x9A, 0x2B, 0x19, 0xA4,
+	0x02, 0x06, 0xEE, 0xD8, 0x57, 0xCB, 0xC1, 0x7A, 0x38, 0xC4, 0x8F, 0x1F, 0xD9, 0x90, 0x50, 0xF1,
+	0xA4, 0xA4, 0xFF, 0x72, 0xBB, 0xFF, 0x6C, 0xC4, 0xF7, 0x13, 0x21, 0xF3, 0x1D, 0x7F, 0xFA, 0x53,
+	0x58, 0x0E, 0xBE, 0x92, 0x26, 0x43, 0x64, 0x37, 0xB3, 0xC8, 0x37, 0x15, 0xB3, 0x25, 0x6A, 0x17,
+	0x09, 0xFF, 0xFD, 0xF7, 0xED, 0x0A, 0x08, 0xEF, 0x01, 0x38, 0x04, 0x3B, 0x6F, 0xFF, 0xFF, 0x7F,
+	0xFF, 0xFF, 0x7F, 0xFF, 0x2B, 0x60, 0x6C, 0xBE, 0x2A, 0xDB, 0x1C, 0x03, 0x52, 0x23, 0xF8, 0xC6,
+	0x35, 0x06, 0x36, 0x60, 0x1C, 0x64, 0x13, 0x28, 0x4B, 0x94, 0x20, 0xDE, 0x85, 0x0A, 0x6B, 0xBA,
+	0xF3, 0x7B, 0xFB, 0xE8, 0x9D, 0xF4, 0xED, 0xAF, 0x7C, 0xFB, 0x20, 0xDF, 0x04, 0x11, 0x0A, 0x00,
+	0x8A, 0x91, 0xEB, 0x79, 0x42, 0xCF, 0xC9, 0xD7, 0xB6, 0x5D, 0x7E, 0xB0, 0xC8, 0x57, 0xC9, 0x4B,
+	0x38, 0xFE, 0x1F, 0xE3, 0x32, 0xC2, 0x03, 0x48, 0x21, 0xBC, 0x34, 0x60, 0xF7, 0x0C, 0x22, 0x48,
+	0xE9, 0x91, 0x55, 0xE0, 0x40, 0xCF, 0xF6, 0x2A, 0xE5, 0x1C, 0xCB, 0x2A, 0x3B, 0xE2, 0xCE, 0x41,
+	0x50, 0xD7, 0x30, 0xEF, 0xBE, 0x15, 0xC6, 0x48, 0x01, 0xE9, 0x59, 0xFC, 0xB5, 0x40, 0x03, 0xF9,
+	0xCC, 0x09, 0x23, 0x3E, 0x04, 0x56, 0x83, 0xEF, 0x6E, 0xFC, 0xD2, 0xAC, 0x87, 0xBB, 0x50, 0xAB,
+	0xB3, 0x5F, 0xC7, 0xBD, 0xD1, 0x8A, 0xD4, 0x4F, 0xB1, 0xEF, 0x9D, 0x4D, 0x00, 0x71, 0xA2, 0xF4,
+	0x44, 0x6A, 0xCC, 0xBC, 0x04, 0x9E, 0x1B, 0x2F, 0x85, 0x0D, 0xDE, 0x90, 0x13, 0xA0, 0xBA, 0x63,
+	0x85, 0xEB, 0x40, 0xE3, 0x0B, 0x22, 0x9E, 0x11, 0xA2, 0x72, 0x04, 0xEC, 0x84, 0xF5, 0x3D, 0x42,
+	0xF3, 0x6A, 0xE9, 0xFF, 0x14, 0xDD, 0x11, 0xC2, 0xA8, 0x1B, 0x10, 0xEA, 0x15, 0x13, 0x2E, 0x04,
+	0x9A, 0x1A, 0xF2, 0xEC, 0x8A, 0xEB, 0x97, 0xE9, 0xF4, 0xD9, 0x8D, 0x09, 0xAD, 0x46, 0x1F, 0xB6,
+	0xAE, 0x2D, 0x02, 0x92, 0x2F, 0xF7, 0xA5, 0x1E, 0x9D, 0xE9, 0xF7, 0xF6, 0xF7, 0xCB, 0x06, 0x2C,
+	0xB6, 0xCA, 0xB6, 0xC1, 0xBD, 0x06, 0xE3, 0x66, 0xC9, 0x02, 0xAF, 0x0A, 0x0E, 0x0C, 0xB0, 0x00,
+	0x0A, 0xB2, 0xE7, 0xA0, 0xDB, 0xD5, 0x0B, 0xA1, 0xD6, 0xC8, 0xD1, 0xE7, 0x21, 0xF6, 0xFC, 0x37,
+	0x45, 0x09, 0xDB, 0x91, 0x08, 0x1F, 0x47, 0x01, 0x1B, 0x8B, 0xFE, 0xF0, 0x03, 0x08, 0xE2, 0x69,
+	0x1C, 0x8E, 0xBD, 0x32, 0x62, 0xAC, 0x40, 0x1C, 0xB4, 0x40, 0xCF, 0xD3, 0x34, 0xD9, 0xA3, 0x23,
+	0xD0, 0x6D, 0x11, 0xDF, 0x83, 0x02, 0x13, 0x3F, 0x03, 0xEE, 0x27, 0x1C, 0xA3, 0x84, 0x41, 0x72,
+	0xEB, 0x5B, 0xC7, 0x86, 0x5A, 0x96, 0x79, 0x3D, 0x7F, 0x9D, 0x15, 0xB9, 0xB5, 0xF7, 0xD4, 0xC0,
+	0xEE, 0x03, 0x82, 0xF6, 0x38, 0x75, 0x01, 0xAA, 0x97, 0x03, 0x6C, 0xFB, 0xFA, 0x1E, 0xA0, 0xEF,
+	0xBE, 0x3A, 0xEC, 0x5D, 0xC2, 0xF5, 0x30, 0xC1, 0x07, 0x2C, 0xBA, 0x17, 0x08, 0x63, 0x1C, 0x1D,
+	0xA8, 0x13, 0x92, 0xA9, 0x02, 0x9B, 0xBA, 0xF1, 0x9A, 0x1A, 0xE6, 0xED, 0xA1, 0xE0, 0x23, 0x2A,
+	0xE4, 0xD1, 0xD4, 0xF9, 0xD3, 0x4D, 0x1F, 0x20, 0x80, 0x3D, 0xAC, 0x76, 0x40, 0x7B, 0x8A, 0x29,
+	0x87, 0xEC, 0x0A, 0xFA, 0x8F, 0xF8, 0xB6, 0xD1, 0xFB, 0x5D, 0x6B, 0x0D, 0x7F, 0x20, 0x1D, 0x9B,
+	0x8C, 0x1E, 0x8D, 0x32, 0x11, 0x4D, 0x32, 0xFF, 0x8E, 0x5C, 0xF4, 0x17, 0x3E, 0xF5, 0x20, 0x7C,
+	0xFC, 0x3B, 0xFC, 0xFF, 0xE9, 0xC1, 0xF8, 0x57, 0xFB, 0xE7, 0xC3, 0xBB, 0xD5, 0xC6, 0xC0, 0xCA,
+	0x67, 0x0E, 0xCB, 0x1F, 0x14, 0xD4, 0x75, 0xD8, 0xDF, 0xEF, 0x5C, 0xEB, 0x76, 0x1D, 0xF8, 0xF7,
+	0x0E, 0x00, 0xFA, 0xD2, 0xF4, 0xBD, 0x52, 0xD6, 0xFB, 0x9F, 0xB7, 0x87, 0x49, 0xAD, 0xAA, 0x0B,
+	0xBF, 0xBE, 0x12, 0xE2, 0x06, 0x2C, 0x02, 0x88, 0x99, 0x10, 0x1A, 0x0E, 0x0D, 0x4C, 0xE3, 0x02,
+	0xB7, 0xB9, 0xFE, 0x42, 0x8B, 0x04, 0xC1, 0xFA, 0x0D, 0xD7, 0xBD, 0x10, 0x6C, 0x54, 0x07, 0x76,
+	0x7C, 0xF5, 0xE6, 0x30, 0xE5, 0x12, 0x76, 0xDF, 0x40, 0x5E, 0xE6, 0x53, 0xFD, 0xF4, 0xEB, 0xE2,
+	0x03, 0x91, 0x8E, 0x0E, 0x74, 0xE0, 0x15, 0x87, 0x68, 0x1A, 0x30, 0xC5, 0x12, 0xA9, 0xAD, 0xF5,
+	0xDC, 0x55, 0xD1, 0x52, 0xD5, 0xBF, 0x5F, 0x0E, 0xCB, 0xD7, 0x29, 0xE7, 0xC2, 0x7F, 0xFF, 0x78,
+	0x0C, 0x05, 0x5E, 0x27, 0xF9, 0x17, 0xF5, 0xE9, 0xED, 0xD4, 0xE5, 0x2A, 0x97, 0xF0, 0x06, 0xFF,
+	0x01, 0x56, 0xCB, 0x0D, 0xDA, 0xB6, 0x0D, 0x07, 0xC1, 0x05, 0xEC, 0xE4, 0xFF, 0x14, 0xF0, 0x03,
+	0x56, 0xB6, 0x11, 0x4F, 0xD2, 0x21, 0xB2, 0xED, 0x2B, 0xF0, 0x43, 0x2C, 0x2A, 0x84, 0x25, 0x68,
+	0x53, 0x1D, 0x97, 0xD3, 0x16, 0x2B, 0x78, 0x0E, 0xDC, 0xEF, 0x02, 0x76, 0xED, 0x01, 0x3F, 0xD5,
+	0x16, 0x58, 0xB9, 0x36, 0x46, 0x5F, 0x4B, 0x29, 0x61, 0x45, 0x31, 0x00, 0x28, 0xB2, 0x99, 0x05,
+	0xE7, 0xD5, 0xF0, 0xD0, 0x86, 0xEF, 0xC9, 0x26, 0xF9, 0x1C, 0x0C, 0x00, 0xFC, 0x24, 0xFD, 0x8D,
+	0x76, 0xF4, 0xB4, 0x3B, 0xF0, 0xC0, 0xA9, 0xF7, 0x12, 0xD1, 0x08, 0x56, 0x55, 0x1A, 0xFC, 0x94,
+	0x22, 0x1A, 0x34, 0x1E, 0x79, 0x76, 0x11, 0xCF, 0x78, 0x03, 0x39, 0xF8, 0xF8, 0xCB, 0x35, 0xF1,
+	0x5D, 0x5D, 0xE9, 0x74, 0x77, 0xE6, 0x4A, 0x44, 0xF7, 0x2E, 0x2C, 0x1B, 0x4D, 0x76, 0x39, 0x78,
+	0x1E, 0x3D, 0xE2, 0xD7, 0x27, 0xD4, 0xA0, 0x0B, 0x43, 0x58, 0xFC, 0x60, 0xBD, 0x00, 0xA9, 0x83,
+	0x0F, 0x77, 0xD1, 0x18, 0xEF, 0x7F, 0x13, 0xE7, 0x50, 0x03, 0x1C, 0x2D, 0xF4, 0x57, 0xC4, 0xEF,
+	0xA8, 0x18, 0xF6, 0x24, 0xA1, 0xFE, 0xD2, 0xAF, 0xFF, 0x57, 0x0A, 0xF6, 0xAE, 0xC5, 0xE6, 0x53,
+	0x65, 0xDA, 0xA9, 0xB3, 0xD6, 0xD5, 0xFE, 0xDA, 0xB0, 0x3E, 0xE2, 0x76, 0xD8, 0xE7, 0x48, 0xF2,
+	0xEC, 0x30, 0xFF, 0xF6, 0x5F, 0xF7, 0xFF, 0x64, 0x72, 0xF7, 0x8A, 0x0C, 0xDC, 0x85, 0xE5, 0xBF,
+	0x15, 0x8A, 0xB7, 0x77, 0xB9, 0xC9, 0xB0, 0x03, 0xEB, 0x60, 0x78, 0x07, 0xF6, 0x08, 0x12, 0xB1,
+	0x5A, 0x0C, 0x5D, 0xA6, 0x02, 0xB5, 0x28, 0x00, 0x10, 0x94, 0x06, 0x74, 0x16, 0x0E, 0x56, 0x10,
+	0x0D, 0x2A, 0x7A, 0x00, 0x07, 0x4D, 0xEE, 0x69, 0xB3, 0xE0, 0x3B, 0xA4, 0xDE, 0xBC, 0x87, 0xE7,
+	0x05, 0x49, 0xF5, 0x97, 0x6A, 0x01, 0x22, 0xFE, 0x09, 0x00, 0x62, 0x11, 0x6D, 0x14, 0x18, 0xC7,
+	0xE3, 0x12, 0x72, 0x90, 0xF7, 0xA9, 0x08, 0xD4, 0xA6, 0x27, 0xC2, 0x7B, 0xD0, 0xCB, 0x97, 0x63,
+	0xE6, 0x61, 0x80, 0xFD, 0xBC, 0x20, 0x03, 0x94, 0x92, 0xF8, 0xC4, 0x79, 0xEB, 0x82, 0x3D, 0xE9,
+	0x6E, 0xA2, 0xF4, 0x83, 0x33, 0x05, 0xAD, 0x4C, 0x0F, 0x7B, 0xC1, 0x0D, 0xB7, 0x2A, 0x05, 0xF9,
+	0x64, 0xFF, 0x0A, 0x60, 0x03, 0x97, 0x1E, 0x10, 0x44, 0x72, 0x1E, 0xFA, 0xA8, 0x26, 0x3C, 0x3A,
+	0x26, 0x14, 0x3B, 0x20, 0x78, 0xF3, 0x19, 0x2E, 0x9E, 0x15, 0x4E, 0xAC, 0x0E, 0x76, 0x6C, 0x03,
+	0x46, 0x08, 0x01, 0xF5, 0x18, 0x13, 0x7C, 0x6C, 0x30, 0x36, 0xFC, 0x43, 0x1F, 0x3E, 0x3F, 0x57,
+	0x6B, 0x24, 0xC2, 0x6E, 0x04, 0xD4, 0xD2, 0xF0, 0x4E, 0x7C, 0xEF, 0x47, 0xAE, 0xF8, 0xCB, 0xBC,
+	0xFF, 0x05, 0x9F, 0xFD, 0xAF, 0xCD, 0xF5, 0x17, 0xC7, 0xF1, 0x81, 0x81, 0xF8, 0x48, 0x7D, 0x08,
+	0xB1, 0x25, 0x19, 0x7F, 0x57, 0x21, 0x9D, 0xC1, 0x1D, 0xB0, 0xFA, 0x11, 0x8E, 0xE1, 0x04, 0xF4,
+	0xC8, 0xFA, 0x66, 0x61, 0xF3, 0xF9, 0xE6, 0xEB, 0x78, 0x3C, 0xE9, 0x9E, 0x06, 0xF9, 0xB6, 0xC2,
+	0x1A, 0x40, 0x78, 0x37, 0xD6, 0x94, 0x3B, 0x03, 0xE3, 0x27, 0xEC, 0x3D, 0x0D, 0x41, 0xEA, 0xFD,
+	0x2E, 0xE9, 0x00, 0x47, 0xF0, 0x0D, 0x57, 0x5E, 0x16, 0x97, 0x90, 0x11, 0x7D, 0xA2, 0x02, 0x01,
+	0x86, 0xF4, 0xD8, 0x52, 0xF0, 0xCD, 0x55, 0xF6, 0x34, 0xAC, 0xFE, 0x6D, 0x42, 0x00, 0x16, 0xD7,
+	0xF7, 0xE8, 0xC1, 0xE9, 0xA3, 0x11, 0xDE, 0x4C, 0x1D, 0xDA, 0xF6, 0x97, 0xDD, 0x94, 0xE3, 0xE3,
+	0x87, 0xB0, 0xE8, 0x6F, 0x3E, 0xED, 0x76, 0xD5, 0xF6, 0xF0, 0x14, 0x00, 0xCD, 0x4C, 0xF9, 0x79,
+	0x75, 0xE0, 0xFF, 0x62, 0xC6, 0x51, 0x0C, 0xBE, 0x4B, 0x74, 0xCE, 0x2D, 0x32, 0xED, 0xC6, 0xCD,
+	0x07, 0xF1, 0xD2, 0x11, 0x68, 0x7A, 0x0C, 0x81, 0x08, 0x03, 0x0C, 0x24, 0x00, 0xD0, 0xAE, 0x05,
+	0x3E, 0x8C, 0x0C, 0xB4, 0xAB, 0x0B, 0x2B, 0x03, 0x00, 0x3B, 0xE4, 0xEE, 0xDF, 0xCC, 0xE1, 0x8C,
+	0x61, 0xDF, 0x47, 0x75, 0xE7, 0x75, 0x44, 0xF4, 0x19, 0xEA, 0xFF, 0x02, 0x33, 0x08, 0xB2, 0x6B,
+	0x0F, 0x9D, 0xC8, 0x15, 0x05, 0xD3, 0x10, 0x71, 0xDC, 0xF6, 0x53, 0x04, 0xD5, 0x24, 0x85, 0xC3,
+	0x6E, 0x39, 0xCC, 0x5D, 0x41, 0xE5, 0xDF, 0xE1, 0xFB, 0xF0, 0x3B, 0x02, 0xCB, 0x3A, 0xF9, 0x33,
+	0x5B, 0xED, 0x45, 0x33, 0xEB, 0x49, 0xC1, 0xF5, 0xD9, 0x49, 0x05, 0x7E, 0xE4, 0x0E, 0x54, 0x75,
+	0x0D, 0xCA, 0x27, 0x05, 0xAD, 0x2E, 0xFF, 0x91, 0x4B, 0x02, 0xC1, 0xF3, 0x0D, 0x39, 0x67, 0x1B,
+	0x61, 0x8D, 0x23, 0xDF, 0xA4, 0x23, 0x60, 0x7D, 0x1E, 0xE2, 0xFD, 0x18, 0xFA, 0x35, 0x15, 0xC2,
+	0xB9, 0x0E, 0xFF, 0x89, 0x03, 0x10, 0x3C, 0x00, 0x02, 0x47, 0x10, 0x36, 0x59, 0x2B, 0x4D, 0x19,
+	0x3E, 0x37, 0x38, 0x3A, 0x2F, 0x74, 0x21, 0xB8, 0x75, 0x03, 0x24, 0xD7, 0xF0, 0x5F, 0x79, 0xEF,
+	0xC0, 0x57, 0xF8, 0xC1, 0x7E, 0xFF, 0xD1, 0x0E, 0xFE, 0x1B, 0xFA, 0xF6, 0xCE, 0x30, 0xF3, 0x2E,
+	0x5D, 0xF9, 0xBB, 0x69, 0x08, 0xC9, 0x60, 0x18, 0x8D, 0x95, 0x20, 0x12, 0x92, 0x1D, 0x8B, 0xAB,
+	0x12, 0xD0, 0x1D, 0x06, 0x99, 0x5A, 0xFC, 0x80, 0x08, 0xF5, 0x47, 0xD2, 0xED, 0x47, 0x45, 0xEB,
+	0xF5, 0x6C, 0xFA, 0x97, 0xB9, 0x1A, 0x2D, 0x81, 0x36, 0xD0, 0xF0, 0x3A, 0x5C, 0x8D, 0x28, 0x60,
+	0xB1, 0x0E, 0x3B, 0x3B, 0xFF, 0x0D, 0x01, 0x01, 0xBB, 0xAF, 0x0C, 0x43, 0x92, 0x14, 0x79, 0x29,
+	0x10, 0xC5, 0x24, 0x02, 0x4D, 0xB6, 0xF4, 0x76, 0xA1, 0xF0, 0x55, 0x63, 0xF6, 0x3E, 0xB5, 0xFE,
+	0x39, 0xD4, 0x00, 0x3B, 0x55, 0xF9, 0x85, 0x33, 0xEC, 0x43, 0xD5, 0xE0, 0x7A, 0xA2, 0xDC, 0x89,
+	0x67, 0xDF, 0xB1, 0xF3, 0xE4, 0x8F, 0x2C, 0xE9, 0x3B, 0x46, 0xED, 0x80, 0xAD, 0xF6, 0xA2, 0x49,
+	0x00, 0x73, 0xEB, 0xFA, 0x0B, 0x17, 0xE4, 0x0F, 0x6D, 0xCB, 0x5B, 0x0A, 0xC3, 0xC8, 0x03, 0xD2,
+	0x9A, 0xDC, 0xEE, 0x04, 0x28, 0x08, 0x03, 0xD7, 0x11, 0x04, 0xC5, 0x0C, 0x61, 0x64, 0x03, 0xD0,
+	0x15, 0x00, 0x0F, 0xEA, 0x04, 0xCC, 0x49, 0x0B, 0x91, 0x9B, 0x0A, 0xD0, 0xA7, 0xFF, 0xCD, 0x46,
+	0xEF, 0x41, 0x71, 0xE2, 0xDA, 0xB3, 0xDF, 0x23, 0x08, 0xE7, 0x28, 0x44, 0xF3, 0x9E, 0x83, 0xFE,
+	0x47, 0xBD, 0x06, 0xA2, 0xCD, 0x0D, 0x2C, 0xFD, 0x13, 0xBE, 0x22, 0x0F, 0xFF, 0x1A, 0xF6, 0xCE,
+	0x5D, 0xD5, 0x07, 0x1C, 0xC4, 0xF3, 0xEA, 0xCB, 0x26, 0x15, 0xE4, 0x93, 0x62, 0xFA, 0x2B, 0x8E,
+	0x01, 0xAE, 0xD2, 0xF9, 0x23, 0xD3, 0xEE, 0x4B, 0xB9, 0xEC, 0x53, 0x9A, 0xF6, 0xBF, 0x63, 0x05,
+	0x00, 0xA9, 0x0E, 0xF0, 0x5A, 0x0D, 0x22, 0x2D, 0x05, 0xCE, 0xF2, 0xFE, 0x06, 0x58, 0x01, 0xCB,
+	0x11, 0x0C, 0x38, 0x03, 0x19, 0x8F, 0x23, 0x21, 0x70, 0xC6, 0x21, 0x3B, 0x4F, 0x1D, 0xE1, 0x6A,
+	0x18, 0x5C, 0x1C, 0x15, 0x63, 0xDD, 0x0E, 0x0F, 0x9A, 0x03, 0xC1, 0x6F, 0xFF, 0xD4, 0xCF, 0x0D,
+	0xBC, 0x45, 0x27, 0xC3, 0x6F, 0x39, 0x40, 0x4A, 0x36, 0x2F, 0x29, 0x1F, 0x57, 0xA2, 0x02, 0xA3,
+	0xB1, 0xF0, 0xC2, 0x40, 0xEF, 0x67, 0xF7, 0xF7, 0xB1, 0x49, 0xFF, 0x61, 0x73, 0xFE, 0x00, 0xFD,
+	0xF7, 0x82, 0x4E, 0xF4, 0x1C, 0x0B, 0xFA, 0x02, 0x65, 0x08, 0x0B, 0xEB, 0x17, 0x06, 0x35, 0x20,
+	0x6C, 0xC6, 0x1D, 0xDD, 0x73, 0x13, 0x0C, 0x5F, 0x07, 0xFD, 0xB1, 0xFD, 0x4F, 0x76, 0xF6, 0xF6,
+	0x59, 0xEF, 0xBF, 0xF0, 0xEC, 0xF8, 0xA8, 0xFB, 0x69, 0x01, 0x1B, 0x9A, 0x2E, 0x36, 0xEE, 0x0C,
+	0x3B, 0x1E, 0x71, 0x29, 0xD9, 0x31, 0x10, 0x89, 0x4E, 0x00, 0xBC, 0x07, 0x01, 0x3C, 0xAA, 0x0B,
+	0xF9, 0x1B, 0x13, 0xED, 0x11, 0x0F, 0x06, 0xBD, 0x01, 0xD8, 0xCA, 0xF4, 0xFB, 0xBF, 0xF0, 0x44,
+	0x5F, 0xF6, 0x67, 0xBE, 0xFE, 0x9E, 0x5E, 0x01, 0x44, 0xB6, 0xFA, 0x9E, 0x35, 0xEE, 0x59, 0x1A,
+	0xE3, 0xB8, 0x8C, 0xDE, 0xCE, 0xB8, 0xE0, 0x43, 0xA5, 0xE5, 0x4F, 0x61, 0xE9, 0x63, 0x2A, 0xED,
+	0x25, 0x80, 0xF6, 0x6D, 0x93, 0x00, 0x88, 0x75, 0xFC, 0xDE, 0x52, 0xE7, 0xE6, 0x90, 0xCF, 0xA0,
+	0x14, 0xC7, 0x5A, 0xCE, 0xD4, 0x8E, 0x33, 0xF0, 0xDF, 0x8D, 0x08, 0x73, 0x0D, 0x12, 0x18, 0x1E,
+	0x0D, 0x35, 0xC1, 0x03, 0x3E, 0x02, 0x00, 0x46, 0x35, 0x04, 0x15, 0x41, 0x0A, 0x18, 0xBB, 0x09,
+	0xA1, 0x59, 0xFF, 0xBA, 0x7F, 0xEF, 0xE8, 0xC8, 0xE2, 0x04, 0xA8, 0xDF, 0x11, 0x73, 0xE6, 0xA6,
+	0x27, 0xF2, 0x4E, 0x41, 0xFD, 0x97, 0x68, 0x05, 0xBC, 0x77, 0x0C, 0xD2, 0x7A, 0x12, 0x32, 0xBA,
+	0x0D, 0xE8, 0x52, 0xF5, 0xA6, 0x50, 0xD5, 0xB8, 0x0C, 0xC4, 0x9C, 0x45, 0xCB, 0xF9, 0xB0, 0xE2,
+	0x0F, 0x15, 0xF9, 0x3B, 0xFF, 0x00, 0x5D, 0x58, 0xFA, 0x18, 0x13, 0xF0, 0x01, 0xEE, 0xED, 0x5E,
+	0x48, 0xF7, 0x69, 0x83, 0x05, 0x84, 0x94, 0x0E, 0x68, 0x5A, 0x0D, 0xBE, 0x3D, 0x05, 0xE5, 0xB3,
+	0xFE, 0x0A, 0x68, 0x00, 0x37, 0x74, 0x0A, 0x93, 0xF2, 0x16, 0x69, 0x3A, 0x1F, 0x8A, 0x59, 0x20,
+	0x57, 0x7B, 0x1C, 0xF2, 0x1B, 0x18, 0xC1, 0x2C, 0x15, 0xE5, 0x17, 0x0F, 0x54, 0xA1, 0x03, 0x84,
+	0x95, 0xFE, 0xA8, 0x76, 0x0B, 0xB4, 0xC4, 0x23, 0x9A, 0x7F, 0x35, 0xF7, 0x24, 0x33, 0x33, 0x4C,
+	0x1D, 0x57, 0xE2, 0x01, 0xC8, 0x67, 0xF0, 0x42, 0xF0, 0xEE, 0x11, 0x89, 0xF7, 0x14, 0x20, 0xFF,
+	0x95, 0xD7, 0xFE, 0xD3, 0xD8, 0xF8, 0xBB, 0x42, 0xF5, 0xB9, 0x9A, 0xFA, 0x1A, 0x6E, 0x08, 0xE6,
+	0xAD, 0x17, 0xD2, 0x27, 0x20, 0x39, 0x2E, 0x1E, 0x57, 0x69, 0x14, 0x27, 0x8E, 0x08, 0x73, 0xFB,
+	0xFE, 0x4A, 0xB0, 0xF7, 0xCE, 0xB0, 0xF0, 0x3C, 0x54, 0xEE, 0xB7, 0xC6, 0xFC, 0xB1, 0x7B, 0x1B,
+	0x50, 0x5A, 0x36, 0x71, 0x8A, 0x3B, 0x42, 0xAA, 0x2A, 0x49, 0x95, 0x11, 0xD3, 0x48, 0x01, 0xCA,
+	0x02, 0x01, 0xBD, 0xBD, 0x0A, 0x78, 0xE9, 0x11, 0xC7, 0x29, 0x0E, 0x44, 0x61, 0x01, 0x70, 0xC7,
+	0xF4, 0x81, 0xC3, 0xF0, 0xE8, 0x46, 0xF6, 0xFE, 0xCB, 0xFE, 0xE1, 0xEA, 0x01, 0xC7, 0xF2, 0xFB,
+	0xB5, 0xF9, 0xEF, 0x87, 0xF9, 0xE4, 0xD5, 0x16, 0xE0, 0x6A, 0xB5, 0xE1, 0xE5, 0x16, 0xE6, 0x2E,
+	0x61, 0xE9, 0x51, 0xEE, 0xEC, 0x9F, 0x49, 0xF6, 0x96, 0xF2, 0x00, 0x17, 0x0B, 0xFE, 0x04, 0x27,
+	0xEA, 0x96, 0x39, 0xD3, 0xA2, 0x66, 0xCA, 0x6B, 0x21, 0xD7, 0x51, 0x5A, 0xF1, 0xA7, 0x01, 0x09,
+	0xE7, 0x5C, 0x12, 0x96, 0x8F, 0x0D, 0xFC, 0x13, 0x04, 0x47, 0xE8, 0xFF, 0x8D, 0x94, 0x03, 0xD9,
+	0x53, 0x09, 0x00, 0xFF, 0x08, 0x6B, 0x11, 0xFF, 0x2B, 0x98, 0xEF, 0xBC, 0xE2, 0xE2, 0x3F, 0x6A,
+	0xDF, 0xF4, 0xA9, 0xE5, 0xBB, 0x0F, 0xF1, 0xC0, 0xFD, 0xFB, 0x34, 0x39, 0x04, 0x54, 0x3E, 0x0B,
+	0x7D, 0x33, 0x11, 0xBA, 0x79, 0x0C, 0xF9, 0x80, 0xF4, 0xAB, 0xF2, 0xD4, 0xF4, 0xA0, 0xC3, 0x4A,
+	0x3C, 0xCA, 0x2C, 0x52, 0xE1, 0x8C, 0xCF, 0xF7, 0x2A, 0x8E, 0x00, 0x3D, 0xDD, 0xFA, 0xD6, 0x22,
+	0xF1, 0xE7, 0xF8, 0xEE, 0xD0, 0xDD, 0xF7, 0x84, 0xAB, 0x05, 0xC2, 0x96, 0x0E, 0x7C, 0x6D, 0x0D,
+	0xB8, 0x4C, 0x05, 0x59, 0x6E, 0xFE, 0x65, 0x86, 0xFF, 0xAC, 0xF7, 0x08, 0x72, 0x2C, 0x15, 0x82,
+	0x9B, 0x1D, 0x4D, 0x2D, 0x1F, 0x32, 0xE0, 0x1B, 0x16, 0xFB, 0x17, 0xE6, 0x5D, 0x15, 0xC9, 0x67,
+	0x0F, 0x63, 0x96, 0x03, 0x1F, 0xA1, 0xFD, 0x8A, 0x4B, 0x09, 0x08, 0x81, 0x20, 0x49, 0x28, 0x32,
+	0xEC, 0x70, 0x30, 0x9A, 0xB9, 0x1B, 0x75, 0x2F, 0x01, 0x0A, 0x0C, 0xF0, 0xC4, 0x82, 0xEE, 0xD4,
+	0x1E, 0xF7, 0x9D, 0xFB, 0xFE, 0xE0, 0x36, 0xFF, 0xA5, 0xA7, 0xF9, 0x4C, 0x14, 0xF6, 0xD9, 0x19,
+	0xFB, 0x5D, 0x82, 0x08, 0xB7, 0x97, 0x17, 0x10, 0x46, 0x20, 0xB6, 0xC9, 0x1E, 0x58, 0x64, 0x15,
+	0x6F, 0xCA, 0x09, 0xE7, 0x29, 0x00, 0x0B, 0xDC, 0xF8, 0x2D, 0xDA, 0xF1, 0xBD, 0x90, 0xEF, 0x3E,
+	0xCD, 0xFD, 0x83, 0x15, 0x1C, 0x2F, 0xCC, 0x36, 0x9C, 0x68, 0x3C, 0xB7, 0xF2, 0x2B, 0xCC, 0x06,
+	0x13, 0xF5, 0x1D, 0x02, 0xBB, 0xEF, 0x00, 0x59, 0xEC, 0x09, 0xDD, 0xD6, 0x10, 0x70, 0x64, 0x0D,
+	0x2C, 0x0C, 0x01, 0xBE, 0xB4, 0xF4, 0x77, 0xB1, 0xF0, 0xE7, 0x29, 0xF6, 0xCA, 0xDD, 0xFE, 0x06,
+	0x81, 0x02, 0x32, 0x22, 0xFD, 0x78, 0xA6, 0xF1, 0xD1, 0x9F, 0xE6, 0x59, 0x6D, 0xE1, 0x85, 0x7E,
+	0xE2, 0x37, 0x60, 0xE6, 0xF7, 0x46, 0xE9, 0x38, 0x97, 0xEC, 0x8F, 0x1C, 0xF6, 0x07, 0x69, 0x01,
+	0x30, 0x97, 0xFF, 0xD8, 0xEA, 0xEC, 0xFB, 0x6D, 0xD6, 0x16, 0x5E, 0xCD, 0x33, 0x1F, 0xD9, 0x6A,
+	0x63, 0xF2, 0x9C, 0x7E, 0x09, 0xEE, 0xC7, 0x12, 0xA1, 0x02, 0x0E, 0xBA, 0x66, 0x04, 0x96, 0xC9,
+	0xFF, 0xC4, 0xF5, 0x02, 0x1C, 0x83, 0x08, 0xCF, 0x54, 0x08, 0x19, 0xCC, 0xFE, 0x0D, 0x9B, 0xEF,
+	0x34, 0xD8, 0xE2, 0x65, 0xFC, 0xDE, 0x04, 0xD4, 0xE4, 0x0D, 0xE2, 0xEF, 0xBC, 0xCD, 0xFA, 0x99,
+	0x0D, 0x03, 0xE4, 0x25, 0x0A, 0x9C, 0x06, 0x10, 0x2F, 0x5C, 0x0B, 0xDF, 0xAD, 0xF3, 0x1F, 0x66,
+	0xD4, 0x0B, 0xE4, 0xC2, 0x52, 0x16, 0xC9, 0x4A, 0xD2, 0xDF, 0xC3, 0xAD, 0xF6, 0x37, 0x2F, 0x00,
+	0x79, 0x5B, 0xFB, 0x23, 0x1A, 0xF2, 0xB0, 0xE0, 0xEF, 0x03, 0x64, 0xF8, 0xE3, 0xD9, 0x05, 0xC1,
+	0xAA, 0x0E, 0x8D, 0x91, 0x0D, 0xB2, 0x5B, 0x05, 0xA8, 0x1F, 0xFE, 0xEC, 0xA4, 0xFE, 0xE4, 0x7F,
+	0x07, 0x6F, 0x8B, 0x13, 0x68, 0x1F, 0x1C, 0x78, 0x31, 0x1E, 0x3E, 0x66, 0x1B, 0xA5, 0xF2, 0x17,
+	0x80, 0xA9, 0x15, 0x3E, 0xB6, 0x0F, 0x2B, 0x7F, 0x03, 0xCC, 0xA0, 0xFC, 0xCA, 0x12, 0x07, 0xCF,
+	0x8E, 0x1D, 0x6C, 0x0E, 0x2F, 0x1F, 0x16, 0x2E, 0x9F, 0x4F, 0x1A, 0xD5, 0x7F, 0x00, 0xFA, 0x9B,
+	0xEF, 0x22, 0x0F, 0xEE, 0x4A, 0xAE, 0xF6, 0xEF, 0xE0, 0xFE, 0x10, 0x9B, 0xFF, 0x60, 0x63, 0xFA,
+	0x67, 0xD8, 0xF6, 0x2C, 0x8D, 0xFB, 0x3D, 0x9E, 0x08, 0xD4, 0x9B, 0x17, 0xD6, 0x8A, 0x20, 0xCD,
+	0x74, 0x1F, 0x1B, 0x79, 0x16, 0x99, 0xF8, 0x0A, 0xBC, 0x5B, 0x01, 0x01, 0xF0, 0xF9, 0xC7, 0xF7,
+	0xF2, 0x8B, 0xAD, 0xF0, 0x3A, 0xC7, 0xFE, 0x51, 0xC4, 0x1C, 0x26, 0x74, 0x37, 0x25, 0x65, 0x3D,
+	0xE3, 0x65, 0x2D, 0x51, 0x5A, 0x14, 0xA1, 0xDC, 0x02, 0x6A, 0xD2, 0x00, 0xFA, 0x23, 0x09, 0x48,
+	0xE1, 0x0F, 0x3F, 0xB1, 0x0C, 0x58, 0xB9, 0x00, 0xEE, 0x96, 0xF4, 0x1F, 0x90, 0xF0, 0xAD, 0x09,
+	0xF6, 0xF3, 0xF4, 0xFE, 0x9B, 0x17, 0x03, 0x8C, 0x58, 0xFE, 0xEF, 0x2F, 0xF3, 0x0C, 0x34, 0xE8,
+	0xFB, 0x99, 0xE2, 0x5F, 0x2E, 0xE3, 0x96, 0x93, 0xE6, 0x66, 0x16, 0xE9, 0x10, 0x3C, 0xEC, 0xEA,
+	0xEE, 0xF5, 0x83, 0xF2, 0x01, 0xAA, 0x40, 0x01, 0x79, 0x81, 0xEF, 0x2F, 0x87, 0xD9, 0xBF, 0x02,
+	0xD0, 0x77, 0xF0, 0xDA, 0x27, 0x58, 0xF3, 0xF1, 0x01, 0x0A, 0xF2, 0x39, 0x13, 0x9B, 0x81, 0x0E,
+	0x48, 0xAF, 0x04, 0xE0, 0xA3, 0xFF, 0x44, 0x60, 0x02, 0xD8, 0xB8, 0x07, 0x98, 0xBB, 0x07, 0x9A,
+	0x89, 0xFE, 0x80, 0x8F, 0xEF, 0xF3, 0xB2, 0xE2, 0xE3, 0x7D, 0xDE, 0x70, 0xE2, 0xE3, 0xC7, 0xBD,
+	0xEE, 0xB6, 0x94, 0xF9, 0x3B, 0xF5, 0x01, 0x4B, 0x10, 0x09, 0x1D, 0xF6, 0x0E, 0x3F, 0x51, 0x0A,
+	0xE2, 0xDB, 0xF2, 0x39, 0xBE, 0xD3, 0x66, 0x0A, 0xC2, 0x6B, 0xD4, 0xC7, 0x75, 0x67, 0xDE, 0x3B,
+	0x9E, 0xF5, 0x65, 0xE6, 0xFF, 0xC6, 0xDC, 0xFB, 0x3F, 0x0C, 0xF3, 0x66, 0xB6, 0xF0, 0x91, 0xE2,
+	0xF8, 0xCC, 0x0C, 0x06, 0x6E, 0xCB, 0x0E, 0x0D, 0xB8, 0x0D, 0xE1, 0x6A, 0x05, 0x76, 0xCB, 0xFD,
+	0xB3, 0xB7, 0xFD, 0xFE, 0x1E, 0x06, 0x74, 0xF0, 0x11, 0x33, 0xC8, 0x1A, 0x16, 0x47, 0x1D, 0x59,
+	0x00, 0x1B, 0xEE, 0xFA, 0x17, 0x6B, 0xFB, 0x15, 0x24, 0x0D, 0x10, 0xC7, 0x54, 0x03, 0x5D, 0x81,
+	0xFB, 0xFC, 0xEC, 0x04, 0xD3, 0x9B, 0x1A, 0x08, 0x3B, 0x2C, 0xE7, 0xDD, 0x2B, 0xE5, 0x01, 0x19,
+	0xEA, 0xD1, 0xFF, 0xB2, 0x24, 0xEF, 0xCF, 0x8D, 0xED, 0x47, 0x47, 0xF6, 0x1C, 0xCC, 0xFE, 0xFF,
+	0xFD, 0xFF, 0x18, 0x1F, 0xFB, 0x62, 0x8B, 0xF7, 0xED, 0xFA, 0xFB, 0x58, 0xC0, 0x08, 0xED, 0xAF,
+	0x17, 0xA9, 0xDE, 0x20, 0xAE, 0x38, 0x20, 0xD5, 0x86, 0x17, 0xC0, 0x32, 0x0C, 0x02, 0x7D, 0x02,
+	0x62, 0x07, 0xFB, 0xEB, 0xFF, 0xF3, 0x8D, 0xB7, 0xF1, 0x34, 0xB4, 0xFF, 0xDB, 0x7C, 0x1D, 0x52,
+	0x33, 0x38, 0xC8, 0x7D, 0x3E, 0x57, 0xCC, 0x2E, 0x34, 0xA2, 0x15, 0x27, 0x8F, 0x03, 0x04, 0xA9,
+	0x00, 0xD7, 0x56, 0x08, 0x1C, 0xF9, 0x0E, 0x74, 0x05, 0x0C, 0xFA, 0x66, 0x00, 0xF1, 0x70, 0xF4,
+	0x8E, 0x6A, 0xF0, 0x9B, 0xE5, 0xF5, 0xE0, 0x13, 0xFF, 0xDC, 0xBA, 0x03, 0x61, 0x82, 0xFF, 0x03,
+	0xBE, 0xF4, 0x08, 0xAA, 0xE9, 0x96, 0xBE, 0xE3, 0xC9, 0xCC, 0xE3, 0x7F, 0xBC, 0xE6, 0x8B, 0xE0,
+	0xE8, 0xCE, 0xD6, 0xEB, 0x80, 0xD1, 0xF5, 0xFF, 0x94, 0x02, 0x81, 0xEA, 0x02, 0x41, 0x2D, 0xF2,
+	0x6A, 0x69, 0xDC, 0x1B, 0x94, 0xD2, 0x7E, 0x9F, 0xDC, 0xE3, 0x44, 0xF4, 0xC7, 0x89, 0x0A, 0xF9,
+	0xB7, 0x13, 0xEE, 0xF8, 0x0E, 0x00, 0xF5, 0x04, 0xD2, 0x78, 0xFF, 0x97, 0xC5, 0x01, 0xF3, 0xFC,
+	0x06, 0xDC, 0x26, 0x07, 0x6D, 0x47, 0xFE, 0x9B, 0x7C, 0xEF, 0xA0, 0x81, 0xE2, 0x3A, 0xEC, 0xDD,
+	0x42, 0xF6, 0xE2, 0x63, 0x8C, 0xED, 0x90, 0x6B, 0xF8, 0xE3, 0xE0, 0x00, 0x8E, 0x0A, 0x08, 0xBA,
+	0xF0, 0x0D, 0x93, 0x56, 0x09, 0x48, 0x0E, 0xF2, 0x8C, 0x0B, 0xD3, 0x01, 0x1F, 0xC1, 0x5D, 0x77,
+	0xC6, 0xD1, 0x03, 0xDD, 0x15, 0x94, 0xF4, 0x15, 0xAF, 0xFF, 0xB3, 0x6A, 0xFC, 0xAA, 0xF0, 0xF3,
+	0xA7, 0x88, 0xF1, 0x70, 0x5B, 0xF9, 0xE1, 0x41, 0x06, 0x4D, 0xEF, 0x0E, 0x47, 0xE3, 0x0D, 0x1E,
+	0x72, 0x05, 0xFA, 0x6C, 0xFD, 0xA3, 0xCE, 0xFC, 0xAD, 0xB2, 0x04, 0x86, 0x6D, 0x10, 0x1A, 0x71,
+	0x19, 0xB8, 0x6D, 0x1C, 0x2E, 0xA0, 0x1A, 0x19, 0x08, 0x18, 0x15, 0x57, 0x16, 0x7F, 0x5A, 0x10,
+	0x1F, 0x1D, 0x03, 0xEA, 0x55, 0xFA, 0x56, 0xA6, 0x02, 0x0B, 0xCF, 0x17, 0xBC, 0x6A, 0x29, 0x0D,
+	0xCE, 0x29, 0x09, 0xC2, 0x17, 0x9F, 0x26, 0xFF, 0x2C, 0xA6, 0xEE, 0xCE, 0x10, 0xED, 0x6E, 0xDE,
+	0xF5, 0x65, 0xC0, 0xFE, 0xF4, 0x68, 0x00, 0xEB, 0xD0, 0xFB, 0x67, 0x3C, 0xF8, 0xAC, 0x61, 0xFC,
+	0xDA, 0xE1, 0x08, 0xB4, 0xCB, 0x17, 0x61, 0x3F, 0x21, 0xA8, 0xF9, 0x20, 0xE1, 0x96, 0x18, 0x00,
+	0x5E, 0x0D, 0x5C, 0x9B, 0x03, 0x33, 0x11, 0xFC, 0xCE, 0x01, 0xF5, 0xBB, 0xBB, 0xF2, 0x3E, 0x96,
+	0x00, 0x64, 0x33, 0x1E, 0x6B, 0xFD, 0x38, 0x27, 0xAD, 0x3F, 0x0A, 0x30, 0x30, 0x62, 0xEB, 0x16,
+	0x5D, 0x25, 0x04, 0x2C, 0x70, 0x00, 0xCC, 0x90, 0x07, 0x69, 0x0F, 0x0E, 0x6E, 0x62, 0x0B, 0xA7,
+	0x14, 0x00, 0x51, 0x47, 0xF4, 0xA0, 0x3F, 0xF0, 0xFB, 0xC7, 0xF5, 0xA7, 0x39, 0xFF, 0xD8, 0x5F,
+	0x04, 0xEE, 0xBA, 0x00, 0x7F, 0x39, 0xF6, 0xD7, 0x26, 0xEB, 0xF4, 0xD2, 0xE4, 0x7A, 0x6B, 0xE4,
+	0x6E, 0xE2, 0xE6, 0x5F, 0xA5, 0xE8, 0x6F, 0x78, 0xEB, 0xB6, 0xB9, 0xF5, 0x1F, 0x4A, 0x03, 0x57,
+	0xB8, 0x04, 0xAB, 0xC1, 0xF4, 0x8F, 0x59, 0xDF, 0x20, 0xFE, 0xD4, 0x9C, 0x45, 0xDE, 0xDE, 0x2B,
+	0xF5, 0x0F, 0x15, 0x0B, 0x94, 0x33, 0x14, 0xAB, 0x73, 0x0F, 0x7C, 0x2E, 0x05, 0x87, 0x45, 0xFF,
+	0xD4, 0x2F, 0x01, 0xD9, 0x3E, 0x06, 0x22, 0x9B, 0x06, 0x7E, 0x07, 0xFE, 0xB2, 0x64, 0xEF, 0xB5,
+	0x49, 0xE2, 0xBC, 0x5C, 0xDD, 0x27, 0x09, 0xE2, 0x89, 0x6A, 0xEC, 0x5A, 0x45, 0xF7, 0xAC, 0xC3,
+	0xFF, 0xFC, 0x06, 0x07, 0x69, 0xE9, 0x0C, 0xC7, 0x66, 0x08, 0x1B, 0x4A, 0xF1, 0x82, 0x57, 0xD2,
+	0xC4, 0x26, 0xC0, 0xDA, 0x2E, 0xC5, 0x4C, 0x9A, 0xDB, 0x6A, 0xAB, 0xF3, 0xB7, 0x86, 0xFF, 0xCC,
+	0xF9, 0xFC, 0x51, 0xDC, 0xF4, 0xB8, 0x50, 0xF2, 0x14, 0xD4, 0xF9, 0xC7, 0x79, 0x06, 0x45, 0x17,
+	0x0F, 0xAF, 0x09, 0x0E, 0x5A, 0x75, 0x05, 0x53, 0x08, 0xFD, 0x90, 0xD6, 0xFB, 0x78, 0x53, 0x03,
+	0x1E, 0xDE, 0x0E, 0x03, 0x29, 0x18, 0x3D, 0x8E, 0x1B, 0x9A, 0x41, 0x1A, 0x97, 0x15, 0x18, 0x1F,
+	0xAC, 0x16, 0x8D, 0xA4, 0x10, 0x63, 0xCF, 0x02, 0xF1, 0x09, 0xF9, 0x7A, 0x68, 0x00, 0xEE, 0xE5,
+	0x14, 0x0F, 0xBC, 0x26, 0x3C, 0xBC, 0x27, 0x10, 0x8B, 0x16, 0xA0, 0x7B, 0xFE, 0x04, 0x2A, 0xEE,
+	0xD6, 0x91, 0xEC, 0xB6, 0x83, 0xF5, 0xD9, 0xBB, 0xFE, 0x62, 0xD4, 0x00, 0xE7, 0x81, 0xFC, 0x5F,
+	0xE4, 0xF8, 0x02, 0xC6, 0xFC, 0xC9, 0x05, 0x09, 0x87, 0xEA, 0x17, 0x9A, 0x9E, 0x21, 0x99, 0xB9,
+	0x21, 0x5F, 0xAE, 0x19, 0x2B, 0x85, 0x0E, 0xC3, 0xC2, 0x04, 0x5F, 0x1A, 0xFD, 0x90, 0x0B, 0xF6,
+	0x70, 0xB2, 0xF3, 0x41, 0x6C, 0x01, 0x52, 0xE2, 0x1E, 0x5B, 0xC4, 0x39, 0x72, 0xC8, 0x40, 0x14,
+	0x9A, 0x31, 0xEA, 0x10, 0x18, 0x38, 0xB0, 0x04, 0xE3, 0x2C, 0x00, 0x9C, 0xBD, 0x06, 0x4F, 0x2F,
+	0x0D, 0x6F, 0xBF, 0x0A, 0x2E, 0xC4, 0xFF, 0x4A, 0x1E, 0xF4, 0x26, 0x19, 0xF0, 0x26, 0xAC, 0xF5,
+	0x53, 0x67, 0xFF, 0xA1, 0x11, 0x05, 0x9F, 0xEB, 0x01, 0x38, 0xC5, 0xF7, 0xE3, 0x94, 0xEC, 0xC7,
+	0xF0, 0xE5, 0x8F, 0x05, 0xE5, 0xCA, 0x09, 0xE7, 0x2C, 0x6D, 0xE8, 0xF6, 0x17, 0xEB, 0x93, 0xB2,
+	0xF5, 0xC7, 0x15, 0x04, 0xB7, 0x87, 0x06, 0xCC, 0x7A, 0xF7, 0x05, 0x2B, 0xE2, 0xDD, 0x6E, 0xD7,
+	0x2D, 0xD4, 0xDF, 0xAF, 0x05, 0xF6, 0x37, 0x96, 0x0B, 0xB5, 0xAD, 0x14, 0xE7, 0xE3, 0x0F, 0x31,
+	0x64, 0x05, 0xA1, 0x0F, 0xFF, 0x5A, 0x97, 0x00, 0x1E, 0x88, 0x05, 0x14, 0x15, 0x06, 0x52, 0xD1,
+	0xFD, 0xED, 0x58, 0xEF, 0x5E, 0x1C, 0xE2, 0xB3, 0xD2, 0xDC, 0x39, 0x13, 0xE1, 0x59, 0x46, 0xEB,
+	0xB3, 0x11, 0xF6, 0x7B, 0xB1, 0xFE, 0x32, 0xFB, 0x05, 0xB9, 0xEF, 0x0B, 0x19, 0x7E, 0x07, 0xBC,
+	0x8F, 0xF0, 0xCC, 0xAE, 0xD1, 0x70, 0x3D, 0xBF, 0x67, 0xDC, 0xC3, 0x0C, 0x4B, 0xDA, 0xB5, 0xC0,
+	0xF2, 0x95, 0x6D, 0xFF, 0xAC, 0x9B, 0xFD, 0x8E, 0xC3, 0xF5, 0x28, 0x16, 0xF3, 0xD1, 0x35, 0xFA,
+	0xEE, 0x95, 0x06, 0x00, 0x28, 0x0F, 0x8F, 0x29, 0x0E, 0x3D, 0x78, 0x05, 0xC8, 0xA6, 0xFC, 0x86,
+	0xE8, 0xFA, 0x45, 0xE1, 0x01, 0xAA, 0x5A, 0x0D, 0xD2, 0xDB, 0x16, 0x4E, 0xCC, 0x1A, 0x55, 0xFE,
+	0x19, 0x3B, 0x3C, 0x18, 0x99, 0x0F, 0x17, 0x86, 0xE1, 0x10, 0xCE, 0x70, 0x02, 0x3A, 0xB3, 0xF7,
+	0x02, 0x04, 0xFE, 0xB1, 0x14, 0x12, 0xCB, 0xFF, 0x23, 0x71, 0xD6, 0x25, 0xE3, 0x7D, 0x15, 0x21,
+	0xFF, 0xFD, 0x89, 0xCC, 0xED, 0xE5, 0x1F, 0xEC, 0x11, 0x1F, 0xF5, 0x3E, 0xAD, 0xFE, 0x4A, 0x3E,
+	0x01, 0xA6, 0x3F, 0xFD, 0xBE, 0x89, 0xF9, 0x53, 0x12, 0xFD, 0xD1, 0xF9, 0x08, 0xAB, 0xD2, 0x17,
+	0x84, 0xDB, 0x21, 0x7C, 0x7D, 0x22, 0xAA, 0xCE, 0x1A, 0x94, 0xD0, 0x0F, 0xE3, 0xE9, 0x05, 0x83,
+	0x2B, 0xFE, 0xD4, 0x05, 0xF7, 0xEA, 0xAC, 0xF4, 0xF5, 0x3C, 0x02, 0xAE, 0x7F, 0x1F, 0x24, 0x78,
+	0x3A, 0xB8, 0xE5, 0x41, 0x6D, 0xF5, 0x32, 0x75, 0x51, 0x19, 0xB0, 0x36, 0x05, 0xA9, 0xDA, 0xFF,
+	0x6E, 0xE3, 0x05, 0xA5, 0x4B, 0x0C, 0x20, 0x4A, 0x0A, 0x30, 0xBC, 0xFF, 0x2C, 0x3D, 0xF4, 0x2E,
+	0x17, 0xF0, 0x92, 0x8D, 0xF5, 0xBE, 0x74, 0xFF, 0x05, 0xA3, 0x05, 0x19, 0x25, 0x03, 0x7D, 0x4B,
+	0xF9, 0x2A, 0x0C, 0xEE, 0x1A, 0xDA, 0xE6, 0x93, 0x5A, 0xE5, 0x33, 0xE3, 0xE6, 0x23, 0x07, 0xE8,
+	0x52, 0xBE, 0xEA, 0x2C, 0xC2, 0xF5, 0xD7, 0xF8, 0x04, 0x62, 0x7B, 0x08, 0xD0, 0x24, 0xFA, 0x8F,
+	0x19, 0xE5, 0x11, 0xB2, 0xD9, 0x02, 0x25, 0xE1, 0x2D, 0x8B, 0xF6, 0x52, 0xCF, 0x0B, 0x65, 0x05,
+	0x15, 0x32, 0x63, 0x10, 0x7C, 0xC0, 0x05, 0xDF, 0xEF, 0xFE, 0xC7, 0xF6, 0xFF, 0x85, 0xCB, 0x04,
+	0xDB, 0xA2, 0x05, 0xE3, 0xDF, 0xFD, 0x06, 0xAF, 0xEF, 0x7F, 0x3E, 0xE2, 0x72, 0x60, 0xDC, 0x5F,
+	0x0D, 0xE0, 0x28, 0xE5, 0xE9, 0x6A, 0xC5, 0xF4, 0xD1, 0x8B, 0xFD, 0x7E, 0xFE, 0x04, 0x06, 0xEA,
+	0x0A, 0xCB, 0x90, 0x06, 0x1F, 0xE1, 0xEF, 0x71, 0x1F, 0xD1, 0xDC, 0x69, 0xBE, 0x70, 0xA1, 0xC2,
+	0x9B, 0xDB, 0xD8, 0xD3, 0xCE, 0xF1, 0x41, 0x50, 0xFF, 0x4E, 0x45, 0xFE, 0xCB, 0xB9, 0xF6, 0x9B,
+	0xB3, 0xF3, 0x1D, 0x49, 0xFA, 0x6E, 0x52, 0x06, 0x21, 0xF7, 0x0E, 0xDB, 0x3E, 0x0E, 0x03, 0xA6,
+	0x05, 0x3F, 0x7A, 0xFC, 0xE3, 0x0A, 0xFA, 0x88, 0x79, 0x00, 0xDD, 0xC2, 0x0B, 0xF7, 0xB7, 0x15,
+	0xF8, 0x47, 0x1A, 0x33, 0x14, 0x1A, 0x85, 0x9E, 0x18, 0xD2, 0x76, 0x17, 0xA1, 0x04, 0x11, 0x36,
+	0xEE, 0x01, 0x8D, 0x3F, 0xF6, 0x36, 0xA8, 0xFB, 0x59, 0x39, 0x0F, 0xE1, 0x62, 0x21, 0x4C, 0x19,
+	0x24, 0xBF, 0xBE, 0x14, 0x7D, 0xD2, 0xFD, 0xD0, 0x9C, 0xED, 0x7D, 0xA9, 0xEB, 0xDC, 0x8C, 0xF4,
+	0x6E, 0x76, 0xFE, 0xB7, 0x9D, 0x01, 0x24, 0xFA, 0xFD, 0x60, 0x2A, 0xFA, 0x7C, 0x28, 0xFD, 0xFB,
+	0x8F, 0x08, 0xCA, 0x5E, 0x17, 0x39, 0xE5, 0x21, 0x01, 0x41, 0x23, 0x04, 0x2A, 0x1C, 0xE6, 0x42,
+	0x11, 0x5A, 0x36, 0x07, 0x7B, 0x35, 0xFF, 0x84, 0x0E, 0xF8, 0xBC, 0xAF, 0xF5, 0x4C, 0x13, 0x03,
+	0x13, 0x0F, 0x20, 0x1D, 0x0B, 0x3B, 0xE0, 0xDD, 0x42, 0xA7, 0x5E, 0x34, 0x2D, 0x91, 0x1A, 0xB1,
+	0xD0, 0x05, 0x3D, 0x88, 0xFF, 0xB3, 0xF7, 0x04, 0x73, 0x7D, 0x0B, 0xDD, 0x05, 0x0A, 0xE8, 0x04,
+	0x00, 0xD3, 0xA3, 0xF4, 0x3F, 0x31, 0xF0, 0xDD, 0x51, 0xF5, 0x51, 0x4D, 0xFF, 0x65, 0x0F, 0x06,
+	0xB2, 0x45, 0x04, 0xC8, 0xE6, 0xFA, 0xC5, 0x6D, 0xEF, 0xFE, 0xA6, 0xE7, 0xA1, 0x69, 0xE5, 0x10,
+	0x86, 0xE6, 0x87, 0x91, 0xE7, 0xE4, 0x7D, 0xEA, 0x0A, 0xFE, 0xF5, 0x91, 0xF7, 0x05, 0x62, 0x6D,
+	0x0A, 0xA1, 0xDB, 0xFC, 0x1E, 0xF3, 0xE7, 0xFE, 0xE7, 0xDB, 0xB5, 0x52, 0xE2, 0xE3, 0xD0, 0xF6,
+	0xED, 0xD3, 0x0B, 0x2B, 0x4F, 0x15, 0xD2, 0x02, 0x11, 0x43, 0x44, 0x06, 0x98, 0xEC, 0xFE, 0x24,
+	0x63, 0xFF, 0xCC, 0x09, 0x04, 0x54, 0x4E, 0x05, 0xC6, 0x2E, 0xFE, 0x25, 0x56, 0xF0, 0x45, 0xA4,
+	0xE2, 0x30, 0x06, 0xDC, 0xAB, 0xE2, 0xDE, 0xD9, 0x5D, 0xE8, 0x03, 0x46, 0xF3, 0x91, 0x61, 0xFC,
+	0xEF, 0xF2, 0x03, 0xEF, 0xE2, 0x09, 0xD0, 0x95, 0x05, 0x0A, 0x37, 0xEF, 0x72, 0xB1, 0xD0, 0x90,
+	0xBE, 0xBD, 0x48, 0x6C, 0xC1, 0x8D, 0x78, 0xD7, 0xBA, 0xC1, 0xF0, 0xFC, 0x2C, 0xFF, 0x18, 0xFB,
+	0xFE, 0xD9, 0xA7, 0xF7, 0xB5, 0x3D, 0xF4, 0x3E, 0x20, 0xFA, 0xFD, 0xC7, 0x05, 0x6E, 0x97, 0x0E,
+	0x3A, 0x57, 0x0E, 0x0B, 0xFB, 0x05, 0xD5, 0x7E, 0xFC, 0x36, 0x55, 0xF9, 0x83, 0x07, 0xFF, 0xB2,
+	0x36, 0x0A, 0x8F, 0x94, 0x14, 0x11, 0xF7, 0x19, 0xF9, 0x61, 0x1A, 0x46, 0x25, 0x19, 0xD6, 0xD9,
+	0x17, 0x0E, 0x00, 0x11, 0x5E, 0x4A, 0x01, 0xD4, 0xBC, 0xF4, 0x14, 0x40, 0xF9, 0x27, 0x35, 0x0C,
+	0x26, 0xC5, 0x1E, 0x0E, 0x65, 0x22, 0x0E, 0x32, 0x14, 0xAA, 0xDE, 0xFD, 0xB7, 0x8F, 0xED, 0x27,
+	0x27, 0xEB, 0xAD, 0xD9, 0xF3, 0x0F, 0x15, 0xFE, 0xC0, 0xE3, 0x01, 0xBA, 0xB8, 0xFE, 0xA3, 0xBD,
+	0xFA, 0x3B, 0x1B, 0xFD, 0x27, 0xE4, 0x07, 0x6B, 0x9D, 0x16, 0x0D, 0xBF, 0x21, 0x40, 0x0B, 0x24,
+	0x40, 0xA1, 0x1D, 0x46, 0xF0, 0x12, 0xE0, 0x95, 0x08, 0x10, 0x54, 0x00, 0x42, 0x10, 0xF9, 0x41,
+	0xBD, 0xF6, 0x54, 0xE4, 0x03, 0x62, 0x7F, 0x20, 0x73, 0x7A, 0x3B, 0xD1, 0xC4, 0x43, 0x36, 0xB5,
+	0x35, 0x22, 0xF0, 0x1B, 0xAC, 0x74, 0x06, 0xE8, 0x35, 0xFF, 0xAE, 0x10, 0x04, 0xBE, 0xAF, 0x0A,
+	0x97, 0xEC, 0x09, 0x92, 0x8C, 0x00, 0x80, 0x44, 0xF5, 0x0D, 0x61, 0xF0, 0xDD, 0x01, 0xF5, 0x6E,
+	0xF2, 0xFE, 0x89, 0x47, 0x06, 0xEB, 0x5D, 0x05, 0xA1, 0x74, 0xFC, 0xFD, 0xD0, 0xF0, 0xED, 0x53,
+	0xE8, 0x39, 0x4C, 0xE5, 0x0F, 0xF9, 0xE5, 0x00, 0x09, 0xE7, 0xF6, 0x4A, 0xEA, 0x9F, 0x5A, 0xF6,
+	0x61, 0x14, 0x07, 0x87, 0x6E, 0x0C, 0x34, 0xB9, 0xFF, 0xCB, 0xD1, 0xEA, 0x5B, 0x29, 0xDE, 0xE3,
+	0x56, 0xE3, 0x23, 0xE8, 0xF6, 0xCF, 0xB0, 0x0B, 0x0C, 0x93, 0x15, 0x6C, 0xB7, 0x11, 0x31, 0xF7,
+	0x06, 0x35, 0x0D, 0xFF, 0xA0, 0xD6, 0xFE, 0x5A, 0x51, 0x03, 0x1D, 0x06, 0x05, 0xD0, 0xAA, 0xFE,
+	0x09, 0x44, 0xF1, 0xED, 0x45, 0xE3, 0xF3, 0xC2, 0xDB, 0x03, 0xAF, 0xDD, 0x33, 0x9F, 0xE6, 0x8E,
+	0xA8, 0xF1, 0x30, 0x16, 0xFB, 0x42, 0xED, 0x02, 0x4D, 0xD2, 0x08, 0x26, 0xA0, 0x04, 0x71, 0xA0,
+	0xEE, 0xBD, 0x5A, 0xD0, 0x03, 0x2B, 0xBD, 0xB6, 0x4F, 0xC0, 0xB2, 0xFD, 0xD5, 0x59, 0xAE, 0xEF,
+	0x87, 0xFC, 0xFE, 0xCD, 0xA9, 0xFF, 0x8A, 0x9F, 0xF8, 0xF0, 0xAE, 0xF4, 0x37, 0xCD, 0xF9, 0xAB,
+	0x06, 0x05, 0xBE, 0x10, 0x0E, 0x46, 0x6D, 0x0E, 0xC8, 0x77, 0x06, 0x81, 0xB9, 0xFC, 0x5C, 0xC4,
+	0xF8, 0x4A, 0xAD, 0xFD, 0x37, 0xA4, 0x08, 0xED, 0x7F, 0x13, 0xBC, 0xBE, 0x19, 0xA2, 0xD3, 0x1A,
+	0xAC, 0xCD, 0x19, 0x3F, 0x42, 0x18, 0x78, 0xE3, 0x10, 0x1D, 0x8A, 0x00, 0xEE, 0x29, 0xF3, 0xD6,
+	0xB3, 0xF6, 0x10, 0x47, 0x09, 0x6C, 0x0D, 0x1C, 0x9F, 0xD0, 0x20, 0x49, 0xC3, 0x13, 0xEF, 0x11,
+	0xFE, 0x94, 0x97, 0xED, 0x83, 0x9F, 0xEA, 0xE8, 0xFC, 0xF2, 0x44, 0x8B, 0xFD, 0x31, 0x13, 0x02,
+	0x7B, 0x69, 0xFF, 0xA7, 0x52, 0xFB, 0x68, 0xF5, 0xFC, 0xAE, 0x03, 0x07, 0xD5, 0x9F, 0x15, 0xF5,
+	0x69, 0x21, 0x97, 0xC6, 0x24, 0xDD, 0x3E, 0x1F, 0xA6, 0xBE, 0x14, 0x2E, 0x24, 0x0A, 0xD1, 0x75,
+	0x01, 0x5D, 0x1D, 0xFA, 0x40, 0xC2, 0xF7, 0xD2, 0xAA, 0x04, 0xB6, 0xE0, 0x20, 0x1B, 0xCE, 0x3B,
+	0xAC, 0x90, 0x44, 0xEA, 0x17, 0x37, 0x20, 0x4E, 0x1D, 0xC7, 0x2F, 0x07, 0x30, 0xEE, 0xFE, 0x44,
+	0x1F, 0x03, 0xD2, 0xEE, 0x09, 0xE6, 0xE6, 0x09, 0xA3, 0x40, 0x01, 0x01, 0x13, 0xF6, 0xC6, 0xA7,
+	0xF0, 0x67, 0xA1, 0xF4, 0xB4, 0x6A, 0xFE, 0xE8, 0x4F, 0x06, 0xAB, 0x4F, 0x06, 0x38, 0x02, 0xFE,
+	0xB2, 0x4D, 0xF2, 0x49, 0xFD, 0xE8, 0xE1, 0x1C, 0xE5, 0x02, 0x47, 0xE5, 0xE5, 0x69, 0xE6, 0x73,
+	0x22, 0xEA, 0xE8, 0xCA, 0xF6, 0xE8, 0x40, 0x08, 0xE3, 0x8E, 0x0E, 0x47, 0x84, 0x02, 0xD1, 0xD2,
+	0xED, 0x47, 0x4E, 0xE0, 0x26, 0x4B, 0xE4, 0xED, 0xD7, 0xF6, 0xA5, 0x6D, 0x0B, 0x71, 0xCE, 0x15,
+	0xE4, 0x8A, 0x12, 0x85, 0xD2, 0x07, 0xAB, 0x53, 0xFF, 0x1A, 0x62, 0xFE, 0xB1, 0x94, 0x02, 0x30,
+	0xC9, 0x04, 0xA7, 0x46, 0xFF, 0x8B, 0x66, 0xF2, 0xE5, 0x24, 0xE4, 0x23, 0xA5, 0xDB, 0x3B, 0x6E,
+	0xDC, 0xEA, 0xC6, 0xE4, 0x30, 0xD3, 0xEF, 0x30, 0xBA, 0xF9, 0x8E, 0xD5, 0x01, 0x37, 0xD0, 0x07,
+	0x29, 0xB5, 0x03, 0xA0, 0x19, 0xEE, 0x32, 0x21, 0xD0, 0xCF, 0xAC, 0xBC, 0x0F, 0x2D, 0xBF, 0xDE,
+	0x86, 0xD4, 0x8F, 0x7C, 0xEE, 0x4E, 0xBF, 0xFE, 0x06, 0x5C, 0x00, 0xC5, 0x8D, 0xF9, 0xAC, 0x14,
+	0xF5, 0x79, 0x58, 0xF9, 0x2C, 0x19, 0x04, 0xE8, 0x67, 0x0D, 0x7C, 0x80, 0x0E, 0x38, 0x13, 0x07,
+	0x08, 0x27, 0xFD, 0xF1, 0x55, 0xF8, 0x9A, 0x62, 0xFC, 0xB7, 0xF9, 0x06, 0x77, 0x61, 0x12, 0x38,
+	0x83, 0x19, 0x0D, 0x67, 0x1B, 0xAB, 0x94, 0x1A, 0x24, 0xB5, 0x18, 0x22, 0xBF, 0x10, 0x0E, 0xB4,
+	0xFF, 0x44, 0x79, 0xF1, 0x24, 0x33, 0xF4, 0x0F, 0x33, 0x06, 0xF1, 0x70, 0x19, 0xD1, 0x38, 0x1F,
+	0x8A, 0x72, 0x13, 0xD0, 0x60, 0xFE, 0x9A, 0xAD, 0xED, 0x2A, 0x07, 0xEA, 0x97, 0x00, 0xF2, 0x6F,
+	0xD4, 0xFC, 0xC3, 0x20, 0x02, 0xB2, 0x16, 0x00, 0xE9, 0xE0, 0xFB, 0x24, 0xC5, 0xFC, 0x73, 0x00,
+	0x06, 0xD9, 0x67, 0x14, 0x1E, 0xE3, 0x20, 0x17, 0x73, 0x25, 0x18, 0xE5, 0x20, 0x4F, 0xC2, 0x16,
+	0x23, 0xCE, 0x0B, 0x93, 0xB6, 0x02, 0xF4, 0x1E, 0xFB, 0xF5, 0xBF, 0xF8, 0x6B, 0x5F, 0x05, 0xBC,
+	0x25, 0x21, 0xCF, 0x11, 0x3C, 0x2E, 0x5A, 0x45, 0xC1, 0x72, 0x38, 0xD9, 0xCA, 0x1E, 0x53, 0xF6,
+	0x07, 0xEE, 0xAF, 0xFE, 0xC2, 0x37, 0x02, 0xFF, 0x2F, 0x09, 0xFD, 0xF5, 0x09, 0x03, 0x16, 0x02,
+	0xDB, 0x07, 0xF7, 0x09, 0x02, 0xF1, 0x96, 0x31, 0xF4, 0x63, 0xB8, 0xFD, 0x44, 0x2A, 0x06, 0xE9,
+	0x20, 0x07, 0x14, 0x9B, 0xFF, 0x4B, 0xC8, 0xF3, 0x85, 0xBD, 0xE9, 0x71, 0xD9, 0xE4, 0xD6, 0x7A,
+	0xE4, 0x5F, 0xB0, 0xE5, 0xAE, 0xF2, 0xE9, 0xC4, 0x4D, 0xF7, 0xB9, 0x86, 0x09, 0x57, 0xAD, 0x10,
+	0x3C, 0x76, 0x05, 0x47, 0xBA, 0xF0, 0x2F, 0x85, 0xE2, 0xAA, 0x26, 0xE5, 0xDF, 0xB3, 0xF6, 0x85,
+	0x19, 0x0B, 0x8A, 0x0C, 0x16, 0x6E, 0x72, 0x13, 0xDF, 0xDA, 0x08, 0x53, 0xC2, 0xFF, 0x5C, 0xFE,
+	0xFD, 0x41, 0xE2, 0x01, 0x62, 0x88, 0x04, 0x19, 0xF3, 0xFF, 0xC3, 0xB5, 0xF3, 0x8E, 0x37, 0xE5,
+	0x04, 0xAE, 0xDB, 0xAD, 0x3B, 0xDB, 0x6C, 0xC7, 0xE2, 0x88, 0xDE, 0xED, 0xEF, 0x30, 0xF8, 0x10,
+	0xBF, 0x00, 0x4C, 0xCE, 0x06, 0x3D, 0xDF, 0x02, 0x1C, 0xAF, 0xED, 0x6A, 0xF6, 0xCF, 0x8B, 0x3A,
+	0xBC, 0xBB, 0x14, 0xBE, 0x49, 0x02, 0xD3, 0x36, 0x42, 0xED, 0xC2, 0x72, 0xFE, 0x73, 0x02, 0x01,
+	0x4D, 0x7D, 0xFA, 0xB9, 0x7D, 0xF5, 0x7E, 0xCF, 0xF8, 0x55, 0x09, 0x03, 0x64, 0xA0, 0x0C, 0x17,
+	0x8E, 0x0E, 0xDB, 0xC8, 0x07, 0x03, 0xC4, 0xFD, 0xA2, 0x1D, 0xF8, 0x2A, 0x20, 0xFB, 0xA8, 0x58,
+	0x05, 0xA9, 0x20, 0x11, 0xC7, 0x4B, 0x19, 0x46, 0x05, 0x1C, 0x98, 0x7C, 0x1B, 0x6C, 0x3F, 0x19,
+	0x68, 0x98, 0x10, 0xF5, 0xD1, 0xFE, 0x79, 0xC5, 0xEF, 0x63, 0x8D, 0xF1, 0xD0, 0x35, 0x03, 0x46,
+	0xB8, 0x16, 0xDB, 0xBB, 0x1D, 0x54, 0x30, 0x13, 0x38, 0xC5, 0xFE, 0x89, 0xCC, 0xED, 0x0D, 0x64,
+	0xE9, 0x8C, 0xDA, 0xF0, 0xFA, 0xF1, 0xFB, 0x7D, 0x0E, 0x02, 0x48, 0xB0, 0x00, 0xF9, 0x76, 0xFC,
+	0x93, 0x8F, 0xFC, 0x24, 0xE1, 0x04, 0xC2, 0x01, 0x13, 0xCC, 0x25, 0x20, 0x7B, 0xFC, 0x25, 0xD3,
+	0x9B, 0x22, 0xF3, 0xDF, 0x18, 0x96, 0xAF, 0x0D, 0x91, 0x04, 0x04, 0x64, 0x2A, 0xFC, 0xAE, 0xA4,
+	0xF9, 0x83, 0xF7, 0x05, 0x7D, 0x5B, 0x21, 0xBF, 0x4A, 0x3C, 0x15, 0x1F, 0x46, 0xC1, 0xDA, 0x39,
+	0x2D, 0x4E, 0x20, 0x18, 0xD0, 0x08, 0x58, 0x79, 0xFE, 0x01, 0x51, 0x01, 0xC3, 0x66, 0x08, 0x0B,
+	0x0E, 0x0A, 0xCD, 0x02, 0x03, 0x1F, 0x1B, 0xF8, 0xDE, 0x6F, 0xF1, 0x03, 0xBB, 0xF3, 0x1C, 0xDE,
+	0xFC, 0x6E, 0xCC, 0x05, 0xCD, 0xD5, 0x07, 0xC6, 0x1B, 0x01, 0x21, 0x64, 0xF5, 0xC8, 0x83, 0xEA,
+	0x29, 0xA0, 0xE4, 0xE0, 0x92, 0xE3, 0x23, 0xD8, 0xE4, 0x09, 0xB4, 0xE9, 0xEE, 0xCF, 0xF7, 0xC1,
+	0xD4, 0x0A, 0xAF, 0xED, 0x12, 0x7F, 0x57, 0x08, 0x56, 0xC5, 0xF3, 0xD4, 0xA1, 0xE4, 0x28, 0x01,
+	0xE6, 0x91, 0x7D, 0xF6, 0x8E, 0xB9, 0x0A, 0x01, 0x4E, 0x16, 0x99, 0x79, 0x14, 0x6C, 0x0A, 0x0A,
+	0x72, 0x5B, 0x00, 0x30, 0xB9, 0xFD, 0x8D, 0x2D, 0x01, 0x93, 0x47, 0x04, 0x56, 0xA7, 0x00, 0x1F,
+	0x23, 0xF5, 0x41, 0x81, 0xE6, 0x08, 0xE8, 0xDB, 0x47, 0x14, 0xDA, 0x9F, 0xBE, 0xE0, 0x8E, 0xB2,
+	0xEB, 0x3A, 0x8D, 0xF6, 0x8C, 0x9A, 0xFF, 0x07, 0xE1, 0x05, 0xCD, 0x23, 0x02, 0xE9, 0x59, 0xED,
+	0xDC, 0xDB, 0xCF, 0xF5, 0xCA, 0xBB, 0x40, 0xF1, 0xBC, 0x03, 0x5D, 0xD1, 0xB8, 0xF1, 0xEB, 0x39,
+	0x14, 0xFE, 0x61, 0xA3, 0x01, 0x6F, 0x79, 0xFB, 0x26, 0xDF, 0xF5, 0xC4, 0x3C, 0xF8, 0xA3, 0xDF,
+	0x01, 0xB1, 0xBC, 0x0B, 0x69, 0x91, 0x0E, 0x97, 0x96, 0x08, 0xFA, 0x91, 0xFE, 0x17, 0x11, 0xF8,
+	0xCB, 0x06, 0xFA, 0x6C, 0xA2, 0x03, 0x91, 0xD7, 0x0F, 0x0C, 0xF6, 0x18, 0xDD, 0xB1, 0x1C, 0xBE,
+	0x7F, 0x1C, 0xC3, 0xE6, 0x19, 0x87, 0x80, 0x10, 0xD1, 0xE9, 0xFD, 0xBF, 0xF6, 0xED, 0x8F, 0xF0,
+	0xEE, 0x86, 0x0F, 0x00, 0x31, 0x19, 0x14, 0x5B, 0x33, 0x1C, 0xF5, 0xFF, 0x12, 0xD3, 0x35, 0xFF,
+	0xEB, 0xED, 0xED, 0x78, 0xAD, 0xE8, 0x8D, 0x94, 0xEF, 0x4A, 0xDF, 0xFA, 0x4F, 0xD4, 0x01, 0x1D,
+	0x40, 0x01, 0x2C, 0x0A, 0xFD, 0x2F, 0x61, 0xFC, 0xD3, 0xB4, 0x03, 0x33, 0x6E, 0x11, 0x2C, 0x33,
+	0x1F, 0xEB, 0x60, 0x26, 0x67, 0x45, 0x24, 0x29, 0x1D, 0x1B, 0x06, 0xB2, 0x0F, 0x50, 0x71, 0x05,
+	0x44, 0x2D, 0xFD, 0x39, 0x73, 0xFA, 0x25, 0x72, 0x06, 0xC1, 0x76, 0x21, 0xF2, 0x71, 0x3C, 0xA8,
+	0xE9, 0x46, 0x03, 0x60, 0x3B, 0xBA, 0xEA, 0x21, 0x9D, 0xC6, 0x09, 0x7B, 0x51, 0xFE, 0x09, 0x61,
+	0x00, 0x6E, 0xA2, 0x07, 0x46, 0x23, 0x0A, 0x1F, 0x03, 0x04, 0x0C, 0x4D, 0xF9, 0xDD, 0xF4, 0xF1,
+	0x9D, 0x3F, 0xF3, 0x2C, 0xE1, 0xFB, 0xD3, 0x3B, 0x05, 0x63, 0x53, 0x08, 0x0D, 0x9D, 0x02, 0x86,
+	0x00, 0xF7, 0x56, 0x75, 0xEB, 0xA2, 0x68, 0xE4, 0x27, 0x9E, 0xE2, 0x1B, 0xDB, 0xE3, 0x0E, 0x55,
+	0xE9, 0x84, 0x48, 0xF8, 0x57, 0x2D, 0x0C, 0x6C, 0x2A, 0x15, 0x8A, 0x64, 0x0B, 0x4B, 0xB9, 0xF6,
+	0xCD, 0xD3, 0xE6, 0x62, 0xC5, 0xE6, 0x5B, 0x3B, 0xF6, 0x33, 0x52, 0x0A, 0xED, 0x98, 0x16, 0x6D,
+	0x9A, 0x15, 0x52, 0x6C, 0x0B, 0x31, 0x23, 0x01, 0x49, 0x8D, 0xFD, 0xF7, 0x84, 0x00, 0xF7, 0xF9,
+	0x03, 0x83, 0x5C, 0x01, 0xB4, 0xAE, 0xF6, 0xF3, 0xFB, 0xE7, 0x1A, 0x58, 0xDC, 0xAB, 0x0F, 0xD9,
+	0x99, 0xA9, 0xDE, 0xFC, 0x68, 0xE9, 0xCD, 0xBD, 0xF4, 0xED, 0x55, 0xFE, 0x78, 0xFF, 0x04, 0xC1,
+	0x86, 0x01, 0x07, 0x24, 0xED, 0x6D, 0xDA, 0xCF, 0xC1, 0x57, 0xBB, 0x83, 0xB4, 0xBB, 0x05, 0xAA,
+	0xCF, 0x3B, 0x7D, 0xEA, 0x26, 0xA6, 0xFD, 0xD0, 0x45, 0x02, 0x85, 0x6F, 0xFC, 0x2B, 0x4D, 0xF6,
+	0x8B, 0x9F, 0xF7, 0x97, 0x9F, 0x00, 0x24, 0xBF, 0x0A, 0xC9, 0x89, 0x0E, 0xFE, 0x74, 0x09, 0x84,
+	0x8E, 0xFF, 0xC3, 0x41, 0xF8, 0x88, 0x03, 0xF9, 0x57, 0xFC, 0x01, 0x5C, 0x62, 0x0E, 0x05, 0x92,
+	0x18, 0x52, 0x54, 0x1D, 0xAF, 0xA1, 0x1D, 0xEA, 0xB4, 0x1A, 0xF5, 0x80, 0x10, 0x7E, 0x07, 0xFD,
+	0x54, 0x29, 0xEC, 0x1D, 0x2A, 0xEC, 0x33, 0xFA, 0xFC, 0x46, 0x59, 0x11, 0x5D, 0xC1, 0x1A, 0xF4,
+	0xD3, 0x12, 0x13, 0xB0, 0xFF, 0xC9, 0x0E, 0xEE, 0xF2, 0xE5, 0xE7, 0x5D, 0x22, 0xEE, 0xB3, 0x9D,
+	0xF9, 0x61, 0x72, 0x01, 0x2A, 0xB7, 0x01, 0x8E, 0xA7, 0xFD, 0xBE, 0x39, 0xFC, 0x5D, 0x80, 0x02,
+	0xA8, 0xB8, 0x0F, 0x6B, 0x07, 0x1E, 0xDF, 0x90, 0x26, 0xB6, 0xE0, 0x25, 0x3A, 0x80, 0x1D, 0x59,
+	0xE3, 0x11, 0x39, 0x10, 0x07, 0x43, 0x36, 0xFE, 0x61, 0x2F, 0xFB, 0x3F, 0xC9, 0x06, 0x3A, 0x6E,
+	0x21, 0x83, 0x98, 0x3C, 0x42, 0xC3, 0x47, 0x4C, 0xF5, 0x3C, 0x0B, 0xB1, 0x23, 0xCE, 0xCE, 0x0A,
+	0x2A, 0x33, 0xFE, 0x37, 0x79, 0xFF, 0x20, 0xCC, 0x06, 0x5B, 0x3C, 0x0A, 0xAD, 0x0E, 0x05, 0xE0,
+	0x97, 0xFA, 0xBF, 0x91, 0xF2, 0xCA, 0xC6, 0xF2, 0xE5, 0xC2, 0xFA, 0x2F, 0x71, 0x04, 0xF6, 0xA6,
+	0x08, 0x72, 0xFA, 0x03, 0xEB, 0xBD, 0xF8, 0x7A, 0x79, 0xEC, 0x37, 0x52, 0xE4, 0xD9, 0x98, 0xE1,
+	0x25, 0xBB, 0xE2, 0x89, 0xD1, 0xE8, 0x8E, 0xAA, 0xF8, 0xE4, 0x80, 0x0D, 0x03, 0x88, 0x17, 0x6C,
+	0x66, 0x0E, 0x8A, 0xD8, 0xF9, 0xED, 0xEF, 0xE8, 0x27, 0x8F, 0xE7, 0xD3, 0xEB, 0xF5, 0xA9, 0xE3,
+	0x09, 0xBF, 0xEB, 0x16, 0x1F, 0xDD, 0x16, 0xA7, 0xF9, 0x0C, 0x10, 0x1E, 0x02, 0x38, 0x87, 0xFD,
+	0x7A, 0xE3, 0xFF, 0xBF, 0xA5, 0x03, 0x9A, 0x0A, 0x02, 0x47, 0x4A, 0xF8, 0x5A, 0xA8, 0xE9, 0x20,
+	0x06, 0xDD, 0x7D, 0x33, 0xD8, 0x59, 0x89, 0xDC, 0xF7, 0xF8, 0xE6, 0x8C, 0xB0, 0xF2, 0xC1, 0x02,
+	0xFD, 0xE5, 0x1D, 0x04, 0x4D, 0x0E, 0x01, 0x63, 0x1D, 0xED, 0x44, 0xE7, 0xCF, 0x04, 0xE7, 0xBA,
+	0x1A, 0x67, 0xBA, 0x0D, 0xC9, 0xCD, 0x4E, 0xF1, 0xE8, 0xBC, 0x1F, 0xFD, 0x23, 0xDC, 0x02, 0xBD,
+	0x77, 0xFD, 0xD0, 0xBA, 0xF6, 0x41, 0x02, 0xF7, 0x3C, 0x49, 0xFF, 0x51, 0xA1, 0x09, 0xBF, 0x6E,
+	0x0E, 0x4E, 0x62, 0x0A, 0x50, 0xBA, 0x00, 0x90, 0xA9, 0xF8, 0x4A, 0x37, 0xF8, 0xEE, 0x49, 0x00,
+	0x5C, 0xE1, 0x0C, 0xC9, 0xFC, 0x17, 0x0D, 0xF6, 0x1D, 0x03, 0xDA, 0x1E, 0x02, 0xB2, 0x1B, 0xCC,
+	0xAD, 0x10, 0x35, 0x3A, 0xFC, 0x6F, 0x4C, 0xEA, 0x06, 0x6A, 0xE9, 0x4B, 0xB3, 0xF9, 0x6B, 0xAD,
+	0x0E, 0x73, 0x40, 0x19, 0x17, 0xBB, 0x12, 0xDD, 0x35, 0x00, 0x63, 0x2E, 0xEE, 0x28, 0x08, 0xE7,
+	0x89, 0x88, 0xEC, 0xC1, 0x24, 0xF8, 0x49, 0xDF, 0x00, 0xCD, 0x17, 0x02, 0xCD, 0x42, 0xFE, 0x00,
+	0x20, 0xFC, 0x8D, 0x48, 0x01, 0xAC, 0xDF, 0x0D, 0x8D, 0x9B, 0x1C, 0xFA, 0x85, 0x26, 0xAD, 0x69,
+	0x27, 0x2D, 0xEB, 0x1F, 0x18, 0x53, 0x14, 0xB9, 0xCE, 0x08, 0xE1, 0x56, 0xFF, 0xCE, 0xCD, 0xFB,
+	0x40, 0xF3, 0x06, 0x07, 0x4F, 0x21, 0xC1, 0xAF, 0x3C, 0x2F, 0xAE, 0x48, 0x95, 0xB6, 0x3E, 0xA7,
+	0x92, 0x25, 0xF1, 0xFB, 0x0B, 0x31, 0x25, 0xFE, 0x53, 0x85, 0xFE, 0x37, 0xF5, 0x05, 0x89, 0x48,
+	0x0A, 0x29, 0x27, 0x06, 0x06, 0xFF, 0xFB, 0x23, 0x4A, 0xF3, 0x6C, 0x52, 0xF2, 0xF4, 0x87, 0xF9,
+	0xAF, 0x6E, 0x03, 0x78, 0xB7, 0x08, 0xB4, 0x49, 0x05, 0x56, 0x76, 0xFA, 0x04, 0xB4, 0xED, 0x98,
+	0x4D, 0xE4, 0x43, 0x96, 0xE0, 0x9B, 0x71, 0xE1, 0xFA, 0x18, 0xE8, 0xDD, 0xE7, 0xF8, 0xEA, 0xCD,
+	0x0E, 0xA6, 0xDE, 0x19, 0xC1, 0x9A, 0x11, 0x30, 0xE9, 0xFC, 0xA7, 0x29, 0xEB, 0x17, 0x44, 0xE8,
+	0x5F, 0x8E, 0xF5, 0x80, 0x6E, 0x09, 0x9C, 0x48, 0x17, 0x0C, 0x3E, 0x18, 0x6F, 0xBC, 0x0E, 0xDC,
+	0x50, 0x03, 0x4A, 0xA8, 0xFD, 0x4E, 0x45, 0xFF, 0x6F, 0x44, 0x03, 0xFB, 0xAA, 0x02, 0xF5, 0xF4,
+	0xF9, 0x11, 0x8B, 0xEB, 0xA5, 0xF7, 0xDD, 0x1E, 0x87, 0xD7, 0xD8, 0x7B, 0xDA, 0x63, 0x58, 0xE4,
+	0xD7, 0x7B, 0xF0, 0x22, 0x80, 0xFB, 0x9B, 0x49, 0x03, 0x87, 0xB8, 0x00, 0xB9, 0x37, 0xED, 0x88,
+	0x15, 0xD0, 0xEE, 0x6B, 0xBA, 0x21, 0xF7, 0xB8, 0x54, 0xC9, 0xCB, 0x6C, 0x34, 0xE7, 0xDC, 0x82,
+	0xFC, 0x6E, 0x73, 0x03, 0x23, 0x7F, 0xFE, 0x2E, 0x3F, 0xF7, 0x2D, 0x61, 0xF6, 0xDF, 0xDF, 0xFD,
+	0xCF, 0x64, 0x08, 0x2D, 0x3D, 0x0E, 0xFE, 0x55, 0x0B, 0x95, 0x13, 0x02, 0xA0, 0x56, 0xF9, 0xA7,
+	0x92, 0xF7, 0x7A, 0xB3, 0xFE, 0xF2, 0x31, 0x0B, 0xA9, 0x4C, 0x17, 0xB5, 0x79, 0x1E, 0x02, 0x2C,
+	0x20, 0xED, 0xE0, 0x1C, 0x30, 0x0C, 0x11, 0xE1, 0x8A, 0xFB, 0xAD, 0x7E, 0xE8, 0x26, 0x80, 0xE6,
+	0x35, 0x75, 0xF6, 0x83, 0xF3, 0x0B, 0xD6, 0xD2, 0x17, 0xF4, 0xAE, 0x12, 0xAB, 0xCA, 0x00, 0xBC,
+	0x51, 0xEE, 0x71, 0x15, 0xE6, 0x47, 0xC1, 0xEA, 0x56, 0x6B, 0xF6, 0xD1, 0x15, 0x00, 0x59, 0x61,
+	0x02, 0xDE, 0xE1, 0xFE, 0x4F, 0x1D, 0xFC, 0x53, 0x16, 0x00, 0x5D, 0xE3, 0x0B, 0x9E, 0xF0, 0x1A,
+	0xF0, 0x34, 0x26, 0x51, 0xC3, 0x28, 0xF3, 0x6B, 0x22, 0xD9, 0xE5, 0x16, 0x61, 0xCE, 0x0A, 0xE0,
+	0x7F, 0x00, 0xF9, 0x5B, 0xFC, 0xC2, 0xF2, 0x06, 0x0B, 0xFB, 0x20, 0xC7, 0xC0, 0x3C, 0x68, 0xAA,
+	0x49, 0xC8, 0x9A, 0x40, 0x8A, 0xB1, 0x27, 0x95, 0x4A, 0x0D, 0xC6, 0x27, 0xFE, 0xEE, 0x96, 0xFD,
+	0x88, 0x03, 0x05, 0x82, 0x52, 0x0A, 0xAE, 0x47, 0x07, 0x3D, 0x85, 0xFD, 0x4F, 0x27, 0xF4, 0x21,
+	0xED, 0xF1, 0x61, 0x31, 0xF8, 0xB5, 0x2D, 0x02, 0x9F, 0x8C, 0x08, 0xD4, 0x64, 0x06, 0x71, 0x48,
+	0xFC, 0xFC, 0x05, 0xEF, 0x8D, 0x7C, 0xE4, 0xE2, 0x8D, 0xDF, 0x52, 0x02, 0xE0, 0xAB, 0x22, 0xE7,
+	0x9C, 0xED, 0xF8, 0x79, 0xFC, 0x0F, 0xE4, 0x3B, 0x1C, 0x15, 0xCA, 0x14, 0xF5, 0x10, 0x00, 0x3F,
+	0x53, 0xED, 0x0A, 0xF1, 0xE8, 0x5B, 0x23, 0xF5, 0xC4, 0xEC, 0x08, 0x1A, 0xAC, 0x17, 0x52, 0xC2,
+	0x19, 0x5E, 0xBF, 0x10, 0x9B, 0xC4, 0x04, 0xC8, 0xF5, 0xFD, 0x9A, 0xBA, 0xFE, 0x4C, 0xCE, 0x02,
+	0x53, 0x3B, 0x03, 0xA9, 0xAB, 0xFB, 0xA5, 0x9C, 0xED, 0x23, 0x37, 0xDF, 0x51, 0x20, 0xD7, 0x53,
+	0x7A, 0xD8, 0xE6, 0xA6, 0xE1, 0x26, 0x00, 0xEE, 0x7B, 0xDF, 0xF9, 0xD5, 0x69, 0x02, 0x1D, 0x88,
+	0x00, 0x4C, 0x8B, 0xED, 0x10, 0x57, 0xD0, 0xA2, 0xF4, 0xB9, 0x54, 0x67, 0xB7, 0x19, 0x8A, 0xC9,
+	0x8E, 0x4D, 0xE5, 0x12, 0xC2, 0xFB, 0xE8, 0xFC, 0x03, 0xC1, 0x9E, 0xFF, 0xF6, 0xCA, 0xF7, 0xB8,
+	0xC8, 0xF5, 0xF6, 0x5F, 0xFC, 0x2F, 0x00, 0x07, 0xA0, 0xEB, 0x0D, 0xE3, 0x4C, 0x0C, 0xEE, 0x98,
+	0x03, 0xA2, 0x46, 0xFA, 0xAB, 0x35, 0xF7, 0xCB, 0x20, 0xFD, 0x67, 0x7A, 0x09, 0x63, 0x5D, 0x16,
+	0xB3, 0xEC, 0x1E, 0x18, 0x85, 0x21, 0xE1, 0x49, 0x1E, 0x04, 0xAF, 0x11, 0x01, 0x0D, 0xFB, 0xD0,
+	0xBD, 0xE6, 0xFF, 0x9D, 0xE3, 0x48, 0x1B, 0xF3, 0xC7, 0x05, 0x09, 0xCD, 0x62, 0x16, 0x56, 0xA8,
+	0x12, 0x43, 0x73, 0x01, 0x72, 0x7E, 0xEE, 0x85, 0x11, 0xE5, 0xB9, 0xC3, 0xE8, 0x78, 0x70, 0xF4,
+	0x39, 0x0C, 0xFF, 0x6B, 0x83, 0x02, 0x5F, 0x89, 0xFF, 0xEE, 0x2C, 0xFC, 0xE3, 0xEE, 0xFE, 0x33,
+	0xCE, 0x09, 0x38, 0xFD, 0x18, 0x49, 0x91, 0x25, 0xC7, 0xEC, 0x29, 0x03, 0xE1, 0x24, 0x60, 0xB5,
+	0x19, 0xD7, 0xF9, 0x0C, 0x59, 0xD2, 0x01, 0x7E, 0xD4, 0xFC, 0x7E, 0xBF, 0x06, 0x70, 0x85, 0x20,
+	0xC9, 0xB4, 0x3C, 0x28, 0xBB, 0x4A, 0xFA, 0xB5, 0x42, 0x3C, 0x01, 0x2A, 0x35, 0xD1, 0x0E, 0x33,
+	0x44, 0xFE, 0x31, 0x9B, 0xFC, 0xF8, 0x08, 0x04, 0xF5, 0x43, 0x0A, 0xFC, 0x72, 0x08, 0x98, 0x2E,
+	0xFF, 0xCE, 0x2F, 0xF5, 0x04, 0x9F, 0xF1, 0x04, 0xC9, 0xF6, 0x07, 0xB0, 0x00, 0x10, 0x10, 0x08,
+	0x74, 0x5C, 0x07, 0x03, 0x0A, 0xFE, 0x9A, 0x81, 0xF0, 0x9C, 0xCB, 0xE4, 0x02, 0x90, 0xDE, 0xBC,
+	0x68, 0xDE, 0xF6, 0xE4, 0xE5, 0x81, 0xAE, 0xF8, 0xDA, 0x01, 0x11, 0xEE, 0xA7, 0x1E, 0x87, 0x11,
+	0x18, 0x1A, 0x77, 0x03, 0x48, 0x8C, 0xEF, 0xDB, 0xA6, 0xE9, 0xEE, 0x9C, 0xF4, 0x06, 0x52, 0x08,
+	0xAB, 0x0D, 0x18, 0x6A, 0x6A, 0x1B, 0xAE, 0xFE, 0x12, 0x77, 0x87, 0x06, 0xB0, 0x7F, 0xFE, 0x4B,
+	0x3D, 0xFE, 0xA2, 0x4D, 0x02, 0xFF, 0xB0, 0x03, 0xEE, 0x64, 0xFD, 0x58, 0xE6, 0xEF, 0x60, 0xCB,
+	0xE0, 0xD0, 0x08, 0xD7, 0xED, 0xA6, 0xD6, 0xD1, 0xD1, 0xDE, 0xB3, 0x57, 0xEB, 0xE1, 0xFB, 0xF7,
+	0xE0, 0x88, 0x01, 0xE5, 0x7A, 0x00, 0xEB, 0x0D, 0xEE, 0x3F, 0xCF, 0xD0, 0x07, 0x79, 0xB9, 0x35,
+	0xAF, 0xB5, 0x6D, 0x12, 0xC7, 0x82, 0x19, 0xE3, 0x42, 0xD6, 0xFA, 0x04, 0x80, 0x04, 0x88, 0xC2,
+	0x00, 0x2C, 0x79, 0xF8, 0xE4, 0x2F, 0xF5, 0xF7, 0xC7, 0xFA, 0xA1, 0x6B, 0x05, 0x21, 0x6D, 0x0D,
+	0xFA, 0x39, 0x0D, 0xC8, 0x49, 0x05, 0x0E, 0x87, 0xFB, 0xE7, 0x20, 0xF7, 0x85, 0xBC, 0xFB, 0x78,
+	0xAC, 0x07, 0x5F, 0x4B, 0x15, 0x09, 0x3C, 0x1F, 0x54, 0xF9, 0x22, 0xE9, 0xF1, 0x1F, 0x97, 0xA7,
+	0x12, 0x64, 0xD3, 0xFA, 0x06, 0x0E, 0xE5, 0xED, 0xAF, 0xE0, 0xD4, 0x7F, 0xEF, 0xE1, 0x1A, 0x06,
+	0x51, 0xD5, 0x14, 0xC2, 0xBB, 0x12, 0x20, 0x38, 0x02, 0x97, 0xBB, 0xEE, 0x2E, 0xFF, 0xE3, 0x24,
+	0x96, 0xE6, 0x8D, 0x22, 0xF2, 0x9A, 0xB6, 0xFD, 0xA6, 0x7C, 0x02, 0x44, 0x29, 0x00, 0x75, 0x5B,
+	0xFC, 0xED, 0xD7, 0xFD, 0xC4, 0x9C, 0x07, 0x4E, 0xC3, 0x16, 0x73, 0x8D, 0x24, 0xAD, 0xC8, 0x2A,
+	0x27, 0x53, 0x27, 0xAE, 0xA1, 0x1C, 0x28, 0x75, 0x0F, 0x56, 0x40, 0x03, 0xEE, 0x48, 0xFD, 0x81,
+	0x5F, 0x06, 0xC0, 0xCB, 0x1F, 0x90, 0x98, 0x3C, 0x57, 0xD8, 0x4B, 0xCE, 0x03, 0x45, 0xE8, 0xA5,
+	0x2C, 0x67, 0x92, 0x10, 0x42, 0x81, 0xFE, 0x7C, 0xA6, 0xFB, 0x4B, 0xE9, 0x02, 0xCF, 0x29, 0x0A,
+	0xF8, 0xA0, 0x09, 0xB2, 0x00, 0x01, 0x90, 0x71, 0xF6, 0x3C, 0x76, 0xF1, 0x04, 0x55, 0xF5, 0x58,
+	0xF3, 0xFE, 0xD6, 0x3F, 0x07, 0xAD, 0x09, 0x08, 0x83, 0xC3, 0xFF, 0x97, 0x39, 0xF2, 0xD4, 0x4F,
+	0xE5, 0x75, 0xB1, 0xDD, 0xB9, 0xA9, 0xDC, 0xE7, 0x55, 0xE4, 0xDE, 0x16, 0xF8, 0xE5, 0xD1, 0x11,
+	0xBA, 0xF5, 0x20, 0x0F, 0x8F, 0x1B, 0x4C, 0xE1, 0x06, 0x88, 0xF9, 0xF1, 0x72, 0x49, 0xEA, 0x96,
+	0xFF, 0xF3, 0xDE, 0x98, 0x07, 0xD8, 0x63, 0x18, 0xB7, 0x2D, 0x1D, 0xC0, 0x88, 0x15, 0xA5, 0x9E,
+	0x08, 0xCA, 0x4E, 0xFF, 0xF9, 0xE0, 0xFD, 0x14, 0xB7, 0x01, 0xD8, 0x0B, 0x04, 0x0F, 0x1C, 0xFF,
+	0x06, 0x5E, 0xF2, 0xD5, 0xC0, 0xE2, 0x85, 0x56, 0xD7, 0x06, 0x03, 0xD5, 0xC3, 0xFF, 0xDB, 0xD8,
+	0x64, 0xE8, 0xF3, 0xE8, 0xF5, 0x7E, 0x87, 0x00, 0x68, 0x8B, 0x00, 0xA4, 0xD4, 0xEE, 0x6B, 0x6C,
+	0xD1, 0x28, 0x15, 0xB9, 0xB9, 0xD5, 0xB3, 0xA5, 0x4B, 0xC4, 0xEA, 0x9E, 0xE0, 0xFC, 0xAB, 0xF9,
+	0x56, 0xE9, 0x04, 0xC4, 0x02, 0x02, 0xE6, 0x39, 0xF9, 0x26, 0xAC, 0xF4, 0xC6, 0x15, 0xF9, 0x5F,
+	0x9D, 0x03, 0xB5, 0xB2, 0x0C, 0xD3, 0x0E, 0x0E, 0xDE, 0x1A, 0x07, 0x99, 0x16, 0xFD, 0x3B, 0x58,
+	0xF7, 0x7F, 0x83, 0xFA, 0x55, 0xBB, 0x05, 0xCC, 0x01, 0x14, 0x4D, 0x4C, 0x1F, 0xCE, 0x6B, 0x24,
+	0x32, 0xD6, 0x21, 0x70, 0x01, 0x14, 0x71, 0xF4, 0xFA, 0x55, 0x9B, 0xE3, 0xD6, 0xA8, 0xDD, 0x7C,
+	0xE2, 0xEB, 0x78, 0xE9, 0x02, 0x76, 0x50, 0x13, 0xD0, 0xD8, 0x12, 0xC9, 0x27, 0x03, 0xDA, 0x1E,
+	0xEF, 0x72, 0xED, 0xE2, 0x33, 0x32, 0xE4, 0xC5, 0x80, 0xEF, 0xAB, 0x02, 0xFC, 0x61, 0x37, 0x02,
+	0x41, 0xC8, 0x00, 0x4E, 0xA2, 0xFC, 0xFC, 0xDB, 0xFC, 0xC0, 0x59, 0x05, 0x02, 0x36, 0x14, 0xC3,
+	0x19, 0x23, 0x87, 0x4A, 0x2B, 0xE8, 0x98, 0x29, 0xB7, 0xBF, 0x1F, 0xBC, 0x26, 0x12, 0x7D, 0xF0,
+	0x04, 0xA2, 0xB6, 0xFD, 0x94, 0xC7, 0x05, 0x96, 0xDC, 0x1E, 0xDE, 0x43, 0x3C, 0xA5, 0x02, 0x4D,
+	0x0A, 0x93, 0x47, 0x0C, 0x9C, 0x2F, 0x52, 0xB0, 0x12, 0x48, 0xF1, 0xFE, 0x1B, 0xB1, 0xFA, 0x67,
+	0xB9, 0x01, 0x49, 0xF4, 0x09, 0x4E, 0xD8, 0x0A, 0xA7, 0x03, 0x03, 0xD5, 0xFA, 0xF7, 0x4D, 0x85,
+	0xF1, 0x53, 0xE1, 0xF3, 0xC4, 0xFA, 0xFC, 0x1C, 0x16, 0x06, 0x92, 0x6A, 0x08, 0x7D, 0x7A, 0x01,
+	0x3B, 0x06, 0xF4, 0x4A, 0x24, 0xE6, 0xA5, 0xE8, 0xDC, 0x93, 0xD1, 0xDA, 0x31, 0x6C, 0xE2, 0x97,
+	0x0F, 0xF7, 0x4B, 0x48, 0x12, 0x21, 0x36, 0x23, 0x01, 0x03, 0x1F, 0x09, 0x99, 0x0A, 0x56, 0x6B,
+	0xF4, 0x44, 0xFD, 0xEA, 0x0A, 0x3A, 0xF3, 0xC9, 0xAD, 0x06, 0x42, 0xA0, 0x18, 0x42, 0x08, 0x1F,
+	0xA7, 0x57, 0x18, 0x28, 0x1F, 0x0B, 0x61, 0x76, 0x00, 0x37, 0xA7, 0xFD, 0x61, 0x19, 0x01, 0x1A,
+	0x3E, 0x04, 0x15, 0xC7, 0x00, 0x49, 0x09, 0xF5, 0x10, 0x1C, 0xE5, 0xCC, 0x1A, 0xD8, 0x95, 0xB6,
+	0xD3, 0xE6, 0x26, 0xD9, 0x12, 0x49, 0xE5, 0x54, 0x7E, 0xF3, 0xD1, 0x6D, 0xFF, 0x72, 0xB3, 0x00,
+	0x83, 0xD2, 0xEF, 0xB2, 0x5A, 0xD2, 0x1E, 0xC1, 0xB8, 0x6D, 0xDC, 0xB1, 0x96, 0x39, 0xC1, 0x0D,
+	0xBF, 0xDD, 0xC8, 0x34, 0xF8, 0x25, 0x32, 0x05, 0x1A, 0x46, 0x03, 0xA5, 0x1E, 0xFA, 0xAF, 0x33,
+	0xF4, 0x03, 0x49, 0xF7, 0xEB, 0x88, 0x01, 0xC6, 0xA8, 0x0B, 0x73, 0xB9, 0x0E, 0x26, 0x03, 0x09,
+	0x9E, 0xF7, 0xFE, 0x5C, 0xF9, 0xF7, 0x08, 0x78, 0xF9, 0x90, 0xD5, 0x03, 0x32, 0x6A, 0x12, 0x5D,
+	0x2E, 0x1F, 0x4E, 0xCA, 0x25, 0xAD, 0xFA, 0x23, 0x1B, 0xCB, 0x15, 0x65, 0x87, 0xFB, 0xF1, 0x64,
+	0xE2, 0x87, 0xC4, 0xDA, 0xFA, 0x00, 0xE8, 0x36, 0xAA, 0xFF, 0x36, 0x9B, 0x11, 0x4D, 0x12, 0x13,
+	0xF1, 0x48, 0x04, 0x74, 0xB3, 0xEF, 0xE0, 0xEA, 0xE1, 0x62, 0xA6, 0xE1, 0xA1, 0x7B, 0xEC, 0x1C,
+	0xE5, 0xF9, 0xFF, 0xA8, 0x01, 0x74, 0x50, 0x01, 0xA1, 0x0E, 0xFD, 0x98, 0x01, 0xFC, 0xA9, 0x0A,
+	0x03, 0x79, 0x5D, 0x11, 0x86, 0x25, 0x21, 0x5D, 0x50, 0x2B, 0x68, 0xAE, 0x2B, 0x0B, 0xE4, 0x22,
+	0x2E, 0x30, 0x15, 0x24, 0xD3, 0x06, 0xE2, 0x37, 0xFE, 0x3D, 0x06, 0x05, 0x7E, 0x92, 0x1D, 0x6F,
+	0xC0, 0x3B, 0x57, 0x25, 0x4E, 0xC0, 0x56, 0x4A, 0xA9, 0xF7, 0x32, 0x18, 0x31, 0x15, 0x83, 0xA6,
+	0xFF, 0x6A, 0xC6, 0xF9, 0x72, 0x6A, 0x00, 0x3E, 0x8C, 0x09, 0x3A, 0x0D, 0x0C, 0x61, 0x39, 0x05,
+	0xF8, 0xDD, 0xF9, 0x02, 0x2B, 0xF2, 0xA7, 0x0B, 0xF3, 0x29, 0x18, 0xFB, 0x7A, 0x26, 0x04, 0xBD,
+	0xA3, 0x07, 0x0C, 0xA4, 0x02, 0xB2, 0x60, 0xF7, 0x21, 0xF8, 0xEA, 0x47, 0x71, 0xE2, 0x5B, 0x38,
+	0xE0, 0x08, 0x9D, 0xE6, 0x88, 0x91, 0xF7, 0xF3, 0x54, 0x0D, 0x13, 0xE4, 0x1A, 0xBC, 0x95, 0x18,
+	0x85, 0xFF, 0x09, 0x2E, 0xF8, 0xF9, 0x96, 0x53, 0xF2, 0x06, 0xA0, 0xF6, 0x0E, 0x8A, 0x02, 0xD8,
+	0x06, 0x0E, 0xE4, 0xC2, 0x12, 0xF6, 0x95, 0x0F, 0xA5, 0x1F, 0x08, 0xBA, 0x91, 0x01, 0xE2, 0x11,
+	0xFF, 0x33, 0x30, 0x00, 0x7F, 0xEF, 0x01, 0xCA, 0x3A, 0x01, 0x66, 0x14, 0xFD, 0x66, 0x00, 0xF7,
+	0x78, 0xD0, 0xF1, 0x54, 0x4B, 0xEF, 0xDE, 0x97, 0xF0, 0xAD, 0xCE, 0xF4, 0x25, 0x55, 0xFA, 0x12,
+	0x45, 0xFF, 0xB8, 0x8F, 0x00, 0x98, 0x8A, 0xFB, 0x18, 0x02, 0xF2, 0x12, 0x5F, 0xE9, 0xCB, 0x8B,
+	0xE6, 0x65, 0xD2, 0xEA, 0x59, 0x89, 0xF3, 0xD3, 0x1B, 0xFC, 0x62, 0xE7, 0x00, 0x32, 0x23, 0x01,
+	0x3F, 0xBA, 0xFE, 0x2A, 0x8A, 0xFC, 0x4E, 0x85, 0xFC, 0x7A, 0xA1, 0xFE, 0xD7, 0x55, 0x01, 0x30,
+	0xDE, 0x02, 0x87, 0x75, 0x02, 0x04, 0xB7, 0x00, 0x72, 0x13, 0xFF, 0x79, 0xD3, 0xFE, 0x3C, 0x53,
+	0x00, 0xBD, 0xF3, 0x02, 0xCA, 0x88, 0x05, 0xAB, 0x20, 0x07, 0xF8, 0x12, 0x07, 0xB6, 0xC4, 0x04,
+	0xBA, 0x7F, 0x00, 0xC9, 0x52, 0xFC, 0xA7, 0x99, 0xFA, 0x87, 0x16, 0xFC, 0xFE, 0x6D, 0xFF, 0xCB,
+	0x67, 0x02, 0xFB, 0x41, 0x03, 0x76, 0xC0, 0x01, 0x92, 0x01, 0xFF, 0x1F, 0xAB, 0xFC, 0xF6, 0xDD,
+	0xFB, 0xA4, 0xAB, 0xFC, 0x3C, 0x41, 0xFE, 0x88, 0x95, 0xFF, 0x72, 0x0F, 0x00, 0xB4, 0xCF, 0xFF,
+	0x96, 0x77, 0xFF, 0x80, 0xA8, 0xFF, 0x32, 0x9A, 0x00, 0x41, 0xFD, 0x01, 0x70, 0x35, 0x03, 0xFF,
+	0xB8, 0x03, 0xDB, 0x59, 0x03, 0xA4, 0x47, 0x02, 0x43, 0xE6, 0x00, 0xD2, 0xD9, 0xFF, 0x03, 0xFA,
+	0xFF, 0x47, 0x89, 0x01, 0x61, 0xB6, 0x03, 0xD0, 0x40, 0x05, 0x93, 0x5C, 0x05, 0x40, 0x16, 0x04,
+	0x1B, 0x2F, 0x02, 0x76, 0x9A, 0x00, 0x9C, 0xD6, 0xFF, 0x6F, 0xF3, 0xFF, 0xC8, 0x86, 0x00, 0x99,
+	0xFE, 0x00, 0x48, 0x00, 0x01, 0x3D, 0x8E, 0x00, 0x7C, 0xF6, 0xFF, 0xC0, 0x92, 0xFF, 0xAB, 0x8E,
+	0xFF, 0xD5, 0xD1, 0xFF, 0x02, 0x17, 0x00, 0x81, 0x1A, 0x00, 0xA9, 0xC1, 0xFF, 0xE0, 0x27, 0xFF,
+	0x16, 0x87, 0xFE, 0x90, 0x1F, 0xFE, 0x3F, 0x30, 0xFE, 0x09, 0xE6, 0xFE, 0x49, 0x05, 0x00, 0xF7,
+	0xEC, 0x00, 0x5B, 0x1E, 0x01, 0x94, 0x9A, 0x00, 0x7B, 0xC8, 0xFF, 0x7C, 0x2E, 0xFF, 0xE6, 0x1B,
+	0xFF, 0xE2, 0x8B, 0xFF, 0xD3, 0x32, 0x00, 0xA8, 0xB6, 0x00, 0x49, 0xE1, 0x00, 0x37, 0xB6, 0x00,
+	0xE0, 0x62, 0x00, 0xA0, 0x1D, 0x00, 0x4C, 0x00, 0x00, 0x49, 0x09, 0x00, 0x03, 0x1D, 0x00, 0x94,
+	0x1B, 0x00, 0xF5, 0xF5, 0xFF, 0xF6, 0xB5, 0xFF, 0x4C, 0x77, 0xFF, 0x08, 0x57, 0xFF, 0xF0, 0x63,
+	0xFF, 0x8F, 0x9B, 0xFF, 0xB6, 0xE7, 0xFF, 0x71, 0x19, 0x00, 0x46, 0xFE, 0xFF, 0x57, 0x95, 0xFF,
+	0xB1, 0x14, 0xFF, 0xED, 0xBF, 0xFE, 0x9D, 0xBF, 0xFE, 0x5B, 0x0D, 0xFF, 0x1C, 0x7D, 0xFF, 0x50,
+	0xDA, 0xFF, 0x52, 0x03, 0x00, 0xB9, 0xF7, 0xFF, 0x7B, 0xD1, 0xFF, 0x45, 0xB1, 0xFF, 0x7E, 0xAC,
+	0xFF, 0x78, 0xC3, 0xFF, 0xD2, 0xE6, 0xFF, 0x51, 0x03, 0x00, 0x0B, 0x0E, 0x00, 0x21, 0x09, 0x00,
+	0x3E, 0x00, 0x00, 0x10, 0x00, 0x00, 0x9B, 0x0F, 0x00, 0x2B, 0x2D, 0x00, 0xF4, 0x4E, 0x00, 0x64,
+	0x66, 0x00, 0x7C, 0x61, 0x00, 0x04, 0x39, 0x00, 0xD0, 0xFF, 0xFF, 0x07, 0xD7, 0xFF, 0x86, 0xD3,
+	0xFF, 0xA3, 0xF2, 0xFF, 0x7B, 0x1E, 0x00, 0xAA, 0x3D, 0x00, 0xD8, 0x3F, 0x00, 0x38, 0x26, 0x00,
+	0x66, 0xFF, 0xFF, 0x52, 0xDE, 0xFF, 0xCF, 0xCF, 0xFF, 0x78, 0xD5, 0xFF, 0xFD, 0xE6, 0xFF, 0xCE,
+	0xF8, 0xFF, 0x69, 0x02, 0x00, 0x7E, 0x02, 0x00, 0xB3, 0xFD, 0xFF, 0xD2, 0xFA, 0xFF, 0x38, 0xFE,
+	0xFF, 0x87, 0x07, 0x00, 0x48, 0x12, 0x00, 0xD4, 0x18, 0x00, 0x35, 0x17, 0x00, 0x01, 0x0D, 0x00,
+	0x2E, 0xFF, 0xFF, 0x0D, 0xF8, 0xFF, 0xA9, 0xFF, 0xFF, 0x96, 0x14, 0x00, 0xBA, 0x2C, 0x00, 0x47,
+	0x3C, 0x00, 0x6F, 0x3C, 0x00, 0x66, 0x2E, 0x00, 0xCA, 0x19, 0x00, 0x43, 0x08, 0x00, 0x45, 0x00,
+	0x00, 0xB5, 0x02, 0x00, 0x5C, 0x0B, 0x00, 0xE7, 0x13, 0x00, 0x84, 0x17, 0x00, 0xCA, 0x14, 0x00,
+	0xD3, 0x0D, 0x00, 0x56, 0x06, 0x00, 0x55, 0x01, 0x00, 0xAA, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xAB,
+	0xFF, 0xFF, 0xEC, 0xFC, 0xFF, 0x5D, 0xF7, 0xFF, 0x87, 0xF0, 0xFF, 0xF1, 0xEB, 0xFF, 0x93, 0xED,
+	0xFF, 0xCB, 0xF5, 0xFF, 0xE4, 0xFF, 0xFF, 0x01, 0x06, 0x00, 0x4C, 0x05, 0x00, 0x1A, 0xFF, 0xFF,
+	0x59, 0xF7, 0xFF, 0xE3, 0xF1, 0xFF, 0x53, 0xF1, 0xFF, 0xBC, 0xF5, 0xFF, 0xD1, 0xFC, 0xFF, 0x67,
+	0x03, 0x00, 0x05, 0x07, 0x00, 0xF2, 0x06, 0x00, 0x28, 0x04, 0x00, 0x9B, 0x00, 0x00, 0x13, 0xFE,
+	0xFF, 0x4F, 0xFD, 0xFF, 0xF9, 0xFD, 0xFF, 0x01, 0xFF, 0xFF, 0x67, 0xFF, 0xFF, 0xC9, 0xFE, 0xFF,
+	0x8B, 0xFD, 0xFF, 0x95, 0xFC, 0xFF, 0xD8, 0xFC, 0xFF, 0xB9, 0xFE, 0xFF, 0x1A, 0x01, 0x00, 0xDA,
+	0x01, 0x00, 0xBC, 0xFF, 0xFF, 0x7A, 0xFB, 0xFF, 0x18, 0xF7, 0xFF, 0x98, 0xF4, 0xFF, 0xF5, 0xF4,
+	0xFF, 0xC4, 0xF7, 0xFF, 0x8D, 0xFB, 0xFF, 0xB2, 0xFE, 0xFF, 0x1B, 0x00, 0x00, 0xAE, 0xFF, 0xFF,
+	0x20, 0xFE, 0xFF, 0x5E, 0xFC, 0xFF, 0x4B, 0xFB, 0xFF, 0x4D, 0xFB, 0xFF, 0x3D, 0xFC, 0xFF, 0x99,
+	0xFD, 0xFF, 0xD2, 0xFE, 0xFF, 0x9A, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0x36, 0x00, 0x00, 0xAC, 0x00,
+	0x00, 0x84, 0x01, 0x00, 0x8E, 0x02, 0x00, 0x24, 0x03, 0x00, 0xA1, 0x02, 0x00, 0x28, 0x01, 0x00,
+	0xA0, 0xFF, 0xFF, 0xF0, 0xFE, 0xFF, 0x70, 0xFF, 0xFF, 0xD6, 0x00, 0x00, 0x65, 0x02, 0x00, 0x63,
+	0x03, 0x00, 0x63, 0x03, 0x00, 0x77, 0x02, 0x00, 0x12, 0x01, 0x00, 0xCA, 0xFF, 0xFF, 0x0E, 0xFF,
+	0xFF, 0x01, 0xFF, 0xFF, 0x7C, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xF4, 0x00, 0x00,
+	0xEA, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x93, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x80, 0x00, 0x00, 0x81,
+	0x00, 0x00, 0x5B, 0x00, 0x00, 0x08, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0x58, 0x00,
+	0x00, 0x1F, 0x01, 0x00, 0xD1, 0x01, 0x00, 0x22, 0x02, 0x00, 0xF4, 0x01, 0x00, 0x64, 0x01, 0x00,
+	0xB0, 0x00, 0x00, 0x23, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x5F, 0x00, 0x00, 0xC1,
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x0A, 0x01, 0x00, 0xE0, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x52, 0x00,
+	0x00, 0x1B, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xCA, 0xFF, 0xFF, 0xAD, 0xFF, 0xFF,
+	0x93, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x29, 0x00, 0x00, 0x2E,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0xB9, 0xFF, 0xFF, 0x73, 0xFF, 0xFF, 0x4E, 0xFF, 0xFF, 0x56, 0xFF,
+	0xFF, 0x85, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x24, 0x00, 0x00, 0x25, 0x00, 0x00,
+	0x0C, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xB4, 0xFF, 0xFF, 0xB2, 0xFF, 0xFF, 0xBB,
+	0xFF, 0xFF, 0xC9, 0xFF, 0xFF, 0xD5, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xF5, 0xFF,
+	0xFF, 0x05, 0x00, 0x00, 0x0A, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xBB, 0xFF, 0xFF,
+	0xA4, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0xAD, 0xFF, 0xFF, 0xCA, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0x01,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xCD, 0xFF,
+	0xFF, 0xCA, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
+	0x06, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x12, 0x00, 0x00, 0x16, 0x00, 0x00, 0x18, 0x00, 0x00, 0x12,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x06, 0x00,
+	0x00, 0x15, 0x00, 0x00, 0x21, 0x00, 0x00, 0x26, 0x00, 0x00, 0x21, 0x00, 0x00, 0x17, 0x00, 0x00,
+	0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x0F, 0x00, 0x00, 0x13, 0x00, 0x00, 0x14, 0x00, 0x00, 0x12, 0x00, 0x00, 0x0F, 0x00,
+	0x00, 0x0B, 0x00, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x13, 0x00, 0x00, 0x16, 0x00, 0x00, 0x16,
+	0x00, 0x00, 0x11, 0x00, 0x00, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF,
+	0xFF, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0A, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFC,
+	0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFA, 0xFF, 0xFF,
+	0xF8, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF,
+	0xFF, 0xFB, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+	0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFD, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00
+};
\ No newline at end of file
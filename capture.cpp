@@ -0,0 +1,311 @@
+#include "capture.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace {
+	// GIF's variable-length LZW, for a 2 colors image
+	class LZWEncoder {
+		static constexpr unsigned minCodeSize{ 2u };
+		static constexpr unsigned clearCode{ 1u << minCodeSize };
+		static constexpr unsigned endCode{ clearCode + 1u };
+		static constexpr unsigned maxCode{ 4095u };
+
+		// only 2 symbols, so each node has at most 2 children; 0 means no child (code 0 can never be a child)
+		std::vector<std::array<std::uint16_t, 2>> children_ = std::vector<std::array<std::uint16_t, 2>>(maxCode + 1u);
+
+		std::vector<unsigned char>&	output_;
+		std::uint32_t				bits_{};
+		unsigned					nBits_{};
+		unsigned					codeSize_{ minCodeSize + 1u };
+		unsigned					nextCode_{ endCode };
+		int							current_{ -1 };
+
+		void write(unsigned code, unsigned size) {
+			bits_ |= code << nBits_;
+			nBits_ += size;
+			while (nBits_ >= 8u) {
+				output_.push_back(static_cast<unsigned char>(bits_));
+				bits_ >>= 8u;
+				nBits_ -= 8u;
+			}
+		}
+
+		void restart() {
+			std::fill(children_.begin(), children_.end(), std::array<std::uint16_t, 2>{});
+			codeSize_ = minCodeSize + 1u;
+			nextCode_ = endCode;
+		}
+
+	public:
+		explicit LZWEncoder(std::vector<unsigned char>& output) : output_{ output } {
+			output_.push_back(minCodeSize);
+			write(clearCode, codeSize_);
+		}
+
+		void push(bool pixel) {
+			if (current_ < 0) {
+				current_ = pixel;
+				return;
+			}
+			auto& child{ children_[static_cast<std::size_t>(current_)][pixel] };
+			if (child) {
+				current_ = child;
+				return;
+			}
+			write(static_cast<unsigned>(current_), codeSize_);
+			child = static_cast<std::uint16_t>(++nextCode_);
+			if (nextCode_ >= (1u << codeSize_)) {
+				codeSize_++;
+			}
+			if (nextCode_ == maxCode) {
+				write(clearCode, codeSize_);
+				restart();
+			}
+			current_ = pixel;
+		}
+
+		void finish() {
+			if (current_ >= 0) {
+				write(static_cast<unsigned>(current_), codeSize_);
+			}
+			// the decoder adds an entry after reading the last code, which may widen the end code
+			const bool widened{ nextCode_ + 1u >= (1u << codeSize_) && codeSize_ < 12u };
+			write(endCode, widened ? codeSize_ + 1u : codeSize_);
+			if (nBits_) {
+				output_.push_back(static_cast<unsigned char>(bits_));
+			}
+		}
+	};
+
+	struct Rect {
+		std::size_t left{}, top{}, right{}, bottom{}; // right and bottom excluded
+
+		bool empty() const noexcept {
+			return right <= left || bottom <= top;
+		}
+	};
+
+	// smallest rectangle containing every pixel which differs between <lhs> and <rhs>
+	Rect difference(const Screen::Frame& lhs, const Screen::Frame& rhs) noexcept {
+		Rect rect{ Screen::widthInPixels, Screen::heightInPixels, 0u, 0u };
+		for (std::size_t y{ 0u }; y < Screen::heightInPixels; y++) {
+			const std::uint64_t changed{ lhs[y] ^ rhs[y] };
+			if (!changed) {
+				continue;
+			}
+			std::size_t first{ 0u };
+			while (!(changed & (std::uint64_t{ 1 } << (63u - first)))) {
+				first++;
+			}
+			std::size_t last{ 63u };
+			while (!(changed & (std::uint64_t{ 1 } << (63u - last)))) {
+				last--;
+			}
+			rect.left = std::min(rect.left, first);
+			rect.right = std::max(rect.right, last + 1u);
+			rect.top = std::min(rect.top, y);
+			rect.bottom = y + 1u;
+		}
+		return rect;
+	}
+
+	inline bool isWhite(const Screen::Frame& frame, std::size_t x, std::size_t y) noexcept {
+		return (frame[y] >> (Screen::widthInPixels - 1u - x)) & 1u;
+	}
+
+	void writeU16(std::ofstream& file, std::size_t value) {
+		file.put(static_cast<char>(value & 0xFF));
+		file.put(static_cast<char>((value >> 8) & 0xFF));
+	}
+}
+
+FrameRecorder::~FrameRecorder() {
+	close();
+}
+
+bool FrameRecorder::open(const std::string& path, std::size_t scale) {
+	close();
+	const auto extension{ std::filesystem::path(path).extension() };
+	if (extension == ".gif") {
+		format_ = Format::GIF;
+	}
+	else if (extension == ".y4m") {
+		format_ = Format::Y4M;
+	}
+	else {
+		std::cerr << "Error unknown capture format " << extension << ", expected .y4m or .gif !" << std::endl;
+		return false;
+	}
+	if (scale == 0u || Screen::widthInPixels * scale > 0xFFFF) {
+		std::cerr << "Error capture scale " << scale << " is out of range !" << std::endl;
+		return false;
+	}
+	file_.open(path, std::ios_base::binary | std::ios_base::trunc);
+	if (!file_) {
+		std::cerr << "Error cannot create capture file " << std::quoted(path) << " !" << std::endl;
+		return false;
+	}
+	scale_ = scale;
+	closing_ = false;
+	nFrames_ = 0u;
+	anyWritten_ = false;
+	format_ == Format::GIF ? writeGIFHeader() : writeY4MHeader();
+	encoder_ = std::thread{ &FrameRecorder::encodeLoop, this };
+	return true;
+}
+
+void FrameRecorder::close() {
+	if (!encoder_.joinable()) {
+		return;
+	}
+	{
+		std::lock_guard lock{ mutex_ };
+		closing_ = true;
+	}
+	wakeUp_.notify_one();
+	encoder_.join();
+	if (format_ == Format::GIF) {
+		flushGIF(nFrames_);
+		file_.put(';'); // trailer
+	}
+	file_.close();
+}
+
+void FrameRecorder::push(const Screen::Frame& frame) {
+	{
+		std::lock_guard lock{ mutex_ };
+		queue_.push_back(frame);
+	}
+	wakeUp_.notify_one();
+}
+
+void FrameRecorder::encodeLoop() {
+	std::unique_lock lock{ mutex_ };
+	while (true) {
+		wakeUp_.wait(lock, [this] { return closing_ || !queue_.empty(); });
+		if (queue_.empty()) {
+			return; // closing and nothing left
+		}
+		const Screen::Frame frame{ queue_.front() };
+		queue_.pop_front();
+		lock.unlock();
+		encode(frame);
+		lock.lock();
+	}
+}
+
+void FrameRecorder::encode(const Screen::Frame& frame) {
+	if (format_ == Format::Y4M) {
+		writeY4MFrame(frame);
+	}
+	else if (nFrames_ == 0u) {
+		pending_ = frame;
+	}
+	else if (frame != pending_) {
+		// GIF viewers slow down delays under 2/100 s, so a too short frame is replaced by the next one
+		if (centiseconds(nFrames_) - centiseconds(pendingStart_) >= 2u) {
+			flushGIF(nFrames_);
+			pendingStart_ = nFrames_;
+		}
+		pending_ = frame;
+	}
+	nFrames_++;
+}
+
+void FrameRecorder::writeY4MHeader() {
+	file_ << "YUV4MPEG2 W" << Screen::widthInPixels * scale_ << " H" << Screen::heightInPixels * scale_
+		<< " F" << FPS << ":1 Ip A1:1 C420jpeg XCOLORRANGE=FULL\n";
+	// luma plane, then both chroma planes (a quarter of the luma plane each) which always stay neutral
+	const std::size_t lumaSize{ Screen::size * scale_ * scale_ };
+	const std::size_t chromaSize{ ((Screen::widthInPixels * scale_ + 1u) / 2u) * ((Screen::heightInPixels * scale_ + 1u) / 2u) };
+	plane_.assign(lumaSize + 2u * chromaSize, 0x80);
+}
+
+void FrameRecorder::writeY4MFrame(const Screen::Frame& frame) {
+	const std::size_t width{ Screen::widthInPixels * scale_ };
+	for (std::size_t y{ 0u }; y < Screen::heightInPixels; y++) {
+		unsigned char* const row{ &plane_[y * scale_ * width] };
+		for (std::size_t x{ 0u }; x < Screen::widthInPixels; x++) {
+			std::fill_n(row + x * scale_, scale_, isWhite(frame, x, y) ? 0xFF : 0x00);
+		}
+		for (std::size_t line{ 1u }; line < scale_; line++) {
+			std::copy_n(row, width, row + line * width);
+		}
+	}
+	file_ << "FRAME\n";
+	file_.write(reinterpret_cast<const char*>(plane_.data()), static_cast<std::streamsize>(plane_.size()));
+}
+
+void FrameRecorder::writeGIFHeader() {
+	file_ << "GIF89a";
+	writeU16(file_, Screen::widthInPixels * scale_);
+	writeU16(file_, Screen::heightInPixels * scale_);
+	file_.put(static_cast<char>(0x80)); // global color table of 2 entries
+	file_.put(0); // background color index
+	file_.put(0); // pixel aspect ratio
+	const char palette[]{ '\x00', '\x00', '\x00', '\xFF', '\xFF', '\xFF' };
+	file_.write(palette, sizeof(palette));
+	// loops forever
+	file_.write("\x21\xFF\x0BNETSCAPE2.0\x03\x01\x00\x00\x00", 19);
+}
+
+void FrameRecorder::flushGIF(std::size_t now) {
+	if (nFrames_ == 0u) {
+		return;
+	}
+	writeGIFFrame(pending_, std::max<std::size_t>(centiseconds(now) - centiseconds(pendingStart_), 2u));
+}
+
+void FrameRecorder::writeGIFFrame(const Screen::Frame& frame, std::size_t delay) {
+	Rect rect{ 0u, 0u, Screen::widthInPixels, Screen::heightInPixels };
+	if (anyWritten_) {
+		rect = difference(written_, frame);
+		if (rect.empty()) { // a frame is still needed to carry the delay
+			rect = { 0u, 0u, 1u, 1u };
+		}
+	}
+
+	// graphic control extension : pixels outside of the rectangle stay as they were
+	file_.write("\x21\xF9\x04\x04", 4);
+	writeU16(file_, std::min<std::size_t>(delay, 0xFFFF));
+	file_.put(0);
+	file_.put(0);
+
+	file_.put(',');
+	writeU16(file_, rect.left * scale_);
+	writeU16(file_, rect.top * scale_);
+	writeU16(file_, (rect.right - rect.left) * scale_);
+	writeU16(file_, (rect.bottom - rect.top) * scale_);
+	file_.put(0); // no local color table, not interlaced
+
+	std::vector<unsigned char> data{};
+	LZWEncoder encoder{ data };
+	for (std::size_t y{ rect.top * scale_ }; y < rect.bottom * scale_; y++) {
+		for (std::size_t x{ rect.left * scale_ }; x < rect.right * scale_; x++) {
+			encoder.push(isWhite(frame, x / scale_, y / scale_));
+		}
+	}
+	encoder.finish();
+
+	file_.put(static_cast<char>(data[0])); // minimum code size
+	for (std::size_t i{ 1u }; i < data.size(); i += 0xFF) {
+		const std::size_t blockSize{ std::min<std::size_t>(0xFF, data.size() - i) };
+		file_.put(static_cast<char>(blockSize));
+		file_.write(reinterpret_cast<const char*>(&data[i]), static_cast<std::streamsize>(blockSize));
+	}
+	file_.put(0); // block terminator
+
+	written_ = frame;
+	anyWritten_ = true;
+}
\ No newline at end of file
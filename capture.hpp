@@ -0,0 +1,90 @@
+#pragma once
+
+#include "pixel.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// Writes emulated frames to a video file.
+// push() only queues the packed frame, encoding happens on a background thread so capturing never slows emulation.
+//	.y4m	raw YUV4MPEG2, every frame is written in full
+//	.gif	animated GIF, every frame only encodes the rectangle which changed since the previous one
+class FrameRecorder {
+public:
+	enum class Format {
+		Y4M,
+		GIF
+	};
+
+	static constexpr std::size_t FPS{ 60u }; // same as CPU::FPS
+
+private:
+	std::ofstream				file_{};
+	Format						format_{ Format::Y4M };
+	std::size_t					scale_{ Pixel::size };
+
+	std::mutex					mutex_{};
+	std::condition_variable		wakeUp_{};
+	std::deque<Screen::Frame>	queue_{};
+	bool						closing_{ false };
+	std::thread					encoder_{};
+
+	// Y4M
+	std::vector<unsigned char>	plane_{};
+
+	// GIF, a frame is only written once the next different one is known, to know its delay
+	Screen::Frame				written_{};			// content of the file after the last written frame
+	Screen::Frame				pending_{};			// frame waiting for its delay
+	std::size_t					pendingStart_{};	// index of the frame when pending_ was first shown
+	std::size_t					nFrames_{};
+	bool						anyWritten_{ false };
+
+	void encodeLoop();
+
+	void encode(const Screen::Frame& frame);
+
+	void writeY4MHeader();
+	void writeY4MFrame(const Screen::Frame& frame);
+
+	void writeGIFHeader();
+	void writeGIFFrame(const Screen::Frame& frame, std::size_t delay);
+	void flushGIF(std::size_t now);
+
+	// GIF delays are in 1/100 s, rounded from the frame count so that the sum never drifts
+	static constexpr std::size_t centiseconds(std::size_t frame) noexcept {
+		return frame * 100u / 60u;
+	}
+
+public:
+	FrameRecorder() = default;
+
+	FrameRecorder(const FrameRecorder&)				= delete;
+	FrameRecorder(FrameRecorder&&)					= delete;
+
+	FrameRecorder& operator=(const FrameRecorder&)	= delete;
+	FrameRecorder& operator=(FrameRecorder&&)		= delete;
+
+	~FrameRecorder();
+
+	// format is deduced from the extension, <scale> is the size of an emulated pixel in the output
+	bool open(const std::string& path, std::size_t scale = Pixel::size);
+
+	// waits for every queued frame to be encoded, then closes the file
+	void close();
+
+	void push(const Screen::Frame& frame);
+};
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include "conformance.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <system_error>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace {
+	constexpr std::size_t fusionFrames{ 600u };
+
+	// every Fusion, entered at each offset of a frame : sprite draws, a run of 5 loads, timer waits spinning and falling through,
+	// BCD then load and store then BCD then load, both again with I on the sequence itself, which the fused handlers must leave alone
+	constexpr std::array<CPU::byte_t, 91> fusionROM{
+		0x6E, 0x05, 0xFE, 0x15, 0xA2, 0x52, 0xD0, 0x15, 0x60, 0x05, 0x61, 0x03, 0x62, 0x07, 0x63, 0x09,
+		0x64, 0x0B, 0x70, 0x01, 0xF8, 0x07, 0x38, 0x00, 0x12, 0x14, 0xF9, 0x07, 0x39, 0x00, 0x12, 0x1A,
+		0x6A, 0x7B, 0xA2, 0x57, 0xFA, 0x33, 0xF2, 0x65, 0xA2, 0x57, 0xF3, 0x55, 0xFA, 0x33, 0xF2, 0x65,
+		0x7C, 0x01, 0x3C, 0x03, 0x12, 0x00, 0x6C, 0x00, 0x6A, 0x2D, 0xA2, 0x3E, 0xFA, 0x33, 0xF2, 0x65,
+		0x60, 0x00, 0x60, 0x63, 0x61, 0x07, 0x62, 0xF2, 0xA2, 0x4C, 0xF2, 0x55, 0xFA, 0x33, 0xF2, 0x65,
+		0x12, 0x00, 0xF0, 0x90, 0x90, 0x90, 0xF0, 0x00, 0x00, 0x00, 0x00
+	};
+
+	void printDivergence(const std::string& ROM, const Conformance::Divergence& divergence) {
+		std::cerr << "Fused " << ROM << " diverges at frame " << divergence.frame << " : " << divergence.what << std::endl;
+	}
+
+	std::string hex(std::uint64_t value, int width) {
+		std::ostringstream ostream{};
+		ostream << std::setw(width) << std::setfill('0') << std::hex << std::uppercase << value;
+		return ostream.str();
+	}
+
+	// runs <ROM> headless and gives each trace line to <sink>, which returns false to stop the run
+	template <typename Sink>
+	bool run(const std::string& ROM, std::size_t frames, Sink&& sink) {
+		CPU cpu{};
+		cpu.seed(Conformance::seed);
+		if (!cpu.loadGame(ROM)) {
+			return false;
+		}
+		const auto& memory{ cpu.getMemory() };
+		const std::string header{ "chip8-trace " + std::to_string(Conformance::version) + ' ' +
+			hex(fnv1a(&memory[CPU::memoryStart], CPU::memoryUsableSize), 16) + ' ' + std::to_string(frames) };
+		if (!sink(header, 0u, 0u)) {
+			return true;
+		}
+		for (std::size_t frame{ 0u }; frame < frames; frame++) {
+			for (std::size_t instruction{ 0u }; instruction < CPU::opcodesPerFrame; instruction++) {
+				const auto pc{ cpu.registers().pc };
+				const CPU::address_t opcode{ static_cast<CPU::address_t>((memory[pc % CPU::memorySize] << 8) | memory[(pc + 1u) % CPU::memorySize]) };
+				if (!cpu.step()) {
+					sink("E " + std::to_string(frame), frame, instruction);
+					return true;
+				}
+				if (!sink("I " + hex(pc, 4) + ' ' + hex(opcode, 4) + ' ' + hex(Conformance::stateHash(cpu), 16), frame, instruction)) {
+					return true;
+				}
+			}
+			cpu.endFrame();
+			const auto screen{ cpu.getScreen().frame() };
+			const auto screenHash{ fnv1a(reinterpret_cast<const unsigned char*>(screen.data()), sizeof(screen)) };
+			if (!sink("F " + std::to_string(frame) + ' ' + hex(screenHash, 16) + ' ' + Conformance::describe(cpu.registers()), frame, CPU::opcodesPerFrame)) {
+				return true;
+			}
+		}
+		return true;
+	}
+}
+
+std::string Conformance::describe(const CPU::Registers& registers) {
+	std::string V{};
+	for (const auto value : registers.V) {
+		V += hex(value, 2);
+	}
+	return "pc=" + hex(registers.pc, 4) + " I=" + hex(registers.I, 4) + " V=" + V +
+		" DT=" + hex(registers.gameTimer, 2) + " ST=" + hex(registers.soundTimer, 2) + " SP=" + std::to_string(registers.stackSize);
+}
+
+bool Conformance::record(const std::string& ROM, const std::string& tracePath, std::size_t frames) {
+	std::ofstream trace{ tracePath, std::ios_base::trunc };
+	if (!trace) {
+		std::cerr << "Error cannot create trace " << std::quoted(tracePath) << " !" << std::endl;
+		return false;
+	}
+	const bool ran{ run(ROM, frames, [&trace](const std::string& line, std::size_t, std::size_t) {
+		trace << line << '\n';
+		return true;
+	}) };
+	return ran && static_cast<bool>(trace);
+}
+
+bool Conformance::check(const std::string& ROM, const std::string& tracePath) {
+	std::ifstream trace{ tracePath };
+	std::vector<std::string> expected{};
+	for (std::string line{}; std::getline(trace, line);) {
+		if (!line.empty() && line.back() == '\r') {
+			line.pop_back(); // the checkout may use CRLF
+		}
+		expected.push_back(std::move(line));
+	}
+	std::istringstream header{ expected.empty() ? "" : expected[0] };
+	std::string magic{}, ROMhash{};
+	unsigned traceVersion{};
+	std::size_t frames{ 0u };
+	if (!(header >> magic >> traceVersion >> ROMhash >> frames) || magic != "chip8-trace") {
+		std::cerr << "Error " << std::quoted(tracePath) << " isn't a trace !" << std::endl;
+		return false;
+	}
+
+	std::size_t line{ 0u };
+	std::optional<Divergence> divergence{};
+	std::string actualLine{};
+	const bool ran{ run(ROM, frames, [&](const std::string& actual, std::size_t frame, std::size_t instruction) {
+		if (line >= expected.size() || actual != expected[line]) {
+			divergence = Divergence{ frame, instruction, "" };
+			actualLine = actual;
+			return false;
+		}
+		line++;
+		return true;
+	}) };
+	if (!ran) {
+		return false;
+	}
+	if (!divergence && line != expected.size()) {
+		divergence = Divergence{ frames, 0u, "" };
+	}
+	if (divergence) {
+		std::cerr << "Divergence in " << ROM << " at frame " << divergence->frame << ", instruction " << divergence->instruction
+			<< " (line " << line + 1u << " of " << tracePath << ")" << std::endl
+			<< "  expected " << (line < expected.size() ? expected[line] : "end of trace") << std::endl
+			<< "  actual   " << (actualLine.empty() ? "end of run" : actualLine) << std::endl;
+		return false;
+	}
+	return true;
+}
+
+std::optional<Conformance::Divergence> Conformance::checkFusion(const CPU::byte_t* image, std::size_t size, std::size_t frames) {
+	CPU unfused{};
+	CPU fused{};
+	fused.setFusion(true);
+	for (CPU* cpu : { &unfused, &fused }) {
+		cpu->seed(seed);
+		if (!cpu->loadImage(image, size)) {
+			return Divergence{ 0u, 0u, "image too big" };
+		}
+	}
+	return lockstepFrames(unfused, fused, frames);
+}
+
+bool Conformance::checkCorpus(const std::string& directory) {
+	std::vector<std::filesystem::path> ROMs{};
+	std::error_code error{};
+	for (const auto& entry : std::filesystem::directory_iterator{ directory, error }) {
+		auto trace{ entry.path() };
+		if (entry.path().extension() == ".ch8" && std::filesystem::exists(trace.replace_extension(".trace"))) {
+			ROMs.push_back(entry.path());
+		}
+	}
+	// an empty corpus would prove nothing
+	if (ROMs.empty()) {
+		std::cerr << "Error no <name>.ch8 with a <name>.trace in directory " << directory << " !" << std::endl;
+		return false;
+	}
+	std::sort(ROMs.begin(), ROMs.end());
+	std::size_t failures{ 0u };
+	for (const auto& ROM : ROMs) {
+		auto trace{ ROM };
+		bool passed{ check(ROM.string(), trace.replace_extension(".trace").string()) };
+		std::ifstream ROMfile{ ROM, std::ios_base::binary };
+		const std::vector<CPU::byte_t> image(std::istreambuf_iterator<char>{ ROMfile }, std::istreambuf_iterator<char>{});
+		if (const auto divergence{ checkFusion(image.data(), image.size(), fusionFrames) }) {
+			printDivergence(ROM.string(), *divergence);
+			passed = false;
+		}
+		failures += !passed;
+		std::cout << (passed ? "PASS " : "FAIL ") << ROM.filename().string() << std::endl;
+	}
+	const auto fusion{ checkFusion(fusionROM.data(), fusionROM.size(), fusionFrames) };
+	if (fusion) {
+		printDivergence("built-in fusion ROM", *fusion);
+	}
+	std::cout << (fusion ? "FAIL " : "PASS ") << "built-in fusion ROM" << std::endl;
+	std::cout << ROMs.size() - failures << '/' << ROMs.size() << " ROMs conform" << (fusion ? ", fusion doesn't" : "") << std::endl;
+	return failures == 0u && !fusion;
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "cpu.hpp"
+#include "hash.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// Headless conformance checks, to change the core without changing its behaviour.
+//
+// A golden trace is a text file recorded from a known good build, one line per event :
+//	chip8-trace <version> <ROM hash> <frames>		header
+//	I <pc> <opcode> <state hash>					after each executed opcode
+//	F <frame> <screen hash> <registers>				after each frame
+//	E <frame>										if the ROM ended before the last frame
+// Checking a trace runs the ROM again and reports the first line which differs.
+//
+// The corpus directory holds small test ROMs with their traces, checked by : Chip8 --conformance corpus
+//	ops.ch8		arithmetic and logic, BCD, FX55/FX65, FX1E, timers, sprites, a call, key skips and CXNN
+//	rnd.ch8		CXNN with the fixed seed drawing font sprites
+//	walk.ch8	a font sprite moving across the screen and wrapping
+// After a deliberate change of behaviour, record them again : Chip8 --trace-record corpus/<name>.trace corpus/<name>.ch8
+class Conformance {
+public:
+	static constexpr unsigned version{ 1u };
+	static constexpr std::uint32_t seed{ 0xC8C8C8C8u }; // CXNN seed of every run, so that traces are reproducible
+
+	struct Divergence {
+		std::size_t	frame;
+		std::size_t	instruction;	// index in the frame, CPU::opcodesPerFrame if found at the end of the frame
+		std::string	what;
+	};
+
+	static bool record(const std::string& ROM, const std::string& tracePath, std::size_t frames);
+
+	// returns false and prints the first divergence if the ROM doesn't behave as in the trace
+	static bool check(const std::string& ROM, const std::string& tracePath);
+
+	// checks every <name>.ch8 of <directory> which has a <name>.trace next to it
+	// then runs each of them, and a built-in ROM going through every CPU::Fusion and its guards, with and without fusion
+	static bool checkCorpus(const std::string& directory);
+
+	// runs <image> on a fused CPU and on an unfused one, and compares them after each frame
+	static std::optional<Divergence> checkFusion(const CPU::byte_t* image, std::size_t size, std::size_t frames);
+
+	template <typename Engine>
+	static std::uint64_t stateHash(const Engine& engine) noexcept {
+		const auto& memory{ engine.getMemory() };
+		const auto registers{ engine.registers() };
+		const auto frame{ engine.getScreen().frame() };
+		const unsigned char scalars[]{
+			static_cast<unsigned char>(registers.I >> 8), static_cast<unsigned char>(registers.I),
+			static_cast<unsigned char>(registers.pc >> 8), static_cast<unsigned char>(registers.pc),
+			registers.gameTimer, registers.soundTimer, registers.stackSize
+		};
+		std::uint64_t hash{ fnv1a(memory.data(), memory.size()) };
+		hash = fnv1a(registers.V.data(), registers.V.size(), hash);
+		hash = fnv1a(scalars, sizeof(scalars), hash);
+		return fnv1a(reinterpret_cast<const unsigned char*>(frame.data()), sizeof(frame), hash);
+	}
+
+	// runs two engines instruction by instruction and compares their whole state after each one
+	// an engine needs step(), endFrame(), registers(), getMemory() and getScreen(), as CPU
+	template <typename Reference, typename Candidate>
+	static std::optional<Divergence> lockstep(Reference& reference, Candidate& candidate, std::size_t frames) {
+		for (std::size_t frame{ 0u }; frame < frames; frame++) {
+			for (std::size_t instruction{ 0u }; instruction < CPU::opcodesPerFrame; instruction++) {
+				const bool referenceRunning{ reference.step() };
+				if (referenceRunning != candidate.step()) {
+					return Divergence{ frame, instruction, referenceRunning ? "candidate stopped" : "candidate didn't stop" };
+				}
+				if (!referenceRunning) {
+					return std::nullopt;
+				}
+				if (auto what{ compare(reference, candidate) }) {
+					return Divergence{ frame, instruction, std::move(*what) };
+				}
+			}
+			reference.endFrame();
+			candidate.endFrame();
+			if (auto what{ compare(reference, candidate) }) {
+				return Divergence{ frame, CPU::opcodesPerFrame, std::move(*what) };
+			}
+		}
+		return std::nullopt;
+	}
+
+	// runs two engines frame by frame and compares their whole state after each frame, for engines which only run whole frames
+	// or whose instructions don't match one to one (recompiled ROMs, fusion); an engine needs stepFrame(), registers(), getMemory() and getScreen()
+	template <typename Reference, typename Candidate>
+	static std::optional<Divergence> lockstepFrames(Reference& reference, Candidate& candidate, std::size_t frames) {
+		for (std::size_t frame{ 0u }; frame < frames; frame++) {
+			const bool referenceRunning{ reference.stepFrame() };
+			if (referenceRunning != candidate.stepFrame()) {
+				return Divergence{ frame, CPU::opcodesPerFrame, referenceRunning ? "candidate stopped" : "candidate didn't stop" };
+			}
+			if (auto what{ compare(reference, candidate) }) {
+				return Divergence{ frame, CPU::opcodesPerFrame, std::move(*what) };
+			}
+			if (!referenceRunning) {
+				return std::nullopt;
+			}
+		}
+		return std::nullopt;
+	}
+
+	static std::string describe(const CPU::Registers& registers);
+
+private:
+	template <typename Reference, typename Candidate>
+	static std::optional<std::string> compare(const Reference& reference, const Candidate& candidate) {
+		const auto expected{ reference.registers() };
+		const auto actual{ candidate.registers() };
+		if (expected != actual) {
+			return "registers differ\n  expected " + describe(expected) + "\n  actual   " + describe(actual);
+		}
+		const auto& expectedMemory{ reference.getMemory() };
+		const auto& actualMemory{ candidate.getMemory() };
+		for (std::size_t address{ 0u }; address < expectedMemory.size(); address++) {
+			if (expectedMemory[address] != actualMemory[address]) {
+				return "memory differs at address " + std::to_string(address) + " (expected " + std::to_string(expectedMemory[address]) +
+					", actual " + std::to_string(actualMemory[address]) + ")";
+			}
+		}
+		if (reference.getScreen().frame() != candidate.getScreen().frame()) {
+			return "screens differ";
+		}
+		return std::nullopt;
+	}
+};
\ No newline at end of file
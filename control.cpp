@@ -0,0 +1,259 @@
+#include "control.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace {
+	using byte_t = ControlServer::byte_t;
+
+	// bytes read at once, a batch larger than that is simply handled in several reads
+	constexpr std::size_t readSize{ 0x10000 };
+
+	template <typename T>
+	void put(std::vector<byte_t>& out, T value) {
+		for (std::size_t byte{ 0u }; byte < sizeof(T); byte++) {
+			out.push_back(static_cast<byte_t>(static_cast<std::uint64_t>(value) >> (8u * byte)));
+		}
+	}
+
+	template <typename T>
+	T get(const byte_t* in) noexcept {
+		std::uint64_t value{ 0u };
+		for (std::size_t byte{ 0u }; byte < sizeof(T); byte++) {
+			value |= static_cast<std::uint64_t>(in[byte]) << (8u * byte);
+		}
+		return static_cast<T>(value);
+	}
+}
+
+ControlServer::ControlServer(CPU& cpu) : cpu_{ cpu } {}
+
+ControlServer::~ControlServer() {
+	close();
+}
+
+bool ControlServer::open(const std::string& path) {
+	close();
+#ifdef _WIN32
+	std::cerr << "Error control server on a unix socket isn't supported on Windows !" << std::endl;
+	return false;
+#else
+	sockaddr_un address{};
+	address.sun_family = AF_UNIX;
+	if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+		std::cerr << "Error control socket path " << std::quoted(path) << " is empty or too long !" << std::endl;
+		return false;
+	}
+	path.copy(address.sun_path, path.size());
+	unlink(path.c_str()); // a previous run may have crashed without removing it
+	socket_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	if (socket_ < 0 || bind(socket_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || listen(socket_, 1) != 0) {
+		std::cerr << "Error cannot listen on control socket " << std::quoted(path) << " !" << std::endl;
+		close();
+		return false;
+	}
+	path_ = path;
+	return true;
+#endif
+}
+
+void ControlServer::close() noexcept {
+#ifndef _WIN32
+	if (socket_ >= 0) {
+		::close(socket_);
+	}
+	if (!path_.empty()) {
+		unlink(path_.c_str());
+	}
+#endif
+	socket_ = -1;
+	path_.clear();
+}
+
+bool ControlServer::load(const std::string& ROM) {
+	std::ifstream ROMfile{ ROM, std::ios_base::binary };
+	if (!ROMfile) {
+		std::cerr << "Error cannot open ROM " << ROM << " !" << std::endl;
+		return false;
+	}
+	const std::vector<byte_t> image(std::istreambuf_iterator<char>{ ROMfile }, std::istreambuf_iterator<char>{});
+	if (!loadImage(image.data(), image.size())) {
+		std::cerr << "Error ROM " << ROM << " is empty or too big (" << image.size() << " bytes) !" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool ControlServer::loadImage(const byte_t* image, std::size_t size) {
+	if (size == 0u || !cpu_.loadImage(image, size)) {
+		return false;
+	}
+	ROM_.assign(image, image + size);
+	return true;
+}
+
+void ControlServer::serve() {
+#ifndef _WIN32
+#ifdef MSG_NOSIGNAL
+	constexpr int flags{ MSG_NOSIGNAL }; // a client closing early mustn't kill the emulator with SIGPIPE
+#else
+	constexpr int flags{ 0 };
+#endif
+	std::vector<byte_t> input{};
+	std::vector<byte_t> output{};
+	while (isOpen()) {
+		const int client{ accept(socket_, nullptr, nullptr) };
+		if (client < 0) {
+			std::cerr << "Error cannot accept control clients on " << std::quoted(path_) << " !" << std::endl;
+			return;
+		}
+		input.clear();
+		for (bool connected{ true }; connected;) {
+			const std::size_t pending{ input.size() };
+			input.resize(pending + readSize);
+			const auto received{ recv(client, input.data() + pending, readSize, 0) };
+			input.resize(pending + (received > 0 ? static_cast<std::size_t>(received) : 0u));
+			connected = received > 0;
+			if (!connected) {
+				break;
+			}
+
+			output.clear();
+			const auto consumed{ handle(input.data(), input.size(), output) };
+			if (consumed) {
+				input.erase(input.begin(), input.begin() + static_cast<std::ptrdiff_t>(*consumed));
+			}
+			// the requests before a bad length were executed, their responses are sent before dropping the client
+			for (std::size_t sent{ 0u }; connected && sent < output.size();) {
+				const auto written{ send(client, output.data() + sent, output.size() - sent, flags) };
+				connected = written > 0;
+				sent += connected ? static_cast<std::size_t>(written) : 0u;
+			}
+			if (!consumed) {
+				std::cerr << "Error control request too long, client dropped !" << std::endl;
+				connected = false;
+			}
+		}
+		::close(client);
+	}
+#endif
+}
+
+std::optional<std::size_t> ControlServer::handle(const byte_t* input, std::size_t size, std::vector<byte_t>& output) {
+	std::size_t consumed{ 0u };
+	std::vector<byte_t> result{};
+	while (size - consumed >= lengthSize) {
+		const std::size_t length{ get<std::uint32_t>(input + consumed) };
+		if (length > maxRequestSize) {
+			return std::nullopt;
+		}
+		if (size - consumed - lengthSize < length) {
+			break; // the rest comes with the next read
+		}
+		const byte_t* const request{ input + consumed + lengthSize };
+		result.clear();
+		const Status status{ length == 0u ? invalid : execute(static_cast<Command>(request[0]), request + 1, length - 1u, result) };
+		put(output, static_cast<std::uint32_t>(1u + result.size()));
+		output.push_back(status);
+		output.insert(output.end(), result.cbegin(), result.cend());
+		consumed += lengthSize + length;
+	}
+	return consumed;
+}
+
+ControlServer::Status ControlServer::execute(Command command, const byte_t* arguments, std::size_t size, std::vector<byte_t>& result) {
+	switch (command) {
+	case loadRom:
+		return loadImage(arguments, size) ? ok : invalid;
+	case reset:
+		return size == 0u && !ROM_.empty() && cpu_.loadImage(ROM_.data(), ROM_.size()) ? ok : invalid;
+	case stepInstructions:
+	case stepFrames: {
+		if (size != sizeof(std::uint32_t)) {
+			return invalid;
+		}
+		const auto count{ get<std::uint32_t>(arguments) };
+		std::uint32_t done{ 0u };
+		while (done < count && (command == stepInstructions ? cpu_.stepOpcode() : cpu_.stepFrame())) {
+			done++;
+		}
+		put(result, done);
+		return done < count ? halted : ok;
+	}
+	case setKeys:
+		if (size != sizeof(std::uint16_t)) {
+			return invalid;
+		}
+		cpu_.setKeys(get<std::uint16_t>(arguments));
+		return ok;
+	case registers: {
+		if (size != 0u) {
+			return invalid;
+		}
+		const auto state{ cpu_.registers() };
+		result.insert(result.end(), state.V.cbegin(), state.V.cend());
+		put(result, state.I);
+		put(result, state.pc);
+		put(result, state.gameTimer);
+		put(result, state.soundTimer);
+		put(result, state.stackSize);
+		put(result, static_cast<byte_t>(cpu_.fault()));
+		return ok;
+	}
+	case readMemory: {
+		if (size != 2u * sizeof(std::uint16_t)) {
+			return invalid;
+		}
+		const std::size_t address{ get<std::uint16_t>(arguments) };
+		const std::size_t length{ get<std::uint16_t>(arguments + sizeof(std::uint16_t)) };
+		if (address + length > CPU::memorySize) {
+			return invalid;
+		}
+		const auto& memory{ cpu_.getMemory() };
+		result.insert(result.end(), memory.cbegin() + address, memory.cbegin() + address + length);
+		return ok;
+	}
+	case framebuffer:
+		if (size != 0u) {
+			return invalid;
+		}
+		for (const auto row : cpu_.frame()) {
+			put(result, row);
+		}
+		return ok;
+	case saveState:
+	case loadState: {
+		if (size != 1u || arguments[0] >= stateSlots) {
+			return invalid;
+		}
+		auto& slot{ states_[arguments[0]] };
+		if (command == saveState) {
+			slot = cpu_.snapshot();
+		}
+		else if (slot) {
+			cpu_.restore(*slot);
+		}
+		else {
+			return invalid;
+		}
+		return ok;
+	}
+	}
+	return invalid;
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "cpu.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// Lets another process (e.g. a test harness) drive a headless CPU through a unix domain socket.
+// Clients are served one after the other. A request is a little-endian u32 length, then <length> bytes : a Command and its arguments.
+// A response is a little-endian u32 length, then <length> bytes : a Status and its result. Requests are pipelined :
+// a client may send any number of them before reading, every complete request received at once is executed in order
+// and their responses go back in a single write, so that a whole batch costs one round trip.
+//	Command				arguments				result
+//	loadRom				ROM image				-
+//	reset				-						-						reloads the last ROM
+//	stepInstructions	u32 count				u32 executed			halted if the program ended before
+//	stepFrames			u32 count				u32 stepped				halted if the program ended before
+//	setKeys				u16 keys				-						bit N = key N held
+//	registers			-						V0..VF, u16 I, u16 pc, u8 gameTimer, u8 soundTimer, u8 stackSize, u8 fault
+//	readMemory			u16 address, u16 size	<size> bytes			address + size <= CPU::memorySize
+//	framebuffer			-						32 u64 rows				most significant bit = leftmost pixel
+//	saveState			u8 slot					-						slot < stateSlots, states stay on the server
+//	loadState			u8 slot					-
+// stepInstructions runs opcodes within the current frame : timers tick and the screen is recorded once a frame's worth ran,
+// and stepFrames first finishes the frame they started, so that instruction steps and frame steps mix without changing the timing.
+// Integers are little-endian. A request the server can't execute answers invalid and changes nothing; the connection is
+// only dropped if a length is above maxRequestSize, since the stream can't be trusted anymore.
+class ControlServer {
+public:
+	using byte_t = CPU::byte_t;
+
+	enum Command : byte_t {
+		loadRom = 1,
+		reset,
+		stepInstructions,
+		stepFrames,
+		setKeys,
+		registers,
+		readMemory,
+		framebuffer,
+		saveState,
+		loadState
+	};
+
+	enum Status : byte_t {
+		ok,
+		halted,		// nothing left to emulate, the result is still valid
+		invalid		// unknown command, wrong arguments, empty slot...
+	};
+
+	static constexpr std::size_t stateSlots{ 16u };
+	static constexpr std::size_t maxRequestSize{ 1u + CPU::memoryUsableSize };
+	static constexpr std::size_t lengthSize{ sizeof(std::uint32_t) };
+
+private:
+	CPU&										cpu_;
+	std::vector<byte_t>							ROM_{};		// the last image loaded, for reset
+	std::array<std::optional<CPU::State>, stateSlots>	states_{};
+
+	int											socket_{ -1 };
+	std::string									path_{};
+
+	bool loadImage(const byte_t* image, std::size_t size);
+
+	Status execute(Command command, const byte_t* arguments, std::size_t size, std::vector<byte_t>& result);
+
+public:
+	explicit ControlServer(CPU& cpu);
+
+	ControlServer(const ControlServer&)				= delete;
+	ControlServer(ControlServer&&)					= delete;
+
+	ControlServer& operator=(const ControlServer&)	= delete;
+	ControlServer& operator=(ControlServer&&)		= delete;
+
+	~ControlServer();
+
+	// listens on <path>, replacing any socket file left there
+	bool open(const std::string& path);
+
+	// stops listening and removes the socket file
+	void close() noexcept;
+
+	inline bool isOpen() const noexcept {
+		return socket_ >= 0;
+	}
+
+	// loads a ROM file as loadRom would, e.g. one given on the command line
+	bool load(const std::string& ROM);
+
+	// serves clients until accept() fails
+	void serve();
+
+	// executes every complete request at the start of <input> and appends their responses to <output>
+	// returns how many bytes were consumed, or nullopt if a length is above maxRequestSize
+	// <output> then still holds the responses to the requests before it
+	std::optional<std::size_t> handle(const byte_t* input, std::size_t size, std::vector<byte_t>& output);
+};
\ No newline at end of file
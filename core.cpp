@@ -0,0 +1,73 @@
+#include "core.hpp"
+
+// Build-time checks of the opcode semantics : these ROMs run in Core while this file compiles.
+
+namespace {
+	using byte_t = Core::byte_t;
+
+	// V0 = 0xFF + 2 with carry, V2 = 1 - 2 with borrow, V3 = 0x81 << 1
+	constexpr std::array<byte_t, 16> arithmetic{
+		0x60, 0xFF, 0x61, 0x02, 0x80, 0x14, 0x62, 0x01, 0x82, 0x15, 0x63, 0x81, 0x83, 0x0E, 0x12, 0x0E
+	};
+
+	constexpr auto afterArithmetic{ Core::boot(arithmetic, 2u) };
+	static_assert(afterArithmetic.V[0x0] == 0x01 && afterArithmetic.V[0x2] == 0xFF && afterArithmetic.V[0x3] == 0x02);
+	static_assert(afterArithmetic.V[0xF] == 1u, "8XYE leaves the shifted out bit in VF");
+
+	// VA = 123 written as decimal digits at 0x300, then read back into V0 to V2
+	constexpr std::array<byte_t, 10> decimal{ 0x6A, 0x7B, 0xA3, 0x00, 0xFA, 0x33, 0xF2, 0x65, 0x12, 0x08 };
+
+	constexpr auto afterDecimal{ Core::boot(decimal, 2u) };
+	static_assert(afterDecimal.memory[0x300] == 1u && afterDecimal.memory[0x301] == 2u && afterDecimal.memory[0x302] == 3u);
+	static_assert(afterDecimal.V[0x0] == 1u && afterDecimal.V[0x1] == 2u && afterDecimal.V[0x2] == 3u);
+
+	// calls a subroutine setting V0, then loops on itself
+	constexpr std::array<byte_t, 10> subroutine{ 0x22, 0x06, 0x61, 0x01, 0x12, 0x04, 0x60, 0x02, 0x00, 0xEE };
+
+	constexpr auto afterSubroutine{ Core::boot(subroutine, 2u) };
+	static_assert(afterSubroutine.V[0x0] == 2u && afterSubroutine.V[0x1] == 1u);
+	static_assert(afterSubroutine.pc == 0x204 && afterSubroutine.stackSize == 0u);
+
+	// draws the top left pixel, then erases it with a collision
+	constexpr std::array<byte_t, 12> sprite{ 0xA2, 0x0A, 0x60, 0x00, 0x61, 0x00, 0xD0, 0x11, 0xD0, 0x11, 0x80, 0x00 };
+
+	static_assert(Core::boot(sprite, 1u).screen[0] == std::uint64_t{ 1 } << 63 && Core::boot(sprite, 1u).V[0xF] == 0u);
+	static_assert(Core::boot(sprite, 2u).screen[0] == 0u && Core::boot(sprite, 2u).V[0xF] == 1u);
+
+	// FX0A waits for a key, then the timer set with FX15 counts down once per frame
+	constexpr std::array<byte_t, 8> waitKey{ 0xF1, 0x0A, 0x62, 0x05, 0xF2, 0x15, 0x12, 0x06 };
+
+	static_assert(Core::boot(waitKey, 3u).pc == 0x200 && Core::boot(waitKey, 3u).gameTimer == 0u);
+
+	// RomPack::Quirk : each ROM below runs both ways
+	// V0 = 1, V1 = 6, then 8016
+	constexpr std::array<byte_t, 8> shift{ 0x60, 0x01, 0x61, 0x06, 0x80, 0x16, 0x12, 0x06 };
+
+	static_assert(Core::boot(shift, 1u).V[0x0] == 0u && Core::boot(shift, 1u).V[0xF] == 1u);
+	static_assert(Core::boot(shift, 1u, 1u, RomPack::shiftUsesVY).V[0x0] == 3u && Core::boot(shift, 1u, 1u, RomPack::shiftUsesVY).V[0xF] == 0u);
+
+	// VF = 5, then 8011
+	constexpr std::array<byte_t, 6> logic{ 0x6F, 0x05, 0x80, 0x11, 0x12, 0x04 };
+
+	static_assert(Core::boot(logic, 1u).V[0xF] == 5u && Core::boot(logic, 1u, 1u, RomPack::resetVF).V[0xF] == 0u);
+
+	// V2 = 2, then B208 lands on the loop at 0x208, or at 0x20A with V2 as offset
+	constexpr std::array<byte_t, 12> offsetJump{ 0x62, 0x02, 0xB2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x12, 0x08, 0x12, 0x0A };
+
+	static_assert(Core::boot(offsetJump, 1u).pc == 0x208 && Core::boot(offsetJump, 1u, 1u, RomPack::jumpUsesVX).pc == 0x20A);
+
+	// I = 0x300, then F255
+	constexpr std::array<byte_t, 6> store{ 0xA3, 0x00, 0xF2, 0x55, 0x12, 0x04 };
+
+	static_assert(Core::boot(store, 1u).I == 0x300 && Core::boot(store, 1u, 1u, RomPack::loadStoreIncrementsI).I == 0x303);
+
+	// a row of 8 pixels at x = 60 : continued on the next row, or cut at the right border
+	constexpr std::array<byte_t, 9> border{ 0x60, 0x3C, 0xA2, 0x08, 0xD0, 0x11, 0x12, 0x06, 0xFF };
+
+	static_assert(Core::boot(border, 1u).screen[0] == 0xFu && Core::boot(border, 1u).screen[1] == std::uint64_t{ 0xF } << 60);
+	static_assert(Core::boot(border, 1u, 1u, RomPack::clipSprites).screen[0] == 0xFu && Core::boot(border, 1u, 1u, RomPack::clipSprites).screen[1] == 0u);
+
+	// errors stop the machine
+	static_assert(Core::boot(std::array<byte_t, 2>{ 0x00, 0xEE }, 1u).fault == CPU::Fault::stackUnderflow);
+	static_assert(Core::boot(std::array<byte_t, 4>{ 0x60, 0xFF, 0xBF, 0xFF }, 1u).fault == CPU::Fault::jumpOutOfMemory);
+}
\ No newline at end of file
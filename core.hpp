@@ -0,0 +1,401 @@
+#pragma once
+
+#include "cpu.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// The instruction semantics on a CPU::State, without any I/O : CPU executes every opcode through execute(), and keeps
+// only logging, FX0A's wait for its window and its Pixels to itself. The whole machine can also run in constant expressions,
+// to check opcodes in static_assert or to run a boot sequence at compile time, then CPU::restore() its snapshot.
+// Constant evaluation is bounded by the compiler (-fconstexpr-ops-limit, /constexpr:steps), so keep ROMs and frame counts small.
+class Core {
+public:
+	using byte_t = CPU::byte_t;
+	using address_t = CPU::address_t;
+	using State = CPU::State;
+	using Fault = CPU::Fault;
+
+	// what Conformance::lockstep() expects from getScreen()
+	struct Screen {
+		::Screen::Frame frame_;
+
+		constexpr const ::Screen::Frame& frame() const noexcept {
+			return frame_;
+		}
+	};
+
+private:
+	static constexpr address_t pcIncrement{ 2u };
+
+	State state_{};
+	std::uint16_t quirks_{ RomPack::none };
+
+	static constexpr byte_t& mem(State& state, unsigned address) noexcept {
+		return state.memory[address & CPU::addressMask];
+	}
+
+	// flips a pixel of the packed screen, returns true if it was white
+	static constexpr bool flip(State& state, std::size_t index) noexcept {
+		auto& row{ state.screen[index / ::Screen::widthInPixels] };
+		const auto bit{ std::uint64_t{ 1 } << (::Screen::widthInPixels - 1u - index % ::Screen::widthInPixels) };
+		const bool white{ (row & bit) != 0u };
+		row ^= bit;
+		return white;
+	}
+
+public:
+	// the instruction semantics, shared by Core and CPU : <opcode> is executed on <state> as if read at pc
+	// recompiled ROMs call it with constant opcodes, so that it's inlined to the opcode's own code
+	// FX0A repeats itself until a key is held, as headless; CPU waits for its window instead when it has one
+	// <quirks> is a combination of RomPack::Quirk, vipTiming aside which is CPU's timing
+	static constexpr void execute(State& state, address_t opcode, std::uint16_t quirks = RomPack::none) noexcept {
+		auto& V{ state.V };
+		auto& I{ state.I };
+		auto& pc{ state.pc };
+		const byte_t X{ static_cast<byte_t>((opcode >> 8) & 0xF) };
+		const byte_t Y{ static_cast<byte_t>((opcode >> 4) & 0xF) };
+		const byte_t N{ static_cast<byte_t>(opcode & 0xF) };
+		const byte_t NN{ static_cast<byte_t>(opcode & 0xFF) };
+		const address_t NNN{ static_cast<address_t>(opcode & 0xFFF) };
+
+		switch (opcode >> 12) {
+		case 0x0:
+			if (opcode == 0x00E0) {
+				state.screen.fill(0u);
+			}
+			else if (opcode == 0x00EE) {
+				if (state.stackSize == 0u) {
+					state.fault = Fault::stackUnderflow;
+					return;
+				}
+				pc = state.stack[--state.stackSize];
+			}
+			break;
+		case 0x1:
+			pc = static_cast<address_t>(NNN - pcIncrement);
+			break;
+		case 0x2:
+			if (state.stackSize >= CPU::maxJumps) {
+				state.fault = Fault::stackOverflow;
+				return;
+			}
+			state.stack[state.stackSize++] = pc;
+			pc = static_cast<address_t>(NNN - pcIncrement);
+			break;
+		case 0x3:
+			pc += pcIncrement * (V[X] == NN);
+			break;
+		case 0x4:
+			pc += pcIncrement * (V[X] != NN);
+			break;
+		case 0x5:
+			if (N == 0x0) {
+				pc += pcIncrement * (V[X] == V[Y]);
+			}
+			break;
+		case 0x6:
+			V[X] = NN;
+			break;
+		case 0x7:
+			V[X] += NN;
+			break;
+		case 0x8:
+			switch (N) {
+			case 0x0: V[X] = V[Y]; break;
+			case 0x1: V[X] |= V[Y]; break;
+			case 0x2: V[X] &= V[Y]; break;
+			case 0x3: V[X] ^= V[Y]; break;
+			case 0x4:
+				V[0xF] = static_cast<unsigned>(V[X]) + V[Y] > 0xFF;
+				V[X] += V[Y];
+				break;
+			case 0x5:
+				V[0xF] = V[X] > V[Y];
+				V[X] -= V[Y];
+				break;
+			case 0x6:
+				if (quirks & RomPack::shiftUsesVY) {
+					V[X] = V[Y];
+				}
+				V[0xF] = V[X] & 0x01;
+				V[X] >>= 1;
+				break;
+			case 0x7:
+				V[0xF] = V[X] <= V[Y];
+				V[X] = static_cast<byte_t>(V[Y] - V[X]);
+				break;
+			case 0xE:
+				if (quirks & RomPack::shiftUsesVY) {
+					V[X] = V[Y];
+				}
+				V[0xF] = V[X] >> 7;
+				V[X] <<= 1;
+				break;
+			}
+			if (N >= 0x1 && N <= 0x3 && (quirks & RomPack::resetVF)) {
+				V[0xF] = 0;
+			}
+			break;
+		case 0x9:
+			if (N == 0x0) {
+				pc += pcIncrement * (V[X] != V[Y]);
+			}
+			break;
+		case 0xA:
+			I = NNN;
+			break;
+		case 0xB:
+		{
+			const byte_t offset{ V[quirks & RomPack::jumpUsesVX ? X : 0x0] };
+			if (offset + NNN >= CPU::memorySize) {
+				state.fault = Fault::jumpOutOfMemory;
+				return;
+			}
+			pc = static_cast<address_t>(offset + NNN - pcIncrement);
+			break;
+		}
+		case 0xC:
+			V[X] = static_cast<byte_t>(randomNumber(state, NN));
+			break;
+		case 0xD:
+			drawSprite(state, X, Y, N, quirks & RomPack::clipSprites);
+			break;
+		case 0xE:
+			if (NN == 0x9E) {
+				pc += pcIncrement * isPressed(state, V[X]);
+			}
+			else if (NN == 0xA1) {
+				pc += pcIncrement * !isPressed(state, V[X]);
+			}
+			break;
+		case 0xF:
+			switch (NN) {
+			case 0x07:
+				V[X] = state.gameTimer;
+				break;
+			case 0x0A:
+				if (!state.keys) {
+					pc -= pcIncrement;
+					break;
+				}
+				V[X] = static_cast<byte_t>(std::countr_zero(state.keys));
+				break;
+			case 0x15:
+				state.gameTimer = V[X];
+				break;
+			case 0x18:
+				state.soundTimer = V[X];
+				break;
+			case 0x1E:
+				V[0xF] = static_cast<unsigned long>(V[X]) + I > 0xFFF;
+				I += V[X];
+				break;
+			case 0x29:
+				I = static_cast<address_t>(CPU::fontSize * V[X]);
+				break;
+			case 0x33:
+				storeBcd(state, X);
+				break;
+			case 0x55:
+				storeRegisters(state, X);
+				if (quirks & RomPack::loadStoreIncrementsI) {
+					I += X + 1u;
+				}
+				break;
+			case 0x65:
+				loadRegisters(state, X);
+				if (quirks & RomPack::loadStoreIncrementsI) {
+					I += X + 1u;
+				}
+				break;
+			}
+			break;
+		}
+		pc += pcIncrement;
+	}
+
+	// DXYN, FX33, FX55 and FX65 on their own, for the fused handlers of CPU
+	// <clip> : the sprite starts at (VX, VY) modulo the screen size and is cut at its borders (RomPack::clipSprites)
+	static constexpr void drawSprite(State& state, byte_t X, byte_t Y, byte_t N, bool clip = false) noexcept {
+		auto& V{ state.V };
+		if (clip) {
+			constexpr std::size_t width{ ::Screen::widthInPixels };
+			constexpr std::size_t height{ ::Screen::heightInPixels };
+			const std::size_t x{ V[X] % width };
+			const std::size_t y{ V[Y] % height };
+			V[0xF] = 0;
+			for (std::size_t lineIndex{ 0u }; lineIndex < N && y + lineIndex < height; lineIndex++) {
+				const byte_t lineCode{ mem(state, state.I + lineIndex) };
+				for (std::size_t bitIndex{ 0u }; bitIndex < 8u && x + bitIndex < width; bitIndex++) {
+					if (((lineCode >> (7u - bitIndex)) & 1u) && flip(state, ::Screen::coordsToIndex(x + bitIndex, y + lineIndex))) {
+						V[0xF] = 1;
+					}
+				}
+			}
+			return;
+		}
+		V[0xF] = 0;
+		for (std::size_t lineIndex{ 0u }; lineIndex < N; lineIndex++) {
+			// like Screen, a row overflowing on the right continues on the next one
+			std::size_t screenIndex{ ::Screen::coordsToIndex(V[X], V[Y] + lineIndex) };
+			const byte_t lineCode{ mem(state, state.I + lineIndex) };
+			for (std::size_t bitIndex{ 0u }; bitIndex < 8u; bitIndex++, screenIndex++) {
+				if (((lineCode >> (7u - bitIndex)) & 1u) && screenIndex < ::Screen::size && flip(state, screenIndex)) {
+					V[0xF] = 1;
+				}
+			}
+		}
+	}
+
+	static constexpr void storeBcd(State& state, byte_t X) noexcept {
+		const auto value{ state.V[X] };
+		mem(state, state.I) = static_cast<byte_t>(value / 100);
+		mem(state, state.I + 1u) = static_cast<byte_t>((value % 100) / 10);
+		mem(state, state.I + 2u) = static_cast<byte_t>(value % 10);
+	}
+
+	static constexpr void storeRegisters(State& state, byte_t X) noexcept {
+		for (unsigned i{ 0u }; i <= X; i++) {
+			mem(state, state.I + i) = state.V[i];
+		}
+	}
+
+	static constexpr void loadRegisters(State& state, byte_t X) noexcept {
+		for (unsigned i{ 0u }; i <= X; i++) {
+			state.V[i] = mem(state, state.I + i);
+		}
+	}
+
+	static constexpr bool isPressed(const State& state, byte_t keycode) noexcept {
+		return (state.keys >> (keycode < 0x10 ? keycode : 0u)) & 1u;
+	}
+
+	// xorshift32 : cheap, and reproducible for a given seed
+	static constexpr address_t randomNumber(State& state, address_t max) noexcept {
+		auto& random{ state.random };
+		random ^= random << 13;
+		random ^= random >> 17;
+		random ^= random << 5;
+		return static_cast<address_t>(random % (max + 1u)); // result must be <= than max
+	}
+
+	constexpr void interpretOpcode(address_t opcode) noexcept {
+		execute(state_, opcode, quirks_);
+	}
+
+	// combination of RomPack::Quirk, kept by loadImage()
+	constexpr void setQuirks(std::uint16_t quirks) noexcept {
+		quirks_ = quirks;
+	}
+
+	// font loaded, pc at CPU::memoryStart and CXNN seeded with 1
+	constexpr Core() noexcept {
+		std::copy(CPU::font.cbegin(), CPU::font.cend(), state_.memory.begin());
+		state_.pc = CPU::memoryStart;
+		state_.random = 1u;
+	}
+
+	constexpr explicit Core(const State& state) noexcept : state_{ state } {}
+
+	// same as CPU::loadImage() : resets everything but the seed, returns false if the image is too big
+	constexpr bool loadImage(const byte_t* image, std::size_t size) noexcept {
+		if (size > CPU::memoryUsableSize) {
+			return false;
+		}
+		const auto random{ state_.random };
+		state_ = Core{}.state_;
+		state_.random = random;
+		std::copy(image, image + size, state_.memory.begin() + CPU::memoryStart);
+		return true;
+	}
+
+	constexpr void seed(std::uint32_t value) noexcept {
+		state_.random = value ? value : 1u;
+	}
+
+	// bit N of <keys> is Chip8 key N
+	constexpr void setKeys(std::uint16_t keys) noexcept {
+		state_.keys = keys;
+	}
+
+	constexpr bool isOver() const noexcept {
+		const auto& memory{ state_.memory };
+		return state_.fault != Fault::none || state_.pc > CPU::memorySize - pcIncrement ||
+			std::find_if(memory.cbegin() + state_.pc, memory.cend(), [](byte_t byte) { return byte != 0; }) == memory.cend();
+	}
+
+	constexpr bool step() noexcept {
+		if (isOver()) {
+			return false;
+		}
+		interpretOpcode(static_cast<address_t>(mem(state_, state_.pc) << 8 | mem(state_, state_.pc + 1u)));
+		return true;
+	}
+
+	constexpr void endFrame() noexcept {
+		state_.gameTimer -= state_.gameTimer > 0u;
+		state_.soundTimer -= state_.soundTimer > 0u;
+	}
+
+	constexpr bool stepFrame() noexcept {
+		for (auto opcode{ 0u }; opcode < CPU::opcodesPerFrame; opcode++) {
+			if (!step()) {
+				return false;
+			}
+		}
+		endFrame();
+		return true;
+	}
+
+	// as CPU::snapshot(), the unused part of the stack is 0
+	constexpr State snapshot() const noexcept {
+		State state{ state_ };
+		std::fill(state.stack.begin() + state.stackSize, state.stack.end(), address_t{ 0u });
+		return state;
+	}
+
+	constexpr CPU::Registers registers() const noexcept {
+		return { state_.V, state_.I, state_.pc, state_.gameTimer, state_.soundTimer, state_.stackSize };
+	}
+
+	constexpr const std::array<byte_t, CPU::memorySize>& getMemory() const noexcept {
+		return state_.memory;
+	}
+
+	constexpr Screen getScreen() const noexcept {
+		return { state_.screen };
+	}
+
+	constexpr Fault fault() const noexcept {
+		return state_.fault;
+	}
+
+	constexpr address_t pc() const noexcept {
+		return state_.pc;
+	}
+
+	// state of <image> after <frames> frames (or once it ended), to precompute a boot sequence :
+	//	static constexpr auto booted{ Core::boot(image, 30u) };
+	//	cpu.restore(booted);
+	template <std::size_t size>
+	static constexpr State boot(const std::array<byte_t, size>& image, std::size_t frames, std::uint32_t seed = 1u, std::uint16_t quirks = RomPack::none) noexcept {
+		static_assert(size <= CPU::memoryUsableSize, "the image doesn't fit in memory");
+		Core core{};
+		core.seed(seed);
+		core.setQuirks(quirks);
+		core.loadImage(image.data(), image.size());
+		for (std::size_t frame{ 0u }; frame < frames && core.stepFrame(); frame++) {}
+		return core.snapshot();
+	}
+};
\ No newline at end of file
@@ -1,677 +1,995 @@
-#include "cpu.hpp"
-
-#ifdef _MSC_VER
-#pragma warning(push, 0)
-#endif
-
-#include <string>
-#include <fstream>
-#include <iostream>
-#include <iomanip>
-#include <random>
-#include <chrono>
-#include <bitset>
-#include <sstream>
-#include <vector>
-#include <filesystem>
-#include <codecvt>
-
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
-
-constexpr std::string toString(const std::wstring& wstr) {
-	std::string result{};
-	result.reserve(wstr.size());
-	for (wchar_t wc : wstr) {
-		result += static_cast<char>(wc);
-	}
-	return result;
-}
-
-#define ROM_NAME(ROM)								toString(std::filesystem::path(ROM).filename().native())
-
-#define MSG_BASE(msg, code, ostream)				ostream << std::string(msg); if (std::string(code) != "") { ostream << " : " << (code); } ostream << " !" << std::endl
-
-#define WARNING(msg, code)							std::cout << "Warning "; MSG_BASE(msg, code, std::cout)
-#define ERROR(msg, code)							std::cerr << "Error "; MSG_BASE(msg, code, std::cerr)
-
-#define END_PROGRAM_MSG(msg, ROMname)				MSG_BASE("-- End of Emulation (" + (ROMname) + ") -- " + (msg), "", std::cout)
-#define END_PROGRAM_ERR(msg, ROMname, errorCode)	MSG_BASE("-- End of Emulation (" + (ROMname) + ") -- " + (msg), std::string(errorCode), std::cerr)
-
-#define QUIT_IF_NOTHING_TO_EMULATE    if (pc == memorySize || !isThereOpcodeAfter()) {END_PROGRAM_MSG("-- End of Program -- Emulation successfully ended !", ROMname); window.close(); break; break;}
-
-#ifndef NDEBUG
-#define ASSERT_MSG(expression, msg, errorCode) if (!(expression)) { ERROR("Assertion failed at line " + std::to_string(__LINE__) + " : " + std::string(msg), std::string(errorCode) == "" ? "ASSERTION_FAIL" : (errorCode)); std::terminate(); }
-#else
-#define ASSERT_MSG(expression, msg, errorCode) {}
-#endif
-
-// static cast to address type
-#define UCAST(expr) static_cast<address_t>((expr))
-
-// static cast to byte type
-#define BCAST(expr) static_cast<byte_t>((expr))
-
-#ifndef NDEBUG
-#define DEBUG_BASE(msg, ostream) ostream << "Opcode " << opcodeToStr(opcode) << " : " << (msg) << std::endl << std::endl
-#define DEBUG_CONSOLE(msg) DEBUG_BASE(msg, std::cout)
-
-#define DEBUG_FILE(msg)														\
-{																			\
-	std::ofstream log{ "results.log", std::ios::app };						\
-	if (!log) {																\
-		std::cerr << "Cannot create/open file results.log !" << std::endl;	\
-	}																		\
-	else {																	\
-		DEBUG_BASE(msg, log);												\
-	}																		\
-}
-
-#define DEBUG(msg) DEBUG_FILE(msg); DEBUG_CONSOLE(msg)
-#else
-#define DEBUG(msg)
-#endif
-
-#define PAUSE_IF_NOT_FOCUS(title) while (event.type == sf::Event::LostFocus) {window.setTitle("[Paused] -- " + title); while (event.type != sf::Event::GainedFocus) {window.pollEvent(event);} window.setTitle(title); break;}
-
-CPU::address_t CPU::randomNumber(address_t max) noexcept {
-	static std::random_device device{};
-#define NOW_TIME std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count()
-
-	static const auto firstCallTime{ NOW_TIME };
-	std::mt19937 generator{ static_cast<std::mt19937::result_type>(NOW_TIME - firstCallTime) };
-	std::uniform_int_distribution<address_t> distribution{ 0u, max };
-	return std::abs((distribution(generator) * distribution(generator)) ^ distribution(generator)) % (max + 1u); // result must be <= than max
-
-#undef NOW_TIME
-}
-
-void CPU::count() noexcept{
-	if (gameTimer) {
-		gameTimer--;
-	}
-	if (soundTimer) {
-		soundTimer--;
-	}
-}
-
-constexpr bool CPU::isOpcode(opcodeHex_t opcode) noexcept {
-	for (auto& results : opcodesAND) {
-		if ((opcode & results.first) == static_cast<int>(results.second)) {
-			return true;
-		}
-	}
-	return false;
-}
-
-CPU::opcodeHex_t CPU::nextOpcode() const {
-	const opcodeHex_t opcode{ UCAST((memory[pc] << 8) + memory[pc + 1u]) }; // static_cast to avoid overflow
-	ASSERT_MSG(isOpcode(opcode), "Found a bad opcode " + opcodeToStr(opcode) + ", when PC was " + std::to_string(pc) + " (= " + opcodeToStr(pc) + " in hex)", "BAD_OPCODE_FOUND");
-	return opcode;
-}
-
-void CPU::checkKeys() {
-	for (auto& key : keys) {
-		key.second = sf::Keyboard::isKeyPressed(static_cast<sf::Keyboard::Key>(key.first));
-	}
-}
-
-std::string CPU::opcodeToStr(opcodeHex_t opcode, std::size_t finalLength) {
-	std::ostringstream ostream{};
-	ostream << std::setw(finalLength) << std::setfill('0') << std::hex << std::uppercase << opcode;
-	return ostream.str();
-}
-
-constexpr bool CPU::isThereOpcodeAfter() const noexcept {
-	return std::find_if(memory.cbegin() + pc, memory.cend(), [](byte_t opcode) {return opcode != 0; /* 0 because memory is filled with 0s if the game file is < than memoryUsableSize */ }) != memory.cend();
-}
-
-void CPU::initializeFonts() {
-	// see here for further informations : http://devernay.free.fr/hacks/chip8/C8TECH10.HTM#font
-	const auto writeFont{
-		[this](std::size_t number, std::array<address_t, fontSize>&& values) {
-			number *= fontSize; // if 1, writes from index 5, 10 for 2, 15 for 3 and so on
-			for (auto&& value : values) {
-				memory[number++] = static_cast<byte_t>(value);
-			}
-		}
-	};
-	/*
-	11110000 -> 0xF0
-	10010000 -> 0x90
-	10010000 -> 0x90
-	10010000 -> 0x90
-	11110000 -> 0xF0
-	*/
-	writeFont(0x0, { 0xF0, 0x90, 0x90, 0x90, 0xF0 });
-	writeFont(0x1, { 0x20, 0x60, 0x20, 0x20, 0x70 });
-	writeFont(0x2, { 0xF0, 0x10, 0xF0, 0x80, 0xF0 });
-	writeFont(0x3, { 0xF0, 0x10, 0xF0, 0x10, 0xF0 });
-	writeFont(0x4, { 0x90, 0x90, 0xF0, 0x10, 0xF0 });
-	writeFont(0x5, { 0xF0, 0x80, 0xF0, 0x10, 0xF0 });
-	writeFont(0x6, { 0xF0, 0x80, 0xF0, 0x90, 0xF0 });
-	writeFont(0x7, { 0xF0, 0x10, 0x20, 0x40, 0x40 });
-	writeFont(0x8, { 0xF0, 0x90, 0xF0, 0x90, 0xF0 });
-	writeFont(0x9, { 0xF0, 0x90, 0xF0, 0x10, 0xF0 });
-	writeFont(0xA, { 0xF0, 0x90, 0xF0, 0x90, 0x90 });
-	writeFont(0xB, { 0xE0, 0x90, 0xE0, 0x90, 0xE0 });
-	writeFont(0xC, { 0xF0, 0x80, 0x80, 0xF0, 0xF0 });
-	writeFont(0xD, { 0xE0, 0x90, 0x90, 0x90, 0xE0 });
-	writeFont(0xE, { 0xF0, 0x80, 0xF0, 0x80, 0xF0 });
-	writeFont(0xF, { 0xF0, 0x80, 0xF0, 0x80, 0x80 });
-}
-
-CPU::Chip8Key CPU::byteToChip8Key(byte_t keycode) {
-	using enum Chip8Key;
-	try {
-		return std::unordered_map<byte_t, Chip8Key>{
-			{ BCAST(0x0), _0 },
-			{ BCAST(0x1), _1 },
-			{ BCAST(0x2), _2 },
-			{ BCAST(0x3), _3 },
-			{ BCAST(0x4), _4 },
-			{ BCAST(0x5), _5 },
-			{ BCAST(0x6), _6 },
-			{ BCAST(0x7), _7 },
-			{ BCAST(0x8), _8 },
-			{ BCAST(0x9), _9 },
-			{ BCAST(0xA), _A },
-			{ BCAST(0xB), _B },
-			{ BCAST(0xC), _C },
-			{ BCAST(0xD), _D },
-			{ BCAST(0xE), _E },
-			{ BCAST(0xF), _F },
-		}.at(keycode);
-	}
-	catch (std::out_of_range&) {
-		ASSERT_MSG(false, "Cannot find key corresponding at byte " + opcodeToStr(keycode) + ", value stored in a V register. Check opcodes EX9E, EXA1 !", "BAD_KEY_IN_VX");
-		return _0;
-	}
-}
-
-char CPU::chip8KeyName(sf::Keyboard::Key key) noexcept {
-#define KEYCAST(chip8Key) static_cast<long>(static_cast<sf::Keyboard::Key>(chip8Key))
-	using enum Chip8Key;
-	static const std::array<long, 0x10> keys{
-		KEYCAST(_0),
-		KEYCAST(_1),
-		KEYCAST(_2),
-		KEYCAST(_3),
-		KEYCAST(_4),
-		KEYCAST(_5),
-		KEYCAST(_6),
-		KEYCAST(_7),
-		KEYCAST(_8),
-		KEYCAST(_9),
-		KEYCAST(_A),
-		KEYCAST(_B),
-		KEYCAST(_C),
-		KEYCAST(_D),
-		KEYCAST(_E),
-		KEYCAST(_F)
-	};
-#undef KEYCAST
-	const auto pos{ std::find(keys.cbegin(), keys.cend(), static_cast<long>(key)) - keys.cend() };
-	if (pos < 10u) { // digit
-		return static_cast<char>('0' + pos);
-	}
-	if (pos < 0x10) { // letter
-		return static_cast<char>('A' + pos);
-	}
-	// bad key param
-	return '?';
-}
-
-void CPU::interpretOpcode(opcodeHex_t opcode) {
-	const auto toOpcode{
-		[opcode] {
-			for (auto& results : opcodesAND) {
-				const bool is0NNN{ results == opcodesAND[0] };
-				if ((opcode & results.first) == static_cast<int>(results.second)) {
-					if (is0NNN && (opcode & opcodesAND[1].first) != static_cast<int>(opcodesAND[1].second) && (opcode & opcodesAND[2].first) != static_cast<int>(opcodesAND[2].second)) {
-						return results.second; // opcode is 0NNN if and only if opcode != 00EE or 00EE
-					}
-					if (!is0NNN) {
-						return results.second;
-					}
-				}
-			}
-			ASSERT_MSG(false, "Unexpected execution path in void CPU::interpretOpcode::lambda toOpcode with opcode \"" + opcodeToStr(opcode) + "\"", "UNKNOWN_OPCODE");
-			return Opcode::_0NNN; // 0NNN does nothing
-		}
-	};
-
-	const std::array<byte_t, 4> bits{
-			BCAST((opcode & mask_t{0xF000}) >> 12),
-			BCAST((opcode & mask_t{0x0F00}) >> 8),
-			BCAST((opcode & mask_t{0x00F0}) >> 4),
-			BCAST( opcode & mask_t{0x000F})
-	};
-
-	const byte_t	  X{ bits[1] };
-	const byte_t	  Y{ bits[2] };
-	const byte_t	  N{ bits[3] };
-	const byte_t     NN{ BCAST((Y << 4) | N) };
-	const address_t NNN{ UCAST((X << 8) | NN) };
-
-#ifndef NDEBUG
-#define		 X_DEBUG	opcodeToStr(UCAST(X),    1u)
-#define		VX_DEBUG	opcodeToStr(UCAST(V[X]), 2u)
-#define		 Y_DEBUG	opcodeToStr(UCAST(Y),    1u)
-#define		 N_DEBUG	opcodeToStr(UCAST(N),    1u)
-#define		NN_DEBUG	opcodeToStr(UCAST(NN),   2u)
-#define	   NNN_DEBUG	opcodeToStr(UCAST(NNN),  3u)
-#define		PC_DEBUG	opcodeToStr(UCAST(pc)      )
-#define		 I_DEBUG	opcodeToStr(UCAST(I)       )
-#define		OP_DEBUG	opcodeToStr(UCAST((memory[pc] << 8) | memory[pc + 1u]))
-#define NEXTOP_DEBUG	opcodeToStr(UCAST((memory[pc + 2u] << 8) | memory[pc + 3u]))
-#else
-#define		 X_DEBUG	""
-#define		VX_DEBUG	""
-#define		 Y_DEBUG	""
-#define		 N_DEBUG	""
-#define		NN_DEBUG	""
-#define	   NNN_DEBUG	""
-#define		PC_DEBUG	""
-#define		 I_DEBUG	""
-#define		OP_DEBUG	""
-#define NEXTOP_DEBUG	""
-#endif
-
-	switch (toOpcode()) {
-		using enum Opcode;
-
-	case _0NNN:
-		// not used nor needed
-		DEBUG("Historically, called RCA 1082's routine at address " + NNN_DEBUG + " (Not used in modern implementations as this)");
-		break;
-
-	case _00E0:
-		screen.erase();
-		DEBUG("Screen erased");
-		break;
-
-	case _00EE:
-		ASSERT_MSG(jumps.size() > 0, "Cannot return from a subroutine because the call stack is empty ! PC was " + std::to_string(pc) + " (= " + opcodeToStr(pc) + " in hex)", "EMPTY_CALL_STACK_SUBROUTINE_RETURN");
-		pc = jumps.top();
-		DEBUG("Returned from subroutine " + PC_DEBUG);
-		jumps.pop();
-		break;
-
-	case _1NNN:
-	{
-		enum class Loop {
-			// not in loop
-			none,
-			// first time in loop
-			first,
-			// in the loop
-			in
-		};
-		static Loop loop{ Loop::none };
-		if (loop == Loop::none) {
-			DEBUG("Jumped at address " + NNN_DEBUG);
-			if (pc == NNN) {
-					loop = Loop::first;
-				}
-		}
-		else if (loop == Loop::first) {
-			DEBUG("Address didn't change (still " + PC_DEBUG + "), may result into an infinite loop");
-			if (pc == NNN) {
-				loop = Loop::in;
-			}
-		}
-		// loop::in not handled to avoid unfinite writing into the log/console
-		pc = NNN - pcIncrement;
-	}
-	break;
-
-	case _2NNN:
-		jumps.push(pc);
-		pc = NNN - pcIncrement;
-		DEBUG("Called subroutine at address " + PC_DEBUG);
-		break;
-
-	case _3XNN:
-		pc += pcIncrement * (V[X] == NN);
-		if (V[X] == NN) {
-			DEBUG('V' + X_DEBUG + " == " + NN_DEBUG + ", skips instruction " + OP_DEBUG);
-		}
-		else {
-			DEBUG('V' + X_DEBUG + " != " + NN_DEBUG + ", doesn't skip instruction " + NEXTOP_DEBUG);
-		}
-		break;
-
-	case _4XNN:
-		pc += pcIncrement * (V[X] != NN);
-		if (V[X] != NN) {
-			DEBUG('V' + X_DEBUG + " != " + NN_DEBUG + ", skips instruction " + OP_DEBUG);
-		}
-		else {
-			DEBUG('V' + X_DEBUG + " == " + NN_DEBUG + ", doesn't skip instruction " + NEXTOP_DEBUG);
-		}
-		break;
-
-	case _5XY0:
-		pc += pcIncrement * (V[X] == V[Y]);
-		if (V[X] == NN) {
-			DEBUG('V' + X_DEBUG + " == V" + Y_DEBUG + ", skips instruction " + OP_DEBUG);
-		}
-		else {
-			DEBUG('V' + X_DEBUG + " != V" + Y_DEBUG + ", doesn't skip instruction " + NEXTOP_DEBUG);
-		}
-		break;
-
-	case _6XNN:
-		V[X] = BCAST(NN);
-		DEBUG('V' + X_DEBUG + " = " + NN_DEBUG);
-		break;
-
-	case _7XNN:
-		V[X] += BCAST(NN);
-		DEBUG('V' + X_DEBUG + " += " + NN_DEBUG + ", is now equal to " + VX_DEBUG);
-		break;
-
-	case _8XY0:
-		V[X] = V[Y];
-		DEBUG('V' + X_DEBUG + " = V" + Y_DEBUG + " (= " + VX_DEBUG + ')');
-		break;
-
-	case _8XY1:
-		V[X] |= V[Y];
-		DEBUG('V' + X_DEBUG + " |= V" + Y_DEBUG + ", is now equal to " + VX_DEBUG);
-		break;
-
-	case _8XY2:
-		V[X] &= V[Y];
-		DEBUG('V' + X_DEBUG + " &= V" + Y_DEBUG + ", is now equal to " + VX_DEBUG);
-		break;
-
-	case _8XY3:
-		V[X] ^= V[Y];
-		DEBUG('V' + X_DEBUG + " ^= V" + Y_DEBUG + ", is now equal to " + VX_DEBUG);
-		break;
-
-	case _8XY4:
-		V[0xF] = static_cast<unsigned>(V[X]) + V[Y] > 0xFF;
-		V[X] += V[Y];
-		DEBUG('V' + X_DEBUG + " += V" + Y_DEBUG + ", is now equal to " + VX_DEBUG + ", VF is set to " + opcodeToStr(V[0xF], 2) + " (there " + (V[0xF] ? "was an overflow)" : "wasn't overflow)"));
-		break;
-
-	case _8XY5:
-		V[0xF] = V[X] > V[Y];
-		V[X] -= V[Y];
-		DEBUG('V' + X_DEBUG + " -= V" + Y_DEBUG + ", is now equal to " + VX_DEBUG + ", VF is set to " + opcodeToStr(V[0xF], 2) + " (there " + (V[0xF] ? "wasn't overflow (borrow))" : "was an overflow (borrow))"));
-		break;
-
-	case _8XY6:
-		V[0xF] = UCAST(V[X] & 0x01);
-		V[X] >>= 1;
-		DEBUG("VF = V" + X_DEBUG + " & 0x01 (= " + opcodeToStr(V[0xF], 2) + "), V" + X_DEBUG + " >>= 1, is now equal to " + VX_DEBUG);
-		break;
-
-	case _8XY7:
-		V[0xF] = V[X] <= V[Y];
-		V[X] = UCAST(V[Y] - V[X]);
-		DEBUG('V' + X_DEBUG + " = V" + Y_DEBUG + " - V" + X_DEBUG + ", is now equal to " + VX_DEBUG + ", VF is set to " + opcodeToStr(V[0xF], 2) + " (there " + (V[0xF] ? "wasn't overflow(borrow))" : "was an overflow(borrow))"));
-		break;
-
-	case _8XYE:
-		V[0xF] = UCAST(V[X] >> 7);
-		V[X] <<= 1;
-		DEBUG("VF = V" + X_DEBUG + " >> 7 (= " + opcodeToStr(V[0xF], 2) + "), V" + X_DEBUG + " <<= 1, is now equal to " + VX_DEBUG);
-		break;
-
-	case _9XY0:
-		pc += pcIncrement * (V[X] != V[Y]);
-		if (V[X] != NN) {
-			DEBUG('V' + X_DEBUG + " != V" + Y_DEBUG + ", skips instruction " + OP_DEBUG);
-		}
-		else {
-			DEBUG('V' + X_DEBUG + " == V" + Y_DEBUG + ", doesn't skip instruction " + NEXTOP_DEBUG);
-		}
-		break;
-
-	case _ANNN:
-		I = NNN;
-		DEBUG("I = " + NNN_DEBUG);
-		break;
-
-	case _BNNN:
-		pc = V[0x0] + NNN - pcIncrement;
-		DEBUG("PC = V0 + " + NNN_DEBUG + ", now is equal to " + PC_DEBUG);
-		break;
-
-	case _CXNN:
-		V[X] = BCAST(randomNumber(NN));
-		DEBUG('V' + X_DEBUG + " = random number < " + NN_DEBUG + ", nom is equal to " + VX_DEBUG);
-		break;
-
-	case _DXYN:
-		V[0xF] = 0;
-		for (std::size_t lineIndex{ 0u }; lineIndex < N; lineIndex++) {
-			std::size_t screenIndex{ Screen::coordsToIndex(V[X], V[Y] + lineIndex) };
-			const byte_t lineCode{ memory[I + lineIndex] };
-			for (auto charBit : std::bitset<8>(lineCode).to_string()) {
-				const bool bit{ charBit == '1' };
-				if (bit && screenIndex < Screen::size) { // out of bounds; because std::array::operator[] is noexcept, cannot catch a out-of-range exception
-					if (screen[screenIndex].isWhite() && !V[0xF]) { // saves collision once
-						V[0xF] = 1;
-					}
-					screen[screenIndex].flip();
-				}
-				screenIndex++;
-			}
-		}
-		DEBUG("Displayed font from address I = " + I_DEBUG + ", at coords (" + VX_DEBUG + " ; " + opcodeToStr(V[Y], 2) + "), with height = " + N_DEBUG);
-		break;
-
-	case _EXA1:
-		pc += pcIncrement * !keys[byteToChip8Key(V[X])];
-		if (!keys[byteToChip8Key(V[X])]) {
-			DEBUG("Key in V" + X_DEBUG + " (= " + VX_DEBUG + ") isn't pressed, skips instruction " + OP_DEBUG);
-		}
-		else {
-			DEBUG("Key in V" + X_DEBUG + " (= " + VX_DEBUG + ") is pressed, doesn't skip instruction " + NEXTOP_DEBUG);
-		}
-		break;
-
-	case _EX9E:
-		pc += pcIncrement * keys[byteToChip8Key(V[X])];
-		if (keys[byteToChip8Key(V[X])]) {
-			DEBUG("Key in V" + X_DEBUG + " (= " + VX_DEBUG + ") is pressed, skips instruction " + OP_DEBUG);
-		}
-		else {
-			DEBUG("Key in V" + X_DEBUG + " (= " + VX_DEBUG + ") isn't pressed, doesn't skip instruction " + NEXTOP_DEBUG);
-		}
-		break;
-
-	case _FX07:
-		V[X] = gameTimer;
-		DEBUG('V' + X_DEBUG + " = gameTimer, is now equal to " + opcodeToStr(gameTimer, 2));
-		break;
-
-	case _FX0A:
-	{
-		sf::Event event{};
-		while (window.isOpen()) {
-			if (!window.pollEvent(event)) { // event is default-initialzed to 0 (= sf::Event::Closed), so if pollEvent doesn't detect any event, the variable event stays to closed and the loop is exited
-				continue;
-			}
-			PAUSE_IF_NOT_FOCUS(ROM_);
-			if (event.type == sf::Event::Closed) {
-				window.close();
-				END_PROGRAM_ERR("User closes the emulator", ROM_, "USER_CLOSE");
-				continue;
-			}
-			else if (event.type == sf::Event::KeyPressed) {
-				const auto keyName{ chip8KeyName(event.key.code) };
-				if (keyName != '?') { // key is one of the Chip8 keyboard
-					V[X] = std::isdigit(keyName) ? keyName - '0' : keyName - 'A' + 10u; // + 10 because A will result into 0 (A - A), so we must count the 10 digits (A - A + 10 = 10, hex value of A)
-					keys[static_cast<Chip8Key>(V[X])] = true;
-					using namespace std::string_literals;
-					DEBUG("Key "s + keyName + " is pressed");
-					break;
-				}
-			}
-		}
-		break;
-	}
-
-	case _FX15:
-		gameTimer = V[X];
-		DEBUG("gameTimer = V" + X_DEBUG + ", is now equal to " + opcodeToStr(gameTimer, 2));
-		break;
-
-	case _FX18:
-		soundTimer = V[X];
-		DEBUG("gameTimer = V" + X_DEBUG + ", is now equal to " + opcodeToStr(gameTimer, 2));
-		break;
-
-	case _FX1E:
-		V[0xF] = static_cast<unsigned long>(V[X]) + I > 0xFFF;
-		I += V[X];
-		DEBUG("I += V" + X_DEBUG + ", is now equal to " + I_DEBUG);
-		break;
-
-	case _FX29:
-		I = fontSize * V[X]; // because fonts start at address 0
-		DEBUG("I = address of font in V" + X_DEBUG + " (= " + VX_DEBUG + "), is now equal to " + I_DEBUG);
-		break;
-
-	case _FX33:
-		memory[I] = BCAST(V[X] / 100);
-		memory[I + 1u] = BCAST((V[X] % 100) / 10);
-		memory[I + 2u] = BCAST(V[X] % 10);
-		DEBUG("address " + I_DEBUG + " of memory = " + opcodeToStr(memory[I]) +
-			"\naddress " + opcodeToStr(I + 1u) + " of memory = " + opcodeToStr(memory[I + 1u]) +
-			"\naddress " + opcodeToStr(I + 2u) + " of memory = " + opcodeToStr(memory[I + 2u]));
-		break;
-
-	case _FX55:
-	{
-		std::string debugText{};
-		for (address_t i{ 0u }; i <= X; i++) {
-			memory[UCAST(I + i)] = V[i];
-			if (i > 0) {
-				debugText += "\n";
-			}
-			debugText += "address " + opcodeToStr(UCAST(I + i)) + " of memory = " + opcodeToStr(memory[UCAST(I + i)]);
-		}
-		DEBUG(debugText);
-		break;
-	}
-
-	case _FX65:
-	{
-		std::string debugText{};
-		for (address_t i{ 0 }; i <= X; i++) {
-			V[i] = memory[UCAST(I + i)];
-			if (i > 0) {
-				debugText += ";\t";
-			}
-			debugText += 'V' + opcodeToStr(i, 1) + " is loaded from memory at address " + opcodeToStr(UCAST(I + i)) + ", is now equal to " + opcodeToStr(V[i]);
-		}
-		DEBUG(debugText);
-		break;
-	}
-
-	}
-	pc += pcIncrement;
-}
-
-bool CPU::loadGame(const std::string& ROM) {
-	const std::wstring extension{ std::filesystem::path(ROM).extension().native() };
-	if (extension != L".ch8") {
-		std::cerr << "Warning : file " << std::quoted(ROM) << " hasn't standard extension .ch8 !" << std::endl <<
-			"It may not be an usable Chip8 ROM file and may result into errors !" << std::endl <<
-			"If the file's correct, you should rename it to explicitly show that's a good file !" << std::endl;
-		char c{ '0' };
-		while (c != 'y' && c != 'n') {
-			std::cout << "Are you sure you want to continue (y/n) ?" << std::endl;
-			std::cin >> c;
-		}
-		if (c == 'n') {
-			std::cerr << "Loading aborted : USER_EXIT_WARNING" << std::endl;
-			return false;
-		}
-	}
-
-	ROM_ = ROM;
-
-	using uifstream = std::basic_ifstream<byte_t>;
-
-	uifstream ROMfile{ ROM, std::ios_base::binary };
-	if (!ROMfile) {
-		END_PROGRAM_ERR("File's loading failed", ROM, "FILE_NOT_FOUND !");
-		return false;
-	}
-	const auto ROMsize{ std::filesystem::file_size(ROM) };
-	if (ROMsize > memoryUsableSize) {
-		END_PROGRAM_ERR("File too big (" + std::to_string(ROMsize) + " bytes whereas max allowed size is " + std::to_string(memoryUsableSize) + " bytes)", ROM, "FILE_TOO_BIG");
-		std::cerr << "File too big (" << ROMsize << " bytes, max capacity is " << memoryUsableSize << ") !" << std::endl;
-		return false;
-	}
-	ROMfile.read(&memory[memoryStart], static_cast<std::streamsize>(ROMsize));
-	return true;
-}
-
-void CPU::emulate(const std::string& ROMpath) {
-	ROM_ = ROMpath;
-	if (!loadGame(ROMpath)) {
-		END_PROGRAM_ERR("File cannot be opened", ROMpath, "FILE_NOT_FOUND");
-		return;
-	}
-	static sf::SoundBuffer beepBuf{};
-	if (!beepBuf.loadFromFile("beep.wav")) {
-		WARNING("Sound beep.wav cannot be loaded", "SOUND_NOT_LOADED");
-	}
-	static sf::Sound beep{ beepBuf };
-	beep.setVolume(50.f);
-	const std::string ROMname{ ROM_NAME(ROMpath) };
-	window.setTitle(ROMname);
-	while (window.isOpen()) {
-		beep.stop();
-		QUIT_IF_NOTHING_TO_EMULATE
-		if (soundTimer > 0) {
-			beep.play();
-		}
-		sf::Event event;
-		if (window.pollEvent(event)) {
-			PAUSE_IF_NOT_FOCUS(ROMname);
-			if (event.type == sf::Event::Closed) {
-				window.close();
-				END_PROGRAM_ERR("User closes the emulator", ROMname, "USER_CLOSE");
-				continue;
-			}
-		}
-		if (event.type == sf::Event::KeyPressed || event.type == sf::Event::KeyReleased) {
-			if (chip8KeyName(event.key.code) != '?') {
-				keys[static_cast<Chip8Key>(event.key.code)] = event.type == sf::Event::KeyPressed;
-			}
-		}
-		for (auto opcode{ 0u }; opcode < opcodesPerFrame; opcode++) {
-			QUIT_IF_NOTHING_TO_EMULATE
-			interpretOpcode(nextOpcode());
-		}
-		window.clear(sf::Color::Black);
-		window.draw(screen);
-		window.display();
-		count();
-		sf::sleep(sf::Time(sf::seconds(delay)));
-	}
-}
-
-CPU::CPU() {
-	initializeFonts();
-	// inits the log file
-#ifdef DEBUG_FILE
-	if (std::filesystem::exists("results.log")) {
-		if (!std::filesystem::remove("results.log")) {
-			ERROR("Cannot remove file \"results.log\". This session's log will be added to previous log.\n"
-				"To resolve this error, you should check where is the current directory, so you must run the program as administrator to write there.", "REMOVE_LOG_FAIL");
-		}
-	}
-#endif
+#include "cpu.hpp"
+#include "beep.hpp"
+#include "core.hpp"
+#include "debugger.hpp"
+#include "hash.hpp"
+#include "sharedframes.hpp"
+#include "upscale.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <bitset>
+#include <sstream>
+#include <utility>
+#include <vector>
+#include <filesystem>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#define ROM_NAME(ROM)								std::filesystem::path(ROM).filename().string()
+
+#define MSG_BASE(msg, code, ostream)				ostream << std::string(msg); if (std::string(code) != "") { ostream << " : " << (code); } ostream << " !" << std::endl
+
+#define WARNING(msg, code)							std::cout << "Warning "; MSG_BASE(msg, code, std::cout)
+#define ERROR(msg, code)							std::cerr << "Error "; MSG_BASE(msg, code, std::cerr)
+
+#define END_PROGRAM_MSG(msg, ROMname)				MSG_BASE("-- End of Emulation (" + (ROMname) + ") -- " + (msg), "", std::cout)
+#define END_PROGRAM_ERR(msg, ROMname, errorCode)	MSG_BASE("-- End of Emulation (" + (ROMname) + ") -- " + (msg), std::string(errorCode), std::cerr)
+
+#define QUIT_IF_NOTHING_TO_EMULATE    if (isOver()) {END_PROGRAM_MSG("-- End of Program -- Emulation successfully ended !", ROMname); window->close(); break; break;}
+
+#ifndef NDEBUG
+#define ASSERT_MSG(expression, msg, errorCode) if (!(expression)) { ERROR("Assertion failed at line " + std::to_string(__LINE__) + " : " + std::string(msg), std::string(errorCode) == "" ? "ASSERTION_FAIL" : (errorCode)); std::terminate(); }
+#else
+#define ASSERT_MSG(expression, msg, errorCode) {}
+#endif
+
+// static cast to address type
+#define UCAST(expr) static_cast<address_t>((expr))
+
+// static cast to byte type
+#define BCAST(expr) static_cast<byte_t>((expr))
+
+// memory access wrapped to the 4 KiB address space, so that no register value can reach outside of memory
+#define MEM(address) state_.memory[UCAST(address) & addressMask]
+
+#ifndef NDEBUG
+#define DEBUG_BASE(msg, ostream) ostream << "Opcode " << opcodeToStr(opcode) << " : " << (msg) << std::endl << std::endl
+#define DEBUG_CONSOLE(msg) DEBUG_BASE(msg, std::cout)
+
+#define DEBUG_FILE(msg)														\
+{																			\
+	if (!log_) {															\
+		log_.emplace(logPath(), std::ios::trunc);							\
+	}																		\
+	if (!*log_) {															\
+		std::cerr << "Cannot create/open file " << logPath() << " !" << std::endl;	\
+	}																		\
+	else {																	\
+		DEBUG_BASE(msg, *log_);												\
+	}																		\
+}
+
+#define DEBUG(msg) DEBUG_FILE(msg); DEBUG_CONSOLE(msg)
+#else
+#define DEBUG(msg)
+#endif
+
+#define PAUSE_IF_NOT_FOCUS(title) while (event.type == sf::Event::LostFocus) {window->setTitle("[Paused] -- " + title); while (event.type != sf::Event::GainedFocus) {window->pollEvent(event);} window->setTitle(title); break;}
+
+CPU::address_t CPU::randomNumber(address_t max) noexcept {
+	return Core::randomNumber(state_, max);
+}
+
+const char* CPU::faultName(Fault fault) noexcept {
+	switch (fault) {
+		using enum Fault;
+	case none:				return "NONE";
+	case stackUnderflow:	return "EMPTY_CALL_STACK_SUBROUTINE_RETURN";
+	case stackOverflow:		return "FULL_CALL_STACK_SUBROUTINE_CALL";
+	case jumpOutOfMemory:	return "JUMP_OUT_OF_MEMORY";
+	}
+	return "UNKNOWN_FAULT";
+}
+
+void CPU::seed(std::uint32_t value) noexcept {
+	state_.random = value ? value : 1u; // xorshift never leaves 0
+}
+
+void CPU::count() noexcept{
+	if (state_.gameTimer) {
+		state_.gameTimer--;
+	}
+	if (state_.soundTimer) {
+		state_.soundTimer--;
+	}
+}
+
+constexpr bool CPU::isOpcode(opcodeHex_t opcode) noexcept {
+	for (auto& results : opcodesAND) {
+		if ((opcode & results.first) == static_cast<int>(results.second)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+CPU::opcodeHex_t CPU::nextOpcode() const {
+	const opcodeHex_t opcode{ UCAST((MEM(state_.pc) << 8) + MEM(state_.pc + 1u)) }; // static_cast to avoid overflow
+	ASSERT_MSG(isOpcode(opcode), "Found a bad opcode " + opcodeToStr(opcode) + ", when PC was " + std::to_string(state_.pc) + " (= " + opcodeToStr(state_.pc) + " in hex)", "BAD_OPCODE_FOUND");
+	return opcode;
+}
+
+void CPU::checkKeys() {
+	for (byte_t key{ 0u }; key < 0x10; key++) {
+		setKey(key, sf::Keyboard::isKeyPressed(static_cast<sf::Keyboard::Key>(byteToChip8Key(key))));
+	}
+}
+
+std::string CPU::opcodeToStr(opcodeHex_t opcode, std::size_t finalLength) {
+	// at most 4 digits, which always fit in the string's own buffer : no allocation, unlike a stream
+	std::size_t length{ 1u };
+	while (length < 4u && (opcode >> (4u * length))) {
+		length++;
+	}
+	std::string str(std::max(length, finalLength), '0');
+	for (auto digit{ str.rbegin() }; opcode; opcode = UCAST(opcode >> 4u), ++digit) {
+		*digit = "0123456789ABCDEF"[opcode & 0xF];
+	}
+	return str;
+}
+
+bool CPU::isOver() const noexcept {
+	return state_.fault != Fault::none || state_.pc > memorySize - pcIncrement || !isThereOpcodeAfter();
+}
+
+constexpr bool CPU::isThereOpcodeAfter() const noexcept {
+	return std::find_if(state_.memory.cbegin() + state_.pc, state_.memory.cend(), [](byte_t opcode) {return opcode != 0; /* 0 because memory is filled with 0s if the game file is < than memoryUsableSize */ }) != state_.memory.cend();
+}
+
+void CPU::initializeFonts() {
+	/*
+	11110000 -> 0xF0
+	10010000 -> 0x90
+	10010000 -> 0x90
+	10010000 -> 0x90
+	11110000 -> 0xF0
+	*/
+	std::copy(font.cbegin(), font.cend(), state_.memory.begin());
+}
+
+CPU::Chip8Key CPU::byteToChip8Key(byte_t keycode) {
+	using enum Chip8Key;
+	static constexpr std::array<Chip8Key, 0x10> chip8Keys{ _0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _A, _B, _C, _D, _E, _F };
+	ASSERT_MSG(keycode < chip8Keys.size(), "Cannot find key corresponding at byte " + opcodeToStr(keycode) + ", value stored in a V register. Check opcodes EX9E, EXA1 !", "BAD_KEY_IN_VX");
+	return keycode < chip8Keys.size() ? chip8Keys[keycode] : _0;
+}
+
+bool CPU::isPressed(byte_t keycode) const {
+	ASSERT_MSG(keycode < 0x10, "Cannot find key corresponding at byte " + opcodeToStr(keycode) + ", value stored in a V register. Check opcodes EX9E, EXA1 !", "BAD_KEY_IN_VX");
+	return Core::isPressed(state_, keycode);
+}
+
+char CPU::chip8KeyName(sf::Keyboard::Key key) noexcept {
+#define KEYCAST(chip8Key) static_cast<long>(static_cast<sf::Keyboard::Key>(chip8Key))
+	using enum Chip8Key;
+	static constexpr std::array<long, 0x10> keys{
+		KEYCAST(_0),
+		KEYCAST(_1),
+		KEYCAST(_2),
+		KEYCAST(_3),
+		KEYCAST(_4),
+		KEYCAST(_5),
+		KEYCAST(_6),
+		KEYCAST(_7),
+		KEYCAST(_8),
+		KEYCAST(_9),
+		KEYCAST(_A),
+		KEYCAST(_B),
+		KEYCAST(_C),
+		KEYCAST(_D),
+		KEYCAST(_E),
+		KEYCAST(_F)
+	};
+#undef KEYCAST
+	const auto pos{ std::find(keys.cbegin(), keys.cend(), static_cast<long>(key)) - keys.cbegin() };
+	if (pos < 10) { // digit
+		return static_cast<char>('0' + pos);
+	}
+	if (pos < 0x10) { // letter
+		return static_cast<char>('A' + pos - 10);
+	}
+	// bad key param
+	return '?';
+}
+
+void CPU::interpretOpcode(opcodeHex_t opcode) {
+	const byte_t X{ BCAST((opcode & mask_t{ 0x0F00 }) >> 8) };
+
+	if ((opcode & mask_t{ 0xF0FF }) == 0xF00A && window && !speculating_) {
+		waitKey(X);
+		state_.pc += pcIncrement;
+		return;
+	}
+	const address_t opcodePc{ state_.pc };
+	Core::execute(state_, opcode, quirks_);
+	// the Pixels are only synced when read
+	screenStale_ = screenStale_ || opcode == 0x00E0 || (opcode >> 12) == 0xD;
+	ASSERT_MSG(state_.fault == Fault::none, std::string{ faultName(state_.fault) } + " when PC was " + std::to_string(opcodePc) + " (= " + opcodeToStr(opcodePc) + " in hex)", faultName(state_.fault));
+
+	const address_t NNN{ UCAST(opcode & mask_t{ 0x0FFF }) };
+	if ((opcode >> 12) == 0x1) {
+		if (loop_ == Loop::none) {
+			DEBUG("Jumped at address " + opcodeToStr(NNN, 3u));
+			if (opcodePc == NNN) {
+				loop_ = Loop::first;
+			}
+		}
+		else if (loop_ == Loop::first) {
+			DEBUG("Address didn't change (still " + opcodeToStr(opcodePc) + "), may result into an infinite loop");
+			if (opcodePc == NNN) {
+				loop_ = Loop::in;
+			}
+		}
+		// loop::in not handled to avoid unfinite writing into the log/console
+		return;
+	}
+
+#ifndef NDEBUG
+	const auto toOpcode{
+		[opcode] {
+			for (auto& results : opcodesAND) {
+				const bool is0NNN{ results == opcodesAND[0] };
+				if ((opcode & results.first) == static_cast<int>(results.second)) {
+					if (is0NNN && (opcode & opcodesAND[1].first) != static_cast<int>(opcodesAND[1].second) && (opcode & opcodesAND[2].first) != static_cast<int>(opcodesAND[2].second)) {
+						return results.second; // opcode is 0NNN if and only if opcode != 00EE or 00EE
+					}
+					if (!is0NNN) {
+						return results.second;
+					}
+				}
+			}
+			ASSERT_MSG(false, "Unexpected execution path in void CPU::interpretOpcode::lambda toOpcode with opcode \"" + opcodeToStr(opcode) + "\"", "UNKNOWN_OPCODE");
+			return Opcode::_0NNN; // 0NNN does nothing
+		}
+	};
+
+	const auto& V{ state_.V };
+	const auto& I{ state_.I };
+	const auto& pc{ state_.pc };
+	const byte_t	  Y{ BCAST((opcode & mask_t{ 0x00F0 }) >> 4) };
+	const byte_t	  N{ BCAST(opcode & mask_t{ 0x000F }) };
+	const byte_t     NN{ BCAST(opcode & mask_t{ 0x00FF }) };
+	// after a skip : the instruction skipped, otherwise the one executed next
+	const bool skipped{ pc != opcodePc + pcIncrement };
+
+#define		 X_DEBUG	opcodeToStr(UCAST(X),    1u)
+#define		VX_DEBUG	opcodeToStr(UCAST(V[X]), 2u)
+#define		 Y_DEBUG	opcodeToStr(UCAST(Y),    1u)
+#define		 N_DEBUG	opcodeToStr(UCAST(N),    1u)
+#define		NN_DEBUG	opcodeToStr(UCAST(NN),   2u)
+#define	   NNN_DEBUG	opcodeToStr(UCAST(NNN),  3u)
+#define		PC_DEBUG	opcodeToStr(UCAST(pc)      )
+#define		 I_DEBUG	opcodeToStr(UCAST(I)       )
+#define NEXTOP_DEBUG	opcodeToStr(UCAST((MEM(opcodePc + 2u) << 8) | MEM(opcodePc + 3u)))
+
+	switch (toOpcode()) {
+		using enum Opcode;
+
+	case _0NNN:
+		// not used nor needed
+		DEBUG("Historically, called RCA 1082's routine at address " + NNN_DEBUG + " (Not used in modern implementations as this)");
+		break;
+
+	case _00E0:
+		DEBUG("Screen erased");
+		break;
+
+	case _00EE:
+		DEBUG("Returned from subroutine, back at " + PC_DEBUG);
+		break;
+
+	case _1NNN:
+		break;
+
+	case _2NNN:
+		DEBUG("Called subroutine at address " + PC_DEBUG);
+		break;
+
+	case _3XNN:
+	case _4XNN:
+		DEBUG('V' + X_DEBUG + (V[X] == NN ? " == " : " != ") + NN_DEBUG + (skipped ? ", skips instruction " : ", doesn't skip instruction ") + NEXTOP_DEBUG);
+		break;
+
+	case _5XY0:
+	case _9XY0:
+		DEBUG('V' + X_DEBUG + (V[X] == V[Y] ? " == V" : " != V") + Y_DEBUG + (skipped ? ", skips instruction " : ", doesn't skip instruction ") + NEXTOP_DEBUG);
+		break;
+
+	case _6XNN:
+		DEBUG('V' + X_DEBUG + " = " + NN_DEBUG);
+		break;
+
+	case _7XNN:
+		DEBUG('V' + X_DEBUG + " += " + NN_DEBUG + ", is now equal to " + VX_DEBUG);
+		break;
+
+	case _8XY0:
+		DEBUG('V' + X_DEBUG + " = V" + Y_DEBUG + " (= " + VX_DEBUG + ')');
+		break;
+
+	case _8XY1:
+		DEBUG('V' + X_DEBUG + " |= V" + Y_DEBUG + ", is now equal to " + VX_DEBUG);
+		break;
+
+	case _8XY2:
+		DEBUG('V' + X_DEBUG + " &= V" + Y_DEBUG + ", is now equal to " + VX_DEBUG);
+		break;
+
+	case _8XY3:
+		DEBUG('V' + X_DEBUG + " ^= V" + Y_DEBUG + ", is now equal to " + VX_DEBUG);
+		break;
+
+	case _8XY4:
+		DEBUG('V' + X_DEBUG + " += V" + Y_DEBUG + ", is now equal to " + VX_DEBUG + ", VF is set to " + opcodeToStr(V[0xF], 2) + " (there " + (V[0xF] ? "was an overflow)" : "wasn't overflow)"));
+		break;
+
+	case _8XY5:
+		DEBUG('V' + X_DEBUG + " -= V" + Y_DEBUG + ", is now equal to " + VX_DEBUG + ", VF is set to " + opcodeToStr(V[0xF], 2) + " (there " + (V[0xF] ? "wasn't overflow (borrow))" : "was an overflow (borrow))"));
+		break;
+
+	case _8XY6:
+		DEBUG("VF = V" + X_DEBUG + " & 0x01 (= " + opcodeToStr(V[0xF], 2) + "), V" + X_DEBUG + " >>= 1, is now equal to " + VX_DEBUG);
+		break;
+
+	case _8XY7:
+		DEBUG('V' + X_DEBUG + " = V" + Y_DEBUG + " - V" + X_DEBUG + ", is now equal to " + VX_DEBUG + ", VF is set to " + opcodeToStr(V[0xF], 2) + " (there " + (V[0xF] ? "wasn't overflow(borrow))" : "was an overflow(borrow))"));
+		break;
+
+	case _8XYE:
+		DEBUG("VF = V" + X_DEBUG + " >> 7 (= " + opcodeToStr(V[0xF], 2) + "), V" + X_DEBUG + " <<= 1, is now equal to " + VX_DEBUG);
+		break;
+
+	case _ANNN:
+		DEBUG("I = " + NNN_DEBUG);
+		break;
+
+	case _BNNN:
+		DEBUG("PC = V0 + " + NNN_DEBUG + ", now is equal to " + PC_DEBUG);
+		break;
+
+	case _CXNN:
+		DEBUG('V' + X_DEBUG + " = random number < " + NN_DEBUG + ", nom is equal to " + VX_DEBUG);
+		break;
+
+	case _DXYN:
+		DEBUG("Displayed font from address I = " + I_DEBUG + ", at coords (" + VX_DEBUG + " ; " + opcodeToStr(V[Y], 2) + "), with height = " + N_DEBUG);
+		break;
+
+	case _EXA1:
+	case _EX9E:
+		DEBUG("Key in V" + X_DEBUG + " (= " + VX_DEBUG + (isPressed(V[X]) ? ") is pressed" : ") isn't pressed") + (skipped ? ", skips instruction " : ", doesn't skip instruction ") + NEXTOP_DEBUG);
+		break;
+
+	case _FX07:
+		DEBUG('V' + X_DEBUG + " = gameTimer, is now equal to " + opcodeToStr(state_.gameTimer, 2));
+		break;
+
+	case _FX0A:
+		DEBUG(pc == opcodePc ? std::string{ "Waits for a key" } : "Key " + VX_DEBUG + " is pressed");
+		break;
+
+	case _FX15:
+		DEBUG("gameTimer = V" + X_DEBUG + ", is now equal to " + opcodeToStr(state_.gameTimer, 2));
+		break;
+
+	case _FX18:
+		DEBUG("soundTimer = V" + X_DEBUG + ", is now equal to " + opcodeToStr(state_.soundTimer, 2));
+		break;
+
+	case _FX1E:
+		DEBUG("I += V" + X_DEBUG + ", is now equal to " + I_DEBUG);
+		break;
+
+	case _FX29:
+		DEBUG("I = address of font in V" + X_DEBUG + " (= " + VX_DEBUG + "), is now equal to " + I_DEBUG);
+		break;
+
+	case _FX33:
+		DEBUG("address " + I_DEBUG + " of memory = " + opcodeToStr(MEM(I)) +
+			"\naddress " + opcodeToStr(I + 1u) + " of memory = " + opcodeToStr(MEM(I + 1u)) +
+			"\naddress " + opcodeToStr(I + 2u) + " of memory = " + opcodeToStr(MEM(I + 2u)));
+		break;
+
+	case _FX55:
+	{
+		std::string debugText{};
+		for (address_t i{ 0u }; i <= X; i++) {
+			if (i > 0) {
+				debugText += "\n";
+			}
+			debugText += "address " + opcodeToStr(UCAST(I + i)) + " of memory = " + opcodeToStr(MEM(I + i));
+		}
+		DEBUG(debugText);
+		break;
+	}
+
+	case _FX65:
+	{
+		std::string debugText{};
+		for (address_t i{ 0 }; i <= X; i++) {
+			if (i > 0) {
+				debugText += ";\t";
+			}
+			debugText += 'V' + opcodeToStr(i, 1) + " is loaded from memory at address " + opcodeToStr(UCAST(I + i)) + ", is now equal to " + opcodeToStr(V[i]);
+		}
+		DEBUG(debugText);
+		break;
+	}
+
+	}
+#endif
+}
+
+void CPU::waitKey(byte_t X) {
+	sf::Event event{};
+	while (window->isOpen()) {
+		if (!window->pollEvent(event)) { // event is default-initialzed to 0 (= sf::Event::Closed), so if pollEvent doesn't detect any event, the variable event stays to closed and the loop is exited
+			continue;
+		}
+		PAUSE_IF_NOT_FOCUS(ROM_);
+		if (event.type == sf::Event::Closed) {
+			window->close();
+			END_PROGRAM_ERR("User closes the emulator", ROM_, "USER_CLOSE");
+			continue;
+		}
+		else if (event.type == sf::Event::KeyPressed) {
+			const auto keyName{ chip8KeyName(event.key.code) };
+			if (keyName != '?') { // key is one of the Chip8 keyboard
+				state_.V[X] = keyNameToValue(keyName);
+				setKey(state_.V[X], true);
+#ifndef NDEBUG
+				using namespace std::string_literals;
+				const opcodeHex_t opcode{ UCAST(0xF00A | X << 8) };
+				DEBUG("Key "s + keyName + " is pressed");
+#endif
+				break;
+			}
+		}
+	}
+}
+
+const char* CPU::fusionName(Fusion fusion) noexcept {
+	switch (fusion) {
+	case spriteDraw:	return "ANNN DXYN";
+	case loadRun:		return "6XNN run";
+	case timerWait:		return "FX07 3XNN 1NNN";
+	case bcdLoad:		return "FX33 FY65";
+	case storeBcdLoad:	return "FZ55 FX33 FY65";
+	case nFusions:		break;
+	}
+	return "UNKNOWN_FUSION";
+}
+
+std::size_t CPU::stepFused(std::size_t budget) {
+	auto& V{ state_.V };
+	auto& I{ state_.I };
+	auto& pc{ state_.pc };
+	const auto& memory{ state_.memory };
+	// every fused opcode is a non-zero one within memory : isOver() can only be true before the first one, which step() checks
+	if (budget < 2u || state_.fault != Fault::none || pc + 2u * pcIncrement > memorySize) {
+		return 0u;
+	}
+	const auto fits{ [&pc](std::size_t count) { return pc + count * pcIncrement <= memorySize; } };
+	const auto opcodeAt{ [&pc, &memory](std::size_t index) { return UCAST((memory[pc + index * pcIncrement] << 8) | memory[pc + index * pcIncrement + 1u]); } };
+	// memory written from I mustn't overwrite the sequence being fused
+	const auto writesSequence{ [&I, &pc](std::size_t size, std::size_t count) {
+		return I + size > memorySize || (I + size > pc && I < pc + count * pcIncrement);
+	} };
+	const opcodeHex_t opcode{ opcodeAt(0u) };
+	const byte_t X{ BCAST((opcode >> 8) & 0xF) };
+	const auto XOf{ [](opcodeHex_t next) { return BCAST((next >> 8) & 0xF); } };
+
+	switch (opcode >> 12) {
+	case 0xA:
+	{
+		const auto draw{ opcodeAt(1u) };
+		if ((draw & 0xF000) != 0xD000) {
+			return 0u;
+		}
+		I = UCAST(opcode & 0xFFF);
+		Core::drawSprite(state_, XOf(draw), BCAST((draw >> 4) & 0xF), BCAST(draw & 0xF), quirks_ & RomPack::clipSprites);
+		screenStale_ = true;
+		pc += 2u * pcIncrement;
+		fusionHits_[spriteDraw]++;
+		DEBUG("Fused " + std::string(fusionName(spriteDraw)) + ", I = " + I_DEBUG);
+		return 2u;
+	}
+
+	case 0x6:
+	{
+		if ((opcodeAt(1u) & 0xF000) != 0x6000) {
+			return 0u;
+		}
+		std::size_t count{ 0u };
+		for (; count < budget && fits(count + 1u) && (opcodeAt(count) & 0xF000) == 0x6000; count++) {
+			V[XOf(opcodeAt(count))] = BCAST(opcodeAt(count) & 0xFF);
+		}
+		pc += UCAST(count * pcIncrement);
+		fusionHits_[loadRun]++;
+		DEBUG("Fused " + std::to_string(count) + " loads");
+		return count;
+	}
+
+	case 0xF:
+		// FX55 and FX65 moving I would need writesSequence() to follow it : not worth fusing
+		if ((opcode & 0xFF) != 0x07 && (quirks_ & RomPack::loadStoreIncrementsI)) {
+			return 0u;
+		}
+		if ((opcode & 0xFF) == 0x07) {
+			const auto skip{ opcodeAt(1u) };
+			if (budget < 3u || !fits(3u) || (skip & 0xFF00) != (0x3000 | (X << 8)) || opcodeAt(2u) != (0x1000 | pc)) {
+				return 0u;
+			}
+			V[X] = state_.gameTimer;
+			fusionHits_[timerWait]++;
+			DEBUG("Fused " + std::string(fusionName(timerWait)) + ", V" + X_DEBUG + " = gameTimer = " + VX_DEBUG);
+			if (V[X] == (skip & 0xFF)) {
+				pc += 3u * pcIncrement; // 1NNN is skipped
+				return 2u;
+			}
+			// timers only change between frames : the loop spins, back at pc, until the end of the frame
+			return budget - budget % 3u;
+		}
+		if ((opcode & 0xFF) == 0x33) {
+			const auto load{ opcodeAt(1u) };
+			if ((load & 0xF0FF) != 0xF065 || writesSequence(3u, 2u)) {
+				return 0u;
+			}
+			Core::storeBcd(state_, X);
+			Core::loadRegisters(state_, XOf(load));
+			pc += 2u * pcIncrement;
+			fusionHits_[bcdLoad]++;
+			DEBUG("Fused " + std::string(fusionName(bcdLoad)) + " at I = " + I_DEBUG);
+			return 2u;
+		}
+		if ((opcode & 0xFF) == 0x55) {
+			const auto bcd{ opcodeAt(1u) };
+			if (budget < 3u || !fits(3u) || (bcd & 0xF0FF) != 0xF033 || (opcodeAt(2u) & 0xF0FF) != 0xF065 || writesSequence(std::max(X + 1u, 3u), 3u)) {
+				return 0u;
+			}
+			Core::storeRegisters(state_, X);
+			Core::storeBcd(state_, XOf(bcd));
+			Core::loadRegisters(state_, XOf(opcodeAt(2u)));
+			pc += 3u * pcIncrement;
+			fusionHits_[storeBcdLoad]++;
+			DEBUG("Fused " + std::string(fusionName(storeBcdLoad)) + " at I = " + I_DEBUG);
+			return 3u;
+		}
+		return 0u;
+	}
+	return 0u;
+}
+
+bool CPU::loadGame(const std::string& ROM) {
+	if (std::filesystem::path(ROM).extension() != ".ch8") {
+		std::cerr << "Warning : file " << std::quoted(ROM) << " hasn't standard extension .ch8 !" << std::endl <<
+			"It may not be an usable Chip8 ROM file and may result into errors !" << std::endl <<
+			"If the file's correct, you should rename it to explicitly show that's a good file !" << std::endl;
+		char c{ '0' };
+		while (c != 'y' && c != 'n') {
+			std::cout << "Are you sure you want to continue (y/n) ?" << std::endl;
+			std::cin >> c;
+		}
+		if (c == 'n') {
+			std::cerr << "Loading aborted : USER_EXIT_WARNING" << std::endl;
+			return false;
+		}
+	}
+
+	ROM_ = ROM;
+
+	std::ifstream ROMfile{ ROM, std::ios_base::binary };
+	if (!ROMfile) {
+		END_PROGRAM_ERR("File's loading failed", ROM, "FILE_NOT_FOUND !");
+		return false;
+	}
+	const auto ROMsize{ std::filesystem::file_size(ROM) };
+	if (ROMsize > memoryUsableSize) {
+		END_PROGRAM_ERR("File too big (" + std::to_string(ROMsize) + " bytes whereas max allowed size is " + std::to_string(memoryUsableSize) + " bytes)", ROM, "FILE_TOO_BIG");
+		std::cerr << "File too big (" << ROMsize << " bytes, max capacity is " << memoryUsableSize << ") !" << std::endl;
+		return false;
+	}
+	reset();
+	ROMfile.read(reinterpret_cast<char*>(&state_.memory[memoryStart]), static_cast<std::streamsize>(ROMsize));
+	return true;
+}
+
+bool CPU::loadImage(const byte_t* image, std::size_t size) {
+	if (size > memoryUsableSize) {
+		return false;
+	}
+	reset();
+	std::memcpy(&state_.memory[memoryStart], image, size);
+	return true;
+}
+
+void CPU::reset() {
+	const auto random{ state_.random };
+	state_ = State{};
+	state_.pc = memoryStart;
+	state_.random = random;
+	initializeFonts();
+	loop_ = Loop::none;
+	frameOpcodes_ = 0u;
+	frameCycles_ = 0u;
+	screen.erase();
+	screenStale_ = false;
+}
+
+void CPU::setKey(byte_t key, bool pressed) {
+	const auto bit{ static_cast<std::uint16_t>(1u << (key & 0xF)) };
+	state_.keys = static_cast<std::uint16_t>(pressed ? state_.keys | bit : state_.keys & ~bit);
+}
+
+void CPU::setKeys(std::uint16_t mask) {
+	state_.keys = mask;
+}
+
+void CPU::emulate(const std::string& ROMpath) {
+	ROM_ = ROMpath;
+	if (!loadGame(ROMpath)) {
+		END_PROGRAM_ERR("File cannot be opened", ROMpath, "FILE_NOT_FOUND");
+		return;
+	}
+	run(ROM_NAME(ROMpath));
+}
+
+void CPU::emulate(const RomPack& pack, const RomPack::Entry& entry) {
+	const std::string ROMname{ RomPack::name(entry) };
+	ROM_ = ROMname;
+	if (!loadImage(pack.image(entry), entry.size)) {
+		END_PROGRAM_ERR("Image too big", ROMname, "FILE_TOO_BIG");
+		return;
+	}
+	setQuirks(entry.quirks);
+	if (entry.quirks & RomPack::vipTiming) {
+		setTiming(Timing::cosmacVip);
+	}
+	run(ROMname);
+}
+
+void CPU::run(const std::string& ROMname) {
+	// the audio device is only opened by the first beep
+	std::optional<sf::SoundBuffer> beepBuf{};
+	std::optional<sf::Sound> beep{};
+	if (upscaler_) {
+		upscaled_.emplace();
+		if (!upscaled_->create(static_cast<unsigned>(upscaler_->width()), static_cast<unsigned>(upscaler_->height()))) {
+			WARNING("Upscaled texture cannot be created, drawing Pixels", "TEXTURE_NOT_CREATED");
+			upscaled_.reset();
+		}
+	}
+	if (upscaled_) {
+		window.emplace(sf::VideoMode(static_cast<unsigned>(upscaler_->width()), static_cast<unsigned>(upscaler_->height())), ROMname);
+	}
+	else {
+		window.emplace(sf::VideoMode(Screen::width, Screen::height), ROMname);
+	}
+	using clock = Telemetry::clock;
+	const auto frameDuration{ std::chrono::duration_cast<clock::duration>(std::chrono::duration<float>(delay)) };
+	auto deadline{ clock::now() + frameDuration }; // end of the current frame, frames are scheduled from the start so sleeps don't drift
+	if (telemetry_) {
+		// timed frames run as many opcodes as their cycles allow : there's no fixed rate to aim for
+		telemetry_->start(FPS, timing_ == Timing::flat ? FPS * opcodesPerFrame : 0.);
+	}
+	bool debuggerStopped{ false }; // shown in the title until F5 resumes
+	while (window->isOpen()) {
+		if (beep) {
+			beep->stop();
+		}
+		QUIT_IF_NOTHING_TO_EMULATE
+		if (state_.soundTimer > 0 && !beep) {
+			beepBuf.emplace();
+			if (!beepBuf->loadFromMemory(beepWav, sizeof(beepWav))) {
+				WARNING("Sound beep.wav cannot be loaded", "SOUND_NOT_LOADED");
+			}
+			beep.emplace(*beepBuf);
+			beep->setVolume(50.f);
+		}
+		if (state_.soundTimer > 0) {
+			beep->play();
+		}
+		sf::Event event;
+		if (window->pollEvent(event)) {
+			PAUSE_IF_NOT_FOCUS(ROMname);
+			if (event.type == sf::Event::Closed) {
+				window->close();
+				END_PROGRAM_ERR("User closes the emulator", ROMname, "USER_CLOSE");
+				continue;
+			}
+			if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F1 && telemetry_) {
+				telemetry_->showOverlay(!telemetry_->overlay());
+			}
+			if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F5 && debugger_) {
+				debugger_->resume();
+			}
+			if (event.type == sf::Event::KeyPressed || event.type == sf::Event::KeyReleased) {
+				const auto keyName{ chip8KeyName(event.key.code) };
+				if (keyName != '?') {
+					setKey(keyNameToValue(keyName), event.type == sf::Event::KeyPressed);
+				}
+			}
+		}
+		const auto workStart{ clock::now() };
+		const bool stepped{ stepFrame() };
+		Telemetry::Frame measured{ lastFrameOpcodes_ };
+		if (!stepped) {
+			if (state_.fault != Fault::none) {
+				END_PROGRAM_ERR("The program faulted", ROMname, faultName(state_.fault));
+			}
+			else {
+				END_PROGRAM_MSG("-- End of Program -- Emulation successfully ended !", ROMname);
+			}
+			window->close();
+			break;
+		}
+		if (debugger_ && debugger_->stopped().has_value() != debuggerStopped) {
+			debuggerStopped = !debuggerStopped;
+			window->setTitle(debuggerStopped ? "[Stopped, F5 resumes] -- " + ROMname : ROMname);
+		}
+		const auto workEnd{ clock::now() };
+		measured.work = workEnd - workStart;
+		// already late : the frame isn't rendered, to catch up
+		measured.skipped = workEnd > deadline;
+		if (!measured.skipped) {
+			window->clear(sf::Color::Black);
+			if (runAhead_) {
+				drawAhead();
+			}
+			else {
+				drawScreen();
+			}
+			if (telemetry_) {
+				window->draw(*telemetry_);
+			}
+			const auto rendered{ clock::now() };
+			window->display();
+			measured.render = rendered - workEnd;
+			measured.present = clock::now() - rendered;
+		}
+		auto now{ clock::now() };
+		if (now - deadline > maxFramesLate * frameDuration) {
+			if (telemetry_) {
+				telemetry_->drop(static_cast<std::uint64_t>((now - deadline) / frameDuration));
+			}
+			deadline = now;
+		}
+		if (now < deadline) {
+			sf::sleep(sf::microseconds(std::chrono::duration_cast<std::chrono::microseconds>(deadline - now).count()));
+			now = clock::now();
+		}
+		measured.overshoot = now > deadline ? now - deadline : clock::duration::zero();
+		deadline += frameDuration;
+		if (telemetry_) {
+			telemetry_->record(measured, now);
+		}
+	}
+	window.reset();
+	upscaled_.reset();
+}
+
+void CPU::drawAhead() {
+	const auto state{ snapshot() };
+	// what snapshot() doesn't cover, but the real frames depend on or report
+	const auto frameOpcodes{ frameOpcodes_ };
+	const auto frameCycles{ frameCycles_ };
+	const auto lastFrameOpcodes{ lastFrameOpcodes_ };
+	const auto loop{ loop_ };
+	const auto fusionHits{ fusionHits_ };
+	const auto recorder{ std::exchange(recorder_, nullptr) };
+	const auto shared{ std::exchange(shared_, nullptr) };
+	const auto debugger{ std::exchange(debugger_, nullptr) };
+	speculating_ = true;
+	for (std::size_t frame{ 0u }; frame < runAhead_ && stepFrame(); frame++) {}
+	drawScreen();
+	speculating_ = false;
+	recorder_ = recorder;
+	shared_ = shared;
+	debugger_ = debugger;
+	restore(state);
+	frameOpcodes_ = frameOpcodes;
+	frameCycles_ = frameCycles;
+	lastFrameOpcodes_ = lastFrameOpcodes;
+	loop_ = loop;
+	fusionHits_ = fusionHits;
+}
+
+void CPU::drawScreen() {
+	if (upscaled_) {
+		upscaled_->update(reinterpret_cast<const sf::Uint8*>(upscaler_->upscale(state_.screen).data()));
+		window->draw(sf::Sprite{ *upscaled_ });
+	}
+	else {
+		window->draw(getScreen());
+	}
+}
+
+bool CPU::step() {
+	if (isOver()) {
+		return false;
+	}
+	interpretOpcode(nextOpcode());
+	return true;
+}
+
+void CPU::endFrame() {
+	count();
+	if (recorder_) {
+		recorder_->push(state_.screen);
+	}
+	if (shared_) {
+		shared_->publish(state_.screen, registers());
+	}
+}
+
+void CPU::setTiming(Timing timing) noexcept {
+	timing_ = timing;
+	frameOpcodes_ = 0u;
+	frameCycles_ = 0u;
+}
+
+namespace {
+	// approximate costs of the VIP interpreter in machine cycles, by the opcode's first digit
+	// 0 is 00E0, D is the fixed part of DXYN and F is the cheapest FXNN
+	constexpr std::array<std::uint8_t, 0x10> vipOpcodeCycles{ 24, 12, 26, 10, 10, 14, 6, 10, 44, 14, 12, 22, 36, 26, 14, 10 };
+	constexpr std::uint32_t vipReturnCycles{ 10u }; // 00EE only pops the stack
+	constexpr std::uint32_t vipSkipCycles{ 2u };
+}
+
+std::uint32_t CPU::vipCycles(opcodeHex_t opcode, std::uint32_t cycles) const noexcept {
+	const auto& V{ state_.V };
+	const auto X{ (opcode >> 8) & 0xFu };
+	const auto NN{ opcode & 0xFFu };
+	cycles += opcode == 0x00EE ? vipReturnCycles : vipOpcodeCycles[opcode >> 12];
+	switch (opcode >> 12) {
+	case 0x3:
+		return cycles + vipSkipCycles * (V[X] == NN);
+	case 0x4:
+		return cycles + vipSkipCycles * (V[X] != NN);
+	case 0x5:
+		return cycles + vipSkipCycles * (V[X] == V[(opcode >> 4) & 0xFu]);
+	case 0x9:
+		return cycles + vipSkipCycles * (V[X] != V[(opcode >> 4) & 0xFu]);
+	case 0xD:
+		// the interpreter waits for the display interrupt, then draws each row over one byte, or two if unaligned
+		return std::max(cycles, vipCyclesPerFrame + vipOpcodeCycles[0xD]) + (opcode & 0xFu) * (V[X] & 7u ? 17u : 10u);
+	case 0xE:
+		return cycles + vipSkipCycles * (isPressed(V[X]) == (NN == 0x9E));
+	case 0xF:
+		switch (NN) {
+		case 0x1E: return cycles + 8u;
+		case 0x29: return cycles + 10u;
+		case 0x33: return cycles + 74u;
+		case 0x55:
+		case 0x65: return cycles + 14u * (X + 1u);
+		}
+		return cycles;
+	}
+	return cycles;
+}
+
+template <bool debugging, bool timed, bool fused>
+bool CPU::runFrame() {
+	auto opcode{ frameOpcodes_ };
+	auto cycles{ frameCycles_ };
+	while (timed ? cycles < vipCyclesPerFrame : opcode < opcodesPerFrame) {
+		if constexpr (debugging) {
+			if (debugger_->pauses(*this)) {
+				frameOpcodes_ = opcode;
+				frameCycles_ = cycles;
+				return true;
+			}
+		}
+		if constexpr (fused) {
+			if (const auto executed{ stepFused(opcodesPerFrame - opcode) }) {
+				opcode += executed;
+				continue;
+			}
+		}
+		if (isOver()) {
+			frameOpcodes_ = opcode;
+			return false;
+		}
+		// fetched once, for the cycle cost and the execution
+		const opcodeHex_t executed{ nextOpcode() };
+		if constexpr (timed) {
+			cycles = vipCycles(executed, cycles);
+		}
+		interpretOpcode(executed);
+		opcode++;
+		if constexpr (debugging) {
+			debugger_->executed(*this);
+		}
+	}
+	lastFrameOpcodes_ = opcode;
+	frameOpcodes_ = 0u;
+	frameCycles_ = timed ? cycles - vipCyclesPerFrame : 0u;
+	endFrame();
+	return true;
+}
+
+bool CPU::stepOpcode() {
+	if (isOver()) {
+		return false;
+	}
+	const bool timed{ timing_ == Timing::cosmacVip };
+	const opcodeHex_t opcode{ nextOpcode() };
+	frameCycles_ = timed ? vipCycles(opcode, frameCycles_) : 0u;
+	interpretOpcode(opcode);
+	frameOpcodes_++;
+	if (timed ? frameCycles_ >= vipCyclesPerFrame : frameOpcodes_ >= opcodesPerFrame) {
+		lastFrameOpcodes_ = frameOpcodes_;
+		frameOpcodes_ = 0u;
+		frameCycles_ = timed ? frameCycles_ - vipCyclesPerFrame : 0u;
+		endFrame();
+	}
+	return true;
+}
+
+bool CPU::stepFrame() {
+	if (shared_) {
+		if (const auto sharedKeys{ shared_->input() }) {
+			setKeys(*sharedKeys);
+		}
+	}
+	// nothing armed, nothing to check : the debugger costs one test per frame
+	const bool debugging{ debugger_ && debugger_->armed() };
+	if (timing_ == Timing::cosmacVip) {
+		return debugging ? runFrame<true, true, false>() : runFrame<false, true, false>();
+	}
+	if (debugging) {
+		return runFrame<true, false, false>();
+	}
+	return fusion_ ? runFrame<false, false, true>() : runFrame<false, false, false>();
+}
+
+CPU::Registers CPU::registers() const noexcept {
+	return { state_.V, state_.I, state_.pc, state_.gameTimer, state_.soundTimer, state_.stackSize };
+}
+
+std::uint64_t CPU::State::hash() const noexcept {
+	const std::array<std::uint32_t, 7> registers{ I, pc, stackSize, gameTimer, soundTimer, random, static_cast<std::uint32_t>(fault) };
+	auto hash{ hash64(memory.data(), memory.size()) };
+	hash = hash64(V.data(), V.size(), hash);
+	hash = hash64(reinterpret_cast<const unsigned char*>(stack.data()), stackSize * sizeof(address_t), hash);
+	hash = hash64(reinterpret_cast<const unsigned char*>(registers.data()), sizeof(registers), hash);
+	return hash64(reinterpret_cast<const unsigned char*>(screen.data()), sizeof(screen), hash);
+}
+
+CPU::State CPU::snapshot() const {
+	State state{ state_ };
+	std::fill(state.stack.begin() + state.stackSize, state.stack.end(), address_t{ 0u }); // so that equal states compare equal
+	return state;
+}
+
+void CPU::restore(const State& state) {
+	state_ = state;
+	state_.stackSize = BCAST(std::min<std::size_t>(state.stackSize, maxJumps));
+	frameOpcodes_ = 0u;
+	frameCycles_ = 0u;
+	screenStale_ = true;
+}
+
+CPU::CPU() {
+	state_.pc = memoryStart;
+	initializeFonts();
+	seed(static_cast<std::uint32_t>(std::chrono::system_clock::now().time_since_epoch().count()));
+	instance_ = nInstances_++;
+}
+
+std::string CPU::logPath() const {
+	// the first CPU keeps the historical log name
+	return instance_ ? "results-" + std::to_string(instance_) + ".log" : "results.log";
 }
\ No newline at end of file
@@ -1,291 +1,573 @@
-#pragma once
-
-#include "pixel.hpp"
-
-#ifdef _MSC_VER
-#pragma warning(push, 0)
-#endif
-
-#include <array>
-#include <bitset>
-#include <string_view>
-#include <stack>
-#include <unordered_map>
-#include <unordered_set>
-#include <SFML/Audio.hpp>
-
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
-
-class CPU {
-public:
-	using byte_t = unsigned char;
-	using address_t = short unsigned;
-
-	static constexpr address_t memorySize{ 0x1000 };
-	static constexpr address_t memoryStart{ 0x200 };
-	static constexpr address_t memoryUsableSize{ memorySize - memoryStart };
-
-	static constexpr std::size_t fontSize{ 5 };
-
-private:
-	sf::RenderWindow window{ sf::VideoMode(Screen::width, Screen::height), "" };
-
-	Screen							screen{};
-
-	std::array<byte_t, memorySize>	memory{};	// memory to store ROM
-	std::array<byte_t, 0x10>			 V{};	// register
-	std::stack<address_t>			 jumps{};	// contains addresses of subroutines calls
-
-	// emulator => Chip 8
-	// 1 2 3 4	=> 1 2 3 C
-	// A Z E R	=> 4 5 6 D
-	// Q S D F	=> 7 8 9 E
-	// W X C V	=> A 0 B F
-
-	using key_t = std::pair<sf::Keyboard::Key /* real input : emulator */, sf::Keyboard::Key /* virtual key : Chip8 */>;
-
-	enum class Chip8Key {
-		_1 = sf::Keyboard::Num1,
-		_2 = sf::Keyboard::Num2,
-		_3 = sf::Keyboard::Num3,
-		_4 = sf::Keyboard::A,
-		_5 = sf::Keyboard::Z,
-		_6 = sf::Keyboard::E,
-		_7 = sf::Keyboard::Q,
-		_8 = sf::Keyboard::S,
-		_9 = sf::Keyboard::D,
-		_0 = sf::Keyboard::X,
-		_A = sf::Keyboard::W,
-		_B = sf::Keyboard::C,
-		_C = sf::Keyboard::Num4,
-		_D = sf::Keyboard::R,
-		_E = sf::Keyboard::F,
-		_F = sf::Keyboard::V
-	};
-
-	std::unordered_map<Chip8Key, bool /*state */> keys{
-		{Chip8Key::_0, false},
-		{Chip8Key::_1, false},
-		{Chip8Key::_2, false},
-		{Chip8Key::_3, false},
-		{Chip8Key::_4, false},
-		{Chip8Key::_5, false},
-		{Chip8Key::_6, false},
-		{Chip8Key::_7, false},
-		{Chip8Key::_8, false},
-		{Chip8Key::_9, false},
-		{Chip8Key::_A, false},
-		{Chip8Key::_B, false},
-		{Chip8Key::_C, false},
-		{Chip8Key::_D, false},
-		{Chip8Key::_E, false},
-		{Chip8Key::_F, false},
-	};
-
-	address_t							 I{};	// the "address register" -> stores an address	
-	address_t			   pc{ memoryStart };	// program counter : to iterate over the memory
-	
-	static constexpr std::size_t pcIncrement{ sizeof(address_t) / sizeof(byte_t) };
-
-	byte_t							nJumps{};			// current number of jumps (subroutines calls), must be < 16
-	byte_t							gameTimer{};
-	byte_t							soundTimer{};
-
-	using opcodeHex_t = address_t;
-	static constexpr std::size_t nOpcodes{ 35 };
-	std::string ROM_{};
-
-	enum class Opcode { // underscores to avoid naming problems (an identifier cannot begin with a number)
-		// calls RCA 1082's routine at address NNN (not used in modern implementations)
-		_0NNN = 0x0000,
-
-		// erases screen
-		_00E0 = 0x00E0,
-
-		// returns from a subroutine
-		_00EE = 0x00EE,
-
-		// jumps to address NNN
-		_1NNN = 0x1000,
-
-		// calls subroutine at address NNN
-		_2NNN = 0x2000,
-
-		// skips next instruction if VX == NN
-		_3XNN = 0x3000,
-
-		// skips next instruction if VX != NN
-		_4XNN = 0x4000,
-
-		// skips next instrucion if VX == VY
-		_5XY0 = 0x5000,
-
-		// VX = NN
-		_6XNN = 0x6000,
-
-		// VX += NN
-		_7XNN = 0x7000,
-
-		// VX = VY
-		_8XY0 = 0x8000,
-
-		// VX |= VY
-		_8XY1 = 0x8001,
-
-		// VX &= VY
-		_8XY2 = 0x8002,
-
-		// VX ^= VY
-		_8XY3 = 0x8003,
-
-		// VX += VY; VF is set to 1 if overflow (carry), otherwise to 0
-		_8XY4 = 0x8004,
-
-		// VX -= VY; VF is set to 0 if overflow (borrow); otherwise to 1
-		_8XY5 = 0x8005,
-
-		// VX >>= 1; VF = VX's LSB before shift
-		_8XY6 = 0x8006,
-
-		// VX = VY - VX; VF is set to 0 if overflow (borrow), otherwise to 1
-		_8XY7 = 0x8007,
-
-		// VX <<= 1; VF is set to VX's MSB before shift
-		_8XYE = 0x800E,
-
-		// skips next instruction if VX != VY
-		_9XY0 = 0x9000,
-
-		// I = NNN
-		_ANNN = 0xA000,
-
-		// jumps to address V0 + NNN
-		_BNNN = 0xB000,
-
-		// VX = random number lesser than NN
-		_CXNN = 0xC000,
-
-		// displays a sprite at coords (VX ; VY), the sprite has a 8px width and a Npx height.
-		// each row of 8 pixels is read as binary-coded from memory[I], I isn't modified
-		// VF is set to 1 is collision, otherwise 0
-		_DXYN = 0xD000,
-
-		// skips next instruction if key stored in VX's pressed
-		_EX9E = 0xE09E,
-
-		// skips next instruction if key stored in VX isn't pressed
-		_EXA1 = 0xE0A1,
-
-		// VX = gameTimer
-		_FX07 = 0xF007,
-
-		// waits for a key press, then store it into VX
-		_FX0A = 0xF00A,
-
-		// gameTimer = VX
-		_FX15 = 0xF015,
-
-		// soundTimer = VX
-		_FX18 = 0xF018,
-
-		// I += VX; VF is set to 1 if overflow (carry), otherwise to 0
-		_FX1E = 0xF01E,
-
-		// I = address of character stored in VX; characters 0-H (in hex) are represented by a 4*5 font
-		_FX29 = 0xF029,
-
-		// copies VX's decimal value in memory, at addresses I (hundreds), I+1 (tens), and I+2 (units)
-		_FX33 = 0xF033,
-
-		// stores V0 to VX (included) in memory starting at address I (isn't modified)
-		_FX55 = 0xF055,
-
-		// fills V0 to VX (included) from memory starting at address I (isn't modified)
-		_FX65 = 0xF065
-	};
-
-	using mask_t = opcodeHex_t;
-	using results_t = std::pair<mask_t, Opcode>;
-
-	static constexpr std::array<results_t, nOpcodes> opcodesAND{
-		results_t{0xF000, Opcode::_0NNN},
-		results_t{0xFFFF, Opcode::_00E0},
-		results_t{0xFFFF, Opcode::_00EE},
-		results_t{0xF000, Opcode::_1NNN},
-		results_t{0xF000, Opcode::_2NNN},
-		results_t{0xF000, Opcode::_3XNN},
-		results_t{0xF000, Opcode::_4XNN},
-		results_t{0xF00F, Opcode::_5XY0},
-		results_t{0xF000, Opcode::_6XNN},
-		results_t{0xF000, Opcode::_7XNN},
-		results_t{0xF00F, Opcode::_8XY0},
-		results_t{0xF00F, Opcode::_8XY1},
-		results_t{0xF00F, Opcode::_8XY2},
-		results_t{0xF00F, Opcode::_8XY3},
-		results_t{0xF00F, Opcode::_8XY4},
-		results_t{0xF00F, Opcode::_8XY5},
-		results_t{0xF00F, Opcode::_8XY6},
-		results_t{0xF00F, Opcode::_8XY7},
-		results_t{0xF00F, Opcode::_8XYE},
-		results_t{0xF00F, Opcode::_9XY0},
-		results_t{0xF000, Opcode::_ANNN},
-		results_t{0xF000, Opcode::_BNNN},
-		results_t{0xF000, Opcode::_CXNN},
-		results_t{0xF000, Opcode::_DXYN},
-		results_t{0xF0FF, Opcode::_EX9E},
-		results_t{0xF0FF, Opcode::_EXA1},
-		results_t{0xF0FF, Opcode::_FX07},
-		results_t{0xF0FF, Opcode::_FX0A},
-		results_t{0xF0FF, Opcode::_FX15},
-		results_t{0xF0FF, Opcode::_FX18},
-		results_t{0xF0FF, Opcode::_FX1E},
-		results_t{0xF0FF, Opcode::_FX29},
-		results_t{0xF0FF, Opcode::_FX33},
-		results_t{0xF0FF, Opcode::_FX55},
-		results_t{0xF0FF, Opcode::_FX65},
-	};
-
-	void checkKeys();
-
-	static std::string opcodeToStr(opcodeHex_t opcode, std::size_t finalLength = 4);
-
-	static constexpr bool isOpcode(opcodeHex_t opcode) noexcept;
-
-	void initializeFonts();
-
-	void count() noexcept;
-
-	opcodeHex_t nextOpcode() const;
-
-	void interpretOpcode(opcodeHex_t opcode);
-
-	bool loadGame(const std::string& ROM);
-
-	static Chip8Key byteToChip8Key(byte_t keycode);
-
-	static char chip8KeyName(sf::Keyboard::Key key) noexcept;
-
-	// if there's any opcode to execute after this one
-	constexpr bool isThereOpcodeAfter() const noexcept;
-
-public:
-	static constexpr auto FPS{ 60u };
-	static constexpr auto delay{ 1.f / FPS }; // delay time in seconds; should be float to avoid truncating while calling sf::seconds
-
-	static constexpr auto frequency{ 250u };
-	static constexpr auto opcodesPerFrame{ 1000u / frequency }; // while <delay> ms, <opcodesPerSecond> operations must be done
-
-	CPU();
-
-	CPU(const CPU&)				= delete;
-	CPU(CPU&&)					= delete;
-
-	CPU& operator=(const CPU&)  = delete;
-	CPU& operator=(CPU&&)		= delete;
-
-	void emulate(const std::string& ROM);
-
-	static address_t randomNumber(address_t max) noexcept;
+#pragma once
+
+#include "capture.hpp"
+#include "pixel.hpp"
+#include "rompack.hpp"
+#include "telemetry.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <fstream>
+#include <optional>
+#include <string_view>
+#include <unordered_set>
+#include <SFML/Audio.hpp>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+class Debugger;
+class SharedFrames;
+class Upscaler;
+
+class CPU {
+public:
+	using byte_t = unsigned char;
+	using address_t = short unsigned;
+
+	static constexpr address_t memorySize{ 0x1000 };
+	static constexpr address_t memoryStart{ 0x200 };
+	static constexpr address_t memoryUsableSize{ memorySize - memoryStart };
+	static constexpr address_t addressMask{ memorySize - 1u };
+
+	static_assert((memorySize & addressMask) == 0, "memory accesses are wrapped with addressMask");
+
+	static constexpr std::size_t maxJumps{ 0x10 };
+
+	// errors of the running program; emulation stops on any of them
+	enum class Fault {
+		none,
+		stackUnderflow,		// 00EE with an empty call stack
+		stackOverflow,		// 2NNN with maxJumps calls already nested
+		jumpOutOfMemory		// BNNN to V0 + NNN >= memorySize
+	};
+
+	// how frames are filled with opcodes
+	enum class Timing {
+		flat,		// opcodesPerFrame opcodes per frame
+		cosmacVip	// opcodes cost the time the COSMAC VIP interpreter takes, a frame runs vipCyclesPerFrame machine cycles
+	};
+
+	// opcode sequences setFusion() executes as a single handler
+	enum Fusion : unsigned {
+		spriteDraw,		// ANNN DXYN
+		loadRun,		// 6XNN 6XNN...
+		timerWait,		// FX07 3XNN 1NNN jumping back to FX07
+		bcdLoad,		// FX33 FY65
+		storeBcdLoad,	// FZ55 FX33 FY65
+		nFusions
+	};
+
+	static constexpr std::size_t fontSize{ 5 };
+
+	// characters 0 to F, fontSize bytes each, stored from address 0
+	// see here for further informations : http://devernay.free.fr/hacks/chip8/C8TECH10.HTM#font
+	static constexpr std::array<byte_t, 0x10 * fontSize> font{
+		0xF0, 0x90, 0x90, 0x90, 0xF0, // 0
+		0x20, 0x60, 0x20, 0x20, 0x70, // 1
+		0xF0, 0x10, 0xF0, 0x80, 0xF0, // 2
+		0xF0, 0x10, 0xF0, 0x10, 0xF0, // 3
+		0x90, 0x90, 0xF0, 0x10, 0xF0, // 4
+		0xF0, 0x80, 0xF0, 0x10, 0xF0, // 5
+		0xF0, 0x80, 0xF0, 0x90, 0xF0, // 6
+		0xF0, 0x10, 0x20, 0x40, 0x40, // 7
+		0xF0, 0x90, 0xF0, 0x90, 0xF0, // 8
+		0xF0, 0x90, 0xF0, 0x10, 0xF0, // 9
+		0xF0, 0x90, 0xF0, 0x90, 0x90, // A
+		0xE0, 0x90, 0xE0, 0x90, 0xE0, // B
+		0xF0, 0x80, 0x80, 0xF0, 0xF0, // C
+		0xE0, 0x90, 0x90, 0x90, 0xE0, // D
+		0xF0, 0x80, 0xF0, 0x80, 0xF0, // E
+		0xF0, 0x80, 0xF0, 0x80, 0x80  // F
+	};
+
+	static_assert(memoryUsableSize == RomPack::maxImageSize);
+
+	struct Registers {
+		std::array<byte_t, 0x10>	V;
+		address_t					I;
+		address_t					pc;
+		byte_t						gameTimer;
+		byte_t						soundTimer;
+		byte_t						stackSize;
+
+		bool operator==(const Registers&) const = default;
+	};
+
+	// copyable and I/O-free copy of the whole machine, enough to resume emulation from it
+	struct State {
+		std::array<byte_t, memorySize>	memory;
+		std::array<byte_t, 0x10>		V;
+		std::array<address_t, maxJumps>	stack;		// only the first stackSize are used
+		address_t						I;
+		address_t						pc;
+		byte_t							stackSize;
+		byte_t							gameTimer;
+		byte_t							soundTimer;
+		std::uint16_t					keys;		// bit N = key N held
+		std::uint32_t					random;
+		Fault							fault;
+		Screen::Frame					screen;
+
+		bool operator==(const State&) const = default;
+
+		// covers everything but the keys, which the next input replaces anyway
+		std::uint64_t hash() const noexcept;
+	};
+
+private:
+	std::optional<sf::RenderWindow> window{}; // only exists while emulate() runs, the CPU is headless otherwise
+
+	FrameRecorder*					recorder_{};
+	Telemetry*						telemetry_{};
+	Debugger*						debugger_{};
+	SharedFrames*					shared_{};
+	Upscaler*						upscaler_{};
+	std::optional<sf::Texture>		upscaled_{};	// upscaler_'s output, only exists while emulate() runs
+
+	State							state_{};	// the machine, which Core::execute() runs opcodes on
+
+	// Pixels drawn by emulate(), which follow state_.screen once read : headless runs never draw them
+	mutable Screen					screen{};
+	mutable bool					screenStale_{ false };
+
+	// emulator => Chip 8
+	// 1 2 3 4	=> 1 2 3 C
+	// A Z E R	=> 4 5 6 D
+	// Q S D F	=> 7 8 9 E
+	// W X C V	=> A 0 B F
+
+	using key_t = std::pair<sf::Keyboard::Key /* real input : emulator */, sf::Keyboard::Key /* virtual key : Chip8 */>;
+
+	enum class Chip8Key {
+		_1 = sf::Keyboard::Num1,
+		_2 = sf::Keyboard::Num2,
+		_3 = sf::Keyboard::Num3,
+		_4 = sf::Keyboard::A,
+		_5 = sf::Keyboard::Z,
+		_6 = sf::Keyboard::E,
+		_7 = sf::Keyboard::Q,
+		_8 = sf::Keyboard::S,
+		_9 = sf::Keyboard::D,
+		_0 = sf::Keyboard::X,
+		_A = sf::Keyboard::W,
+		_B = sf::Keyboard::C,
+		_C = sf::Keyboard::Num4,
+		_D = sf::Keyboard::R,
+		_E = sf::Keyboard::F,
+		_F = sf::Keyboard::V
+	};
+
+	static constexpr std::size_t pcIncrement{ sizeof(address_t) / sizeof(byte_t) };
+
+	// 1NNN jumping on itself, only reported in the debug log
+	enum class Loop {
+		none,	// not in loop
+		first,	// first time in loop
+		in		// in the loop
+	};
+	Loop							loop_{ Loop::none };
+
+	Timing							timing_{ Timing::flat };
+	std::uint16_t					quirks_{ RomPack::none };	// combination of RomPack::Quirk, given to Core::execute()
+	std::size_t						frameOpcodes_{};	// opcodes already executed in the current frame, if the debugger paused it or stepOpcode() ran them
+	std::uint32_t					frameCycles_{};		// Timing::cosmacVip cycles spent in the current frame, the overflow is carried to the next one
+	std::size_t						lastFrameOpcodes_{ opcodesPerFrame };
+
+	bool							fusion_{ false };
+
+	std::size_t						runAhead_{};
+	bool							speculating_{ false };	// frames run ahead are headless : FX0A doesn't wait for the window
+	std::array<std::uint64_t, nFusions>	fusionHits_{};
+
+	// debug builds log every opcode; each CPU has its own file, opened (and truncated) when the first line is written
+	std::size_t						instance_{};
+	std::optional<std::ofstream>	log_{};
+	static inline std::atomic<std::size_t> nInstances_{ 0u };
+
+	std::string logPath() const;
+
+	using opcodeHex_t = address_t;
+	static constexpr std::size_t nOpcodes{ 35 };
+	std::string ROM_{};
+
+	enum class Opcode { // underscores to avoid naming problems (an identifier cannot begin with a number)
+		// calls RCA 1082's routine at address NNN (not used in modern implementations)
+		_0NNN = 0x0000,
+
+		// erases screen
+		_00E0 = 0x00E0,
+
+		// returns from a subroutine
+		_00EE = 0x00EE,
+
+		// jumps to address NNN
+		_1NNN = 0x1000,
+
+		// calls subroutine at address NNN
+		_2NNN = 0x2000,
+
+		// skips next instruction if VX == NN
+		_3XNN = 0x3000,
+
+		// skips next instruction if VX != NN
+		_4XNN = 0x4000,
+
+		// skips next instrucion if VX == VY
+		_5XY0 = 0x5000,
+
+		// VX = NN
+		_6XNN = 0x6000,
+
+		// VX += NN
+		_7XNN = 0x7000,
+
+		// VX = VY
+		_8XY0 = 0x8000,
+
+		// VX |= VY
+		_8XY1 = 0x8001,
+
+		// VX &= VY
+		_8XY2 = 0x8002,
+
+		// VX ^= VY
+		_8XY3 = 0x8003,
+
+		// VX += VY; VF is set to 1 if overflow (carry), otherwise to 0
+		_8XY4 = 0x8004,
+
+		// VX -= VY; VF is set to 0 if overflow (borrow); otherwise to 1
+		_8XY5 = 0x8005,
+
+		// VX >>= 1; VF = VX's LSB before shift
+		_8XY6 = 0x8006,
+
+		// VX = VY - VX; VF is set to 0 if overflow (borrow), otherwise to 1
+		_8XY7 = 0x8007,
+
+		// VX <<= 1; VF is set to VX's MSB before shift
+		_8XYE = 0x800E,
+
+		// skips next instruction if VX != VY
+		_9XY0 = 0x9000,
+
+		// I = NNN
+		_ANNN = 0xA000,
+
+		// jumps to address V0 + NNN
+		_BNNN = 0xB000,
+
+		// VX = random number lesser than NN
+		_CXNN = 0xC000,
+
+		// displays a sprite at coords (VX ; VY), the sprite has a 8px width and a Npx height.
+		// each row of 8 pixels is read as binary-coded from memory[I], I isn't modified
+		// VF is set to 1 is collision, otherwise 0
+		_DXYN = 0xD000,
+
+		// skips next instruction if key stored in VX's pressed
+		_EX9E = 0xE09E,
+
+		// skips next instruction if key stored in VX isn't pressed
+		_EXA1 = 0xE0A1,
+
+		// VX = gameTimer
+		_FX07 = 0xF007,
+
+		// waits for a key press, then store it into VX
+		_FX0A = 0xF00A,
+
+		// gameTimer = VX
+		_FX15 = 0xF015,
+
+		// soundTimer = VX
+		_FX18 = 0xF018,
+
+		// I += VX; VF is set to 1 if overflow (carry), otherwise to 0
+		_FX1E = 0xF01E,
+
+		// I = address of character stored in VX; characters 0-H (in hex) are represented by a 4*5 font
+		_FX29 = 0xF029,
+
+		// copies VX's decimal value in memory, at addresses I (hundreds), I+1 (tens), and I+2 (units)
+		_FX33 = 0xF033,
+
+		// stores V0 to VX (included) in memory starting at address I (isn't modified)
+		_FX55 = 0xF055,
+
+		// fills V0 to VX (included) from memory starting at address I (isn't modified)
+		_FX65 = 0xF065
+	};
+
+	using mask_t = opcodeHex_t;
+	using results_t = std::pair<mask_t, Opcode>;
+
+	static constexpr std::array<results_t, nOpcodes> opcodesAND{
+		results_t{0xF000, Opcode::_0NNN},
+		results_t{0xFFFF, Opcode::_00E0},
+		results_t{0xFFFF, Opcode::_00EE},
+		results_t{0xF000, Opcode::_1NNN},
+		results_t{0xF000, Opcode::_2NNN},
+		results_t{0xF000, Opcode::_3XNN},
+		results_t{0xF000, Opcode::_4XNN},
+		results_t{0xF00F, Opcode::_5XY0},
+		results_t{0xF000, Opcode::_6XNN},
+		results_t{0xF000, Opcode::_7XNN},
+		results_t{0xF00F, Opcode::_8XY0},
+		results_t{0xF00F, Opcode::_8XY1},
+		results_t{0xF00F, Opcode::_8XY2},
+		results_t{0xF00F, Opcode::_8XY3},
+		results_t{0xF00F, Opcode::_8XY4},
+		results_t{0xF00F, Opcode::_8XY5},
+		results_t{0xF00F, Opcode::_8XY6},
+		results_t{0xF00F, Opcode::_8XY7},
+		results_t{0xF00F, Opcode::_8XYE},
+		results_t{0xF00F, Opcode::_9XY0},
+		results_t{0xF000, Opcode::_ANNN},
+		results_t{0xF000, Opcode::_BNNN},
+		results_t{0xF000, Opcode::_CXNN},
+		results_t{0xF000, Opcode::_DXYN},
+		results_t{0xF0FF, Opcode::_EX9E},
+		results_t{0xF0FF, Opcode::_EXA1},
+		results_t{0xF0FF, Opcode::_FX07},
+		results_t{0xF0FF, Opcode::_FX0A},
+		results_t{0xF0FF, Opcode::_FX15},
+		results_t{0xF0FF, Opcode::_FX18},
+		results_t{0xF0FF, Opcode::_FX1E},
+		results_t{0xF0FF, Opcode::_FX29},
+		results_t{0xF0FF, Opcode::_FX33},
+		results_t{0xF0FF, Opcode::_FX55},
+		results_t{0xF0FF, Opcode::_FX65},
+	};
+
+	void checkKeys();
+
+	static std::string opcodeToStr(opcodeHex_t opcode, std::size_t finalLength = 4);
+
+	static constexpr bool isOpcode(opcodeHex_t opcode) noexcept;
+
+	void initializeFonts();
+
+	void count() noexcept;
+
+	opcodeHex_t nextOpcode() const;
+
+	// executes <opcode> with Core::execute(), then logs it
+	void interpretOpcode(opcodeHex_t opcode);
+
+	// FX0A with a window : waits for a Chip8 key to be pressed, then stores it into VX
+	void waitKey(byte_t X);
+
+	// executes the Fusion starting at pc, if any, within <budget> opcodes
+	// returns the number of opcodes it counts for, 0 if there's nothing to fuse
+	std::size_t stepFused(std::size_t budget);
+
+	// clears memory, registers, stack, keys and screen, then reloads fonts
+	void reset();
+
+	void run(const std::string& ROMname);
+
+	// draws the screen as it will be runAhead_ frames later with the keys held now, then goes back to the current frame
+	// frames run ahead aren't recorded, published, nor stopped by the debugger
+	void drawAhead();
+
+	// draws the screen as Pixels, or through upscaler_ if present() set one
+	void drawScreen();
+
+	static Chip8Key byteToChip8Key(byte_t keycode);
+
+	static char chip8KeyName(sf::Keyboard::Key key) noexcept;
+
+	// value of a key name given by chip8KeyName() ('0' to 'F')
+	static constexpr byte_t keyNameToValue(char keyName) noexcept {
+		return static_cast<byte_t>(keyName <= '9' ? keyName - '0' : keyName - 'A' + 10);
+	}
+
+	// state of the key in a V register; like byteToChip8Key(), any value above 0xF is key 0
+	bool isPressed(byte_t keycode) const;
+
+	// if there's any opcode to execute after this one
+	constexpr bool isThereOpcodeAfter() const noexcept;
+
+	bool isOver() const noexcept;
+
+	// COSMAC VIP machine cycles spent once <opcode> is executed, from <cycles> spent before it
+	std::uint32_t vipCycles(opcodeHex_t opcode, std::uint32_t cycles) const noexcept;
+
+	// stepFrame()'s loop; the debugging one asks the debugger around each opcode, the timed one counts cycles instead of opcodes,
+	// the fused one tries stepFused() before each opcode
+	template <bool debugging, bool timed, bool fused>
+	bool runFrame();
+
+public:
+	static constexpr auto FPS{ 60u };
+	static_assert(FPS == FrameRecorder::FPS);
+	static constexpr auto delay{ 1.f / FPS }; // delay time in seconds; should be float to avoid truncating while calling sf::seconds
+
+	// past that many frames behind schedule (e.g. after a pause), emulate() gives up catching up
+	static constexpr auto maxFramesLate{ 5u };
+
+	static constexpr std::size_t maxRunAhead{ 3u };
+
+	static constexpr auto frequency{ 250u };
+	static constexpr auto opcodesPerFrame{ 1000u / frequency }; // while <delay> ms, <opcodesPerSecond> operations must be done
+
+	// an 1802 machine cycle is 8 clocks at 1.76 MHz; each frame, the 1861 display DMA steals 1024 of them (128 lines of 8 bytes)
+	static constexpr std::uint32_t vipCyclesPerFrame{ 1'760'000u / 8u / FPS - 1024u };
+
+	CPU();
+
+	CPU(const CPU&)				= delete;
+	CPU(CPU&&)					= delete;
+
+	CPU& operator=(const CPU&)  = delete;
+	CPU& operator=(CPU&&)		= delete;
+
+	void emulate(const std::string& ROM);
+
+	// emulates a ROM from a memory-mapped pack, without any prompt nor file access
+	void emulate(const RomPack& pack, const RomPack::Entry& entry);
+
+	// copies a raw image at memoryStart after a reset, returns false if the image is too big
+	bool loadImage(const byte_t* image, std::size_t size);
+
+	bool loadGame(const std::string& ROM);
+
+	// headless : executes one opcode, returns false if there's nothing left to emulate
+	bool step();
+
+	// headless : updates timers and records the screen, as done after each frame
+	void endFrame();
+
+	// headless : executes one opcode as part of the current frame, and ends the frame after its last opcode
+	// so that stepping opcode by opcode times the ROM as stepFrame() does; returns false if there's nothing left to emulate
+	bool stepOpcode();
+
+	// headless : executes one frame worth of opcodes, then ends the frame
+	// returns false if there's nothing left to emulate
+	// with an armed debugger, returns true as soon as it stops; the next call resumes the frame where it paused
+	bool stepFrame();
+
+	// takes effect from the next frame
+	void setTiming(Timing timing) noexcept;
+
+	inline Timing timing() const noexcept {
+		return timing_;
+	}
+
+	// combination of RomPack::Quirk the next opcodes run with, kept by reset(); vipTiming is setTiming()'s, not this
+	inline void setQuirks(std::uint16_t quirks) noexcept {
+		quirks_ = quirks;
+	}
+
+	inline std::uint16_t quirks() const noexcept {
+		return quirks_;
+	}
+
+	// emulate() shows each frame as it will be <frames> frames later (at most maxRunAhead), which hides as much input latency
+	// the CPU goes back to the real frame once it's drawn : each frame costs 1 + <frames> frames of emulation
+	inline void setRunAhead(std::size_t frames) noexcept {
+		runAhead_ = std::min(frames, maxRunAhead);
+	}
+
+	inline std::size_t runAhead() const noexcept {
+		return runAhead_;
+	}
+
+	// opcodes executed by the last frame, always opcodesPerFrame with Timing::flat
+	inline std::size_t lastFrameOpcodes() const noexcept {
+		return lastFrameOpcodes_;
+	}
+
+	// fuses the sequences of Fusion, with the same effects as running them opcode by opcode; off by default
+	// frames are only fused with Timing::flat and without an armed debugger, which both need every single opcode
+	inline void setFusion(bool enabled) noexcept {
+		fusion_ = enabled;
+	}
+
+	inline bool fusion() const noexcept {
+		return fusion_;
+	}
+
+	// how many times each Fusion ran since construction
+	inline const std::array<std::uint64_t, nFusions>& fusionHits() const noexcept {
+		return fusionHits_;
+	}
+
+	static const char* fusionName(Fusion fusion) noexcept;
+
+	// every frame stepped from now on is pushed to <recorder>; nullptr stops recording
+	inline void record(FrameRecorder* recorder) noexcept {
+		recorder_ = recorder;
+	}
+
+	// emulate() feeds <telemetry> with the timings of every frame; nullptr stops it
+	inline void monitor(Telemetry* telemetry) noexcept {
+		telemetry_ = telemetry;
+	}
+
+	// stepFrame() lets <debugger> stop emulation while it's armed; nullptr detaches it
+	// in emulate()'s window, the title shows when it stopped and F5 resumes it
+	inline void attach(Debugger* debugger) noexcept {
+		debugger_ = debugger;
+	}
+
+	// every frame stepped from now on is published to <shared>, whose input drives the keypad; nullptr stops sharing
+	inline void share(SharedFrames* shared) noexcept {
+		shared_ = shared;
+	}
+
+	// emulate() draws frames upscaled by <upscaler> instead of Pixels; nullptr goes back to Pixels
+	inline void present(Upscaler* upscaler) noexcept {
+		upscaler_ = upscaler;
+	}
+
+	inline const Screen& getScreen() const noexcept {
+		if (screenStale_) {
+			screen.load(state_.screen);
+			screenStale_ = false;
+		}
+		return screen;
+	}
+
+	// the packed frame as executed, without loading the Pixels : what headless readers want
+	inline const Screen::Frame& frame() const noexcept {
+		return state_.screen;
+	}
+
+	inline const std::array<byte_t, memorySize>& getMemory() const noexcept {
+		return state_.memory;
+	}
+
+
+	Registers registers() const noexcept;
+
+	State snapshot() const;
+
+	void restore(const State& state);
+
+	// CXNN results only depend on the seed, which is time-based by default
+	void seed(std::uint32_t value) noexcept;
+
+	// headless input, <key> is the Chip8 key value (0x0 to 0xF)
+	void setKey(byte_t key, bool pressed);
+
+	// headless input, bit N of <keys> is Chip8 key N
+	void setKeys(std::uint16_t keys);
+
+	inline Fault fault() const noexcept {
+		return state_.fault;
+	}
+
+	static const char* faultName(Fault fault) noexcept;
+
+	address_t randomNumber(address_t max) noexcept;
 };
\ No newline at end of file
@@ -0,0 +1,401 @@
+#include "debugger.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace {
+	std::string hex(unsigned value, int width) {
+		std::ostringstream ostream{};
+		ostream << std::setw(width) << std::setfill('0') << std::hex << std::uppercase << value;
+		return ostream.str();
+	}
+
+	CPU::address_t opcodeAt(const CPU& cpu, CPU::address_t pc) {
+		const auto& memory{ cpu.getMemory() };
+		return static_cast<CPU::address_t>(memory[pc & CPU::addressMask] << 8 | memory[(pc + 1u) & CPU::addressMask]);
+	}
+
+	std::string registerName(unsigned reg) {
+		switch (reg) {
+		case Debugger::I:	return "I";
+		case Debugger::DT:	return "DT";
+		case Debugger::ST:	return "ST";
+		case Debugger::SP:	return "SP";
+		default:			return 'V' + hex(reg, 1);
+		}
+	}
+
+	unsigned registerValue(const CPU::Registers& registers, unsigned reg) {
+		switch (reg) {
+		case Debugger::I:	return registers.I;
+		case Debugger::DT:	return registers.gameTimer;
+		case Debugger::ST:	return registers.soundTimer;
+		case Debugger::SP:	return registers.stackSize;
+		default:			return registers.V[reg];
+		}
+	}
+
+	// the instruction we stop before is executed first when resuming
+	bool stopsBefore(Debugger::Reason reason) noexcept {
+		return reason != Debugger::Reason::registerChange && reason != Debugger::Reason::step;
+	}
+}
+
+void Debugger::addBreakpoint(address_t pc) {
+	pc &= CPU::addressMask;
+	nBreakpoints_ += !breakpoints_[pc];
+	breakpoints_[pc] = true;
+}
+
+void Debugger::removeBreakpoint(address_t pc) {
+	pc &= CPU::addressMask;
+	nBreakpoints_ -= breakpoints_[pc];
+	breakpoints_[pc] = false;
+}
+
+void Debugger::watchMemory(address_t first, address_t last, Access access) {
+	watches_.push_back({ std::min(first, last), std::max(first, last), access });
+}
+
+void Debugger::watchRegister(unsigned reg) {
+	if (reg < nRegisters) {
+		watchedRegisters_[reg] = true;
+	}
+}
+
+void Debugger::clear() {
+	breakpoints_.reset();
+	nBreakpoints_ = 0u;
+	watches_.clear();
+	watchedRegisters_.reset();
+}
+
+void Debugger::resume() {
+	skipOnce_ = stopped_ && stopsBefore(stopped_->reason);
+	stopped_.reset();
+}
+
+void Debugger::step(std::size_t count) {
+	resume();
+	stepsLeft_ = count;
+}
+
+void Debugger::stepOver(const CPU& cpu) {
+	resume();
+	const auto registers{ cpu.registers() };
+	if ((opcodeAt(cpu, registers.pc) & 0xF000) == 0x2000) {
+		stepOverReturn_ = static_cast<address_t>(registers.pc + 2u);
+		stepOverDepth_ = registers.stackSize;
+	}
+	else {
+		stepsLeft_ = 1u;
+	}
+}
+
+void Debugger::runTo(address_t pc) {
+	resume();
+	runTo_ = pc;
+}
+
+void Debugger::stop(Reason reason, const CPU::Registers& registers, address_t address, unsigned reg) {
+	stopped_ = Stop{ reason, registers.pc, address, reg };
+	// a stop ends any pending request
+	stepsLeft_ = 0u;
+	runTo_.reset();
+	stepOverReturn_.reset();
+}
+
+bool Debugger::accesses(const CPU& cpu, Access access, address_t& address) const {
+	const auto registers{ cpu.registers() };
+	const auto opcode{ opcodeAt(cpu, registers.pc) };
+	const unsigned X{ (opcode >> 8) & 0xFu };
+	unsigned size{ 0u };
+	Access kind{ read };
+	if ((opcode & 0xF000) == 0xD000) {
+		size = opcode & 0xFu;
+	}
+	else if ((opcode & 0xF0FF) == 0xF065) {
+		size = X + 1u;
+	}
+	else if ((opcode & 0xF0FF) == 0xF033) {
+		size = 3u;
+		kind = write;
+	}
+	else if ((opcode & 0xF0FF) == 0xF055) {
+		size = X + 1u;
+		kind = write;
+	}
+	if (!(kind & access)) {
+		return false;
+	}
+	for (unsigned i{ 0u }; i < size; i++) {
+		const auto accessed{ static_cast<address_t>((registers.I + i) & CPU::addressMask) };
+		for (const auto& watch : watches_) {
+			if ((watch.access & kind) && watch.first <= accessed && accessed <= watch.last) {
+				address = accessed;
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool Debugger::pauses(const CPU& cpu) {
+	if (stopped_) {
+		return true;
+	}
+	const auto registers{ cpu.registers() };
+	previous_ = registers;
+	if (skipOnce_) {
+		skipOnce_ = false;
+		return false;
+	}
+	const auto pc{ registers.pc };
+	address_t address{};
+	if (breakpoints_[pc & CPU::addressMask]) {
+		stop(Reason::breakpoint, registers);
+	}
+	else if (runTo_ && pc == *runTo_) {
+		stop(Reason::runTo, registers);
+	}
+	else if (stepOverReturn_ && pc == *stepOverReturn_ && registers.stackSize == stepOverDepth_) {
+		stop(Reason::step, registers);
+	}
+	else if (!watches_.empty() && accesses(cpu, read, address)) {
+		stop(Reason::watchRead, registers, address);
+	}
+	else if (!watches_.empty() && accesses(cpu, write, address)) {
+		stop(Reason::watchWrite, registers, address);
+	}
+	return stopped_.has_value();
+}
+
+void Debugger::executed(const CPU& cpu) {
+	const auto registers{ cpu.registers() };
+	if (watchedRegisters_.any()) {
+		for (unsigned reg{ 0u }; reg < nRegisters; reg++) {
+			if (watchedRegisters_[reg] && registerValue(registers, reg) != registerValue(previous_, reg)) {
+				stop(Reason::registerChange, registers, 0u, reg);
+				return;
+			}
+		}
+	}
+	if (stepsLeft_ && --stepsLeft_ == 0u) {
+		stop(Reason::step, registers);
+	}
+}
+
+std::string Debugger::disassemble(CPU::address_t opcode) {
+	const std::string X{ 'V' + hex((opcode >> 8) & 0xFu, 1) };
+	const std::string Y{ 'V' + hex((opcode >> 4) & 0xFu, 1) };
+	const std::string N{ hex(opcode & 0xFu, 1) };
+	const std::string NN{ "0x" + hex(opcode & 0xFFu, 2) };
+	const std::string NNN{ "0x" + hex(opcode & 0xFFFu, 3) };
+	switch (opcode & 0xF000) {
+	case 0x0000:
+		return opcode == 0x00E0 ? "clear screen" : opcode == 0x00EE ? "return" : "machine routine " + NNN;
+	case 0x1000: return "jump " + NNN;
+	case 0x2000: return "call " + NNN;
+	case 0x3000: return "skip if " + X + " == " + NN;
+	case 0x4000: return "skip if " + X + " != " + NN;
+	case 0x5000: return "skip if " + X + " == " + Y;
+	case 0x6000: return X + " = " + NN;
+	case 0x7000: return X + " += " + NN;
+	case 0x8000:
+		switch (opcode & 0xF) {
+		case 0x0: return X + " = " + Y;
+		case 0x1: return X + " |= " + Y;
+		case 0x2: return X + " &= " + Y;
+		case 0x3: return X + " ^= " + Y;
+		case 0x4: return X + " += " + Y + ", VF = carry";
+		case 0x5: return X + " -= " + Y + ", VF = !borrow";
+		case 0x6: return X + " >>= 1, VF = LSB";
+		case 0x7: return X + " = " + Y + " - " + X + ", VF = !borrow";
+		case 0xE: return X + " <<= 1, VF = MSB";
+		}
+		break;
+	case 0x9000: return "skip if " + X + " != " + Y;
+	case 0xA000: return "I = " + NNN;
+	case 0xB000: return "jump V0 + " + NNN;
+	case 0xC000: return X + " = random <= " + NN;
+	case 0xD000: return "draw " + N + " rows at (" + X + ", " + Y + ")";
+	case 0xE000:
+		if ((opcode & 0xFF) == 0x9E) {
+			return "skip if key " + X + " is pressed";
+		}
+		if ((opcode & 0xFF) == 0xA1) {
+			return "skip if key " + X + " isn't pressed";
+		}
+		break;
+	case 0xF000:
+		switch (opcode & 0xFF) {
+		case 0x07: return X + " = DT";
+		case 0x0A: return X + " = next key pressed";
+		case 0x15: return "DT = " + X;
+		case 0x18: return "ST = " + X;
+		case 0x1E: return "I += " + X;
+		case 0x29: return "I = font of " + X;
+		case 0x33: return "[I] = decimal digits of " + X;
+		case 0x55: return "[I] = V0 to " + X;
+		case 0x65: return "V0 to " + X + " = [I]";
+		}
+		break;
+	}
+	return "data " + hex(opcode, 4);
+}
+
+std::string Debugger::describe(const Stop& stop) {
+	const std::string at{ " at 0x" + hex(stop.pc, 3) };
+	switch (stop.reason) {
+	case Reason::breakpoint:		return "breakpoint" + at;
+	case Reason::watchRead:			return "read of 0x" + hex(stop.address, 3) + at;
+	case Reason::watchWrite:		return "write of 0x" + hex(stop.address, 3) + at;
+	case Reason::registerChange:	return registerName(stop.reg) + " changed, now" + at;
+	case Reason::step:				return "stepped, now" + at;
+	case Reason::runTo:				return "reached" + at;
+	}
+	return at;
+}
+
+void Debugger::console(CPU& cpu, Debugger& debugger, std::istream& in, std::ostream& out) {
+	constexpr std::size_t defaultFrames{ 3600u }; // a minute of emulation
+	const auto where{ [&cpu, &out] {
+		const auto registers{ cpu.registers() };
+		const auto opcode{ opcodeAt(cpu, registers.pc) };
+		out << hex(registers.pc, 3) << "  " << hex(opcode, 4) << "  " << disassemble(opcode) << std::endl;
+	} };
+	const auto run{ [&](std::size_t frames) {
+		for (std::size_t frame{ 0u }; frame < frames; frame++) {
+			if (!cpu.stepFrame()) {
+				out << "Program " << (cpu.fault() == CPU::Fault::none ? "ended" : "faulted : " + std::string{ CPU::faultName(cpu.fault()) }) << std::endl;
+				return;
+			}
+			if (debugger.stopped()) {
+				out << describe(*debugger.stopped()) << std::endl;
+				where();
+				return;
+			}
+		}
+		out << frames << " frames ran" << std::endl;
+		where();
+	} };
+	const auto address{ [](const std::string& word) {
+		return static_cast<address_t>(std::stoul(word, nullptr, 16) & CPU::addressMask);
+	} };
+
+	where();
+	out << "> " << std::flush;
+	for (std::string line{}; std::getline(in, line); out << "> " << std::flush) {
+		std::istringstream words{ line };
+		std::string command{}, first{}, second{}, third{};
+		words >> command >> first >> second >> third;
+		try {
+			if (command == "b" && !first.empty()) {
+				debugger.addBreakpoint(address(first));
+			}
+			else if (command == "d" && !first.empty()) {
+				debugger.removeBreakpoint(address(first));
+			}
+			else if (command == "w" && !first.empty()) {
+				const auto mode{ third.empty() && !second.empty() && !std::isxdigit(static_cast<unsigned char>(second[0])) ? second : third };
+				const auto last{ mode == second || second.empty() ? address(first) : address(second) };
+				debugger.watchMemory(address(first), last, mode == "r" ? read : mode == "w" ? write : readWrite);
+			}
+			else if (command == "wr" && !first.empty()) {
+				unsigned reg{ nRegisters };
+				for (unsigned candidate{ 0u }; candidate < nRegisters; candidate++) {
+					std::string name{ first };
+					std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+					reg = registerName(candidate) == name ? candidate : reg;
+				}
+				if (reg == nRegisters) {
+					out << "Unknown register " << first << std::endl;
+				}
+				debugger.watchRegister(reg);
+			}
+			else if (command == "clear") {
+				debugger.clear();
+			}
+			else if (command == "s") {
+				debugger.step(first.empty() ? 1u : std::stoul(first));
+				run(defaultFrames);
+			}
+			else if (command == "n") {
+				debugger.stepOver(cpu);
+				run(defaultFrames);
+			}
+			else if (command == "u" && !first.empty()) {
+				debugger.runTo(address(first));
+				run(defaultFrames);
+			}
+			else if (command == "c") {
+				debugger.resume();
+				run(first.empty() ? defaultFrames : std::stoul(first));
+			}
+			else if (command == "k" && !first.empty()) {
+				cpu.setKeys(static_cast<std::uint16_t>(std::stoul(first, nullptr, 16)));
+			}
+			else if (command == "r") {
+				const auto registers{ cpu.registers() };
+				for (unsigned reg{ 0u }; reg < nRegisters; reg++) {
+					out << registerName(reg) << '=' << hex(registerValue(registers, reg), reg == I ? 3 : 2) << (reg + 1u < nRegisters ? " " : "\n");
+				}
+				where();
+			}
+			else if (command == "m" && !first.empty()) {
+				const auto start{ address(first) };
+				const std::size_t size{ second.empty() ? 0x10u : std::stoul(second, nullptr, 16) };
+				for (std::size_t i{ 0u }; i < size; i++) {
+					const auto current{ (start + i) & CPU::addressMask };
+					out << (i % 0x10 ? " " : i ? "\n" + hex(static_cast<unsigned>(current), 3) + ' ' : hex(static_cast<unsigned>(current), 3) + ' ')
+						<< hex(cpu.getMemory()[current], 2);
+				}
+				out << std::endl;
+			}
+			else if (command == "x") {
+				const auto& frame{ cpu.frame() };
+				for (const auto row : frame) {
+					for (std::size_t x{ 0u }; x < Screen::widthInPixels; x++) {
+						out << ((row >> (Screen::widthInPixels - 1u - x)) & 1u ? '#' : '.');
+					}
+					out << '\n';
+				}
+				out << std::flush;
+			}
+			else if (command == "q") {
+				return;
+			}
+			else {
+				out << "b <addr>                 adds a breakpoint" << std::endl
+					<< "d <addr>                 removes a breakpoint" << std::endl
+					<< "w <addr> [last] [r|w]    watches memory accesses through I (both by default)" << std::endl
+					<< "wr <V0-VF|I|DT|ST|SP>    watches a register" << std::endl
+					<< "clear                    removes every breakpoint and watchpoint" << std::endl
+					<< "s [n]                    steps n instructions" << std::endl
+					<< "n                        steps over a subroutine call" << std::endl
+					<< "u <addr>                 runs to an address" << std::endl
+					<< "c [frames]               continues" << std::endl
+					<< "k <hex mask>             holds keys (bit N = key N)" << std::endl
+					<< "r                        shows registers" << std::endl
+					<< "m <addr> [hex size]      dumps memory" << std::endl
+					<< "x                        shows the screen" << std::endl
+					<< "q                        quits" << std::endl;
+			}
+		}
+		catch (const std::logic_error&) { // std::stoul
+			out << "Bad number in " << line << std::endl;
+		}
+	}
+}
\ No newline at end of file
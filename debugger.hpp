@@ -0,0 +1,125 @@
+#pragma once
+
+#include "cpu.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <bitset>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// Breakpoints, watchpoints and stepping for a CPU, through CPU::attach().
+// The CPU only runs its checked step loop while something is armed, otherwise it runs the usual one at full speed.
+// Memory watchpoints cover the accesses made through I (DXYN, FX33, FX55, FX65), they stop before the instruction;
+// register watchpoints and steps stop after it. Once stopped, stepFrame() doesn't execute anything until resume(), which F5 calls in CPU::emulate()'s window.
+class Debugger {
+public:
+	using address_t = CPU::address_t;
+
+	enum Access : unsigned {
+		read		= 1u,
+		write		= 2u,
+		readWrite	= read | write
+	};
+
+	// registers which can be watched : V0 to VF, then these
+	enum Register : unsigned {
+		I = 0x10u,
+		DT,
+		ST,
+		SP,
+		nRegisters
+	};
+
+	enum class Reason {
+		breakpoint,
+		watchRead,
+		watchWrite,
+		registerChange,
+		step,
+		runTo
+	};
+
+	struct Stop {
+		Reason		reason;
+		address_t	pc;
+		address_t	address;	// memory accessed, for watchRead and watchWrite
+		unsigned	reg;		// register changed, for registerChange
+	};
+
+private:
+	struct Watch {
+		address_t	first;
+		address_t	last;	// included
+		Access		access;
+	};
+
+	std::bitset<CPU::memorySize>	breakpoints_{};
+	std::size_t						nBreakpoints_{};
+	std::vector<Watch>				watches_{};
+	std::bitset<nRegisters>			watchedRegisters_{};
+
+	std::size_t						stepsLeft_{};
+	std::optional<address_t>		runTo_{};
+	std::optional<address_t>		stepOverReturn_{};	// pc after the 2NNN being stepped over
+	std::size_t						stepOverDepth_{};
+
+	std::optional<Stop>				stopped_{};
+	bool							skipOnce_{ false };	// the instruction we stopped before mustn't stop again
+	CPU::Registers					previous_{};
+
+	void stop(Reason reason, const CPU::Registers& registers, address_t address = 0u, unsigned reg = 0u);
+
+	bool accesses(const CPU& cpu, Access access, address_t& address) const;
+
+public:
+	// true if the CPU must run its checked step loop
+	inline bool armed() const noexcept {
+		return nBreakpoints_ || !watches_.empty() || watchedRegisters_.any() || stepsLeft_ || runTo_ || stepOverReturn_ || stopped_;
+	}
+
+	inline const std::optional<Stop>& stopped() const noexcept {
+		return stopped_;
+	}
+
+	void addBreakpoint(address_t pc);
+	void removeBreakpoint(address_t pc);
+
+	void watchMemory(address_t first, address_t last, Access access);
+	void watchRegister(unsigned reg);
+
+	// removes every breakpoint and watchpoint
+	void clear();
+
+	// the following ones resume execution
+
+	void resume();
+
+	// stops after <count> instructions
+	void step(std::size_t count = 1u);
+
+	// like step(), but a subroutine call is executed until it returns
+	void stepOver(const CPU& cpu);
+
+	// stops before executing the instruction at <pc>
+	void runTo(address_t pc);
+
+	// called by the CPU around each instruction of its checked step loop
+	bool pauses(const CPU& cpu);
+	void executed(const CPU& cpu);
+
+	static std::string disassemble(CPU::address_t opcode);
+
+	static std::string describe(const Stop& stop);
+
+	// interactive session on <in>, <cpu> must be loaded and attached to <debugger>
+	static void console(CPU& cpu, Debugger& debugger, std::istream& in, std::ostream& out);
+};
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "embed.h"
+#include "cpu.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <mutex>
+#include <new>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+static_assert(chip8FrameRows == Screen::heightInPixels);
+static_assert(chip8FaultNone == static_cast<int>(CPU::Fault::none));
+static_assert(chip8FaultStackUnderflow == static_cast<int>(CPU::Fault::stackUnderflow));
+static_assert(chip8FaultStackOverflow == static_cast<int>(CPU::Fault::stackOverflow));
+static_assert(CPU::maxJumps == 16u, "chip8FaultStackOverflow documents it");
+static_assert(chip8FaultJumpOutOfMemory == static_cast<int>(CPU::Fault::jumpOutOfMemory));
+
+struct Chip8 {
+	std::mutex	mutex{};
+	CPU			cpu{};
+};
+
+// no exception may leave a C function
+Chip8* chip8Create(uint32_t seed) {
+	try {
+		const auto chip8{ new Chip8{} };
+		chip8->cpu.seed(seed);
+		return chip8;
+	}
+	catch (const std::bad_alloc&) {
+		return nullptr;
+	}
+}
+
+void chip8Destroy(Chip8* chip8) {
+	delete chip8;
+}
+
+int chip8LoadImage(Chip8* chip8, const uint8_t* image, size_t size) {
+	std::lock_guard lock{ chip8->mutex };
+	return chip8->cpu.loadImage(image, size) ? 0 : -1;
+}
+
+size_t chip8StepFrames(Chip8* chip8, size_t frames) {
+	std::lock_guard lock{ chip8->mutex };
+	size_t frame{ 0u };
+	while (frame < frames && chip8->cpu.stepFrame()) {
+		frame++;
+	}
+	return frame;
+}
+
+void chip8SetKeys(Chip8* chip8, uint16_t keys) {
+	std::lock_guard lock{ chip8->mutex };
+	chip8->cpu.setKeys(keys);
+}
+
+void chip8Framebuffer(Chip8* chip8, uint64_t rows[chip8FrameRows]) {
+	std::lock_guard lock{ chip8->mutex };
+	const auto& frame{ chip8->cpu.frame() };
+	std::copy(frame.cbegin(), frame.cend(), rows);
+}
+
+int chip8Fault(Chip8* chip8) {
+	std::lock_guard lock{ chip8->mutex };
+	return static_cast<int>(chip8->cpu.fault());
+}
\ No newline at end of file
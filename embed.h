@@ -0,0 +1,53 @@
+#pragma once
+
+// C interface to host many emulators in a single process, e.g. one per session of a server.
+// Each handle owns its whole machine and has no shared state with any other one, so different handles run in parallel;
+// every call locks its handle, so a handle may also be used from several threads (the calls are then serialized).
+// Emulation is headless : no window, no sound, no file access.
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+extern "C" {
+#else
+#include <stddef.h>
+#include <stdint.h>
+#endif
+
+typedef struct Chip8 Chip8;
+
+enum {
+	chip8FrameRows = 32	// rows of a framebuffer, 64 pixels each
+};
+
+// what chip8Fault() returns
+enum {
+	chip8FaultNone = 0,				// running normally
+	chip8FaultStackUnderflow = 1,	// 00EE with an empty call stack
+	chip8FaultStackOverflow = 2,	// 2NNN with 16 calls already nested
+	chip8FaultJumpOutOfMemory = 3	// BNNN to V0 + NNN beyond 0xFFF
+};
+
+// <seed> drives CXNN, the same seed and inputs always give the same run; returns NULL if out of memory
+Chip8* chip8Create(uint32_t seed);
+
+void chip8Destroy(Chip8* chip8);
+
+// resets the machine and copies <image> at 0x200; returns 0, or -1 if the image is bigger than 0xE00 bytes
+int chip8LoadImage(Chip8* chip8, const uint8_t* image, size_t size);
+
+// returns how many frames were emulated, fewer than <frames> once the program ended or faulted
+size_t chip8StepFrames(Chip8* chip8, size_t frames);
+
+// bit N of <keys> is key N, held until the next call
+void chip8SetKeys(Chip8* chip8, uint16_t keys);
+
+// one row per element, the most significant bit is the leftmost pixel
+void chip8Framebuffer(Chip8* chip8, uint64_t rows[chip8FrameRows]);
+
+// chip8FaultNone while running normally, otherwise why the program stopped
+int chip8Fault(Chip8* chip8);
+
+#ifdef __cplusplus
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,85 @@
+// In-process fuzz target : arbitrary bytes are loaded as a ROM into a headless CPU, which runs a bounded number of frames.
+// The first 2 bytes of an input are the keypad state held during the run (bit N = key N), the rest is the ROM image.
+//
+// Not part of Chip8.vcxproj, build it with clang, libFuzzer and the sanitizers :
+//	clang++ -std=c++20 -O1 -g -DNDEBUG -fsanitize=fuzzer,address,undefined -fno-sanitize-recover=all
+//		fuzz.cpp cpu.cpp capture.cpp debugger.cpp rompack.cpp sharedframes.cpp telemetry.cpp upscale.cpp
+//		-lsfml-audio -lsfml-graphics -lsfml-window -lsfml-system -pthread -o chip8-fuzz
+//	./chip8-fuzz -max_len=3586 corpus/
+// NDEBUG is required : debug builds terminate on purpose when a ROM misbehaves, which a fuzzer would report as a crash.
+//
+// Defining CHIP8_FUZZ_MAIN instead of linking libFuzzer builds a standalone driver (e.g. with -fsanitize=address,undefined
+// under gcc, or /fsanitize=address under MSVC) which replays the files given as arguments, or runs random inputs with -runs=<n>.
+
+#include "cpu.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef CHIP8_FUZZ_MAIN
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace {
+	constexpr std::size_t framesPerInput{ 30u };
+	constexpr std::uint32_t seed{ 0xF0220F22u };
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size) {
+	// a single CPU for the whole process, loadImage() resets it for every input
+	static CPU cpu{};
+	if (size < 2u || size - 2u > CPU::memoryUsableSize) {
+		return -1; // rejected, not added to the corpus
+	}
+	cpu.loadImage(data + 2u, size - 2u);
+	cpu.seed(seed);
+	const unsigned keys{ static_cast<unsigned>(data[0] << 8 | data[1]) };
+	for (CPU::byte_t key{ 0u }; key < 0x10; key++) {
+		cpu.setKey(key, (keys >> key) & 1u);
+	}
+	for (std::size_t frame{ 0u }; frame < framesPerInput && cpu.stepFrame(); frame++) {}
+	return 0;
+}
+
+#ifdef CHIP8_FUZZ_MAIN
+int main(int argc, const char* argv[]) {
+	const std::string runsOption{ "-runs=" };
+	for (int arg{ 1 }; arg < argc; arg++) {
+		const std::string path{ argv[arg] };
+		if (path.starts_with(runsOption)) {
+			const auto runs{ std::stoul(path.substr(runsOption.size())) };
+			std::uint32_t state{ 0x12345678u };
+			std::vector<std::uint8_t> input{};
+			for (unsigned long run{ 0u }; run < runs; run++) {
+				input.resize(2u + state % (CPU::memoryUsableSize + 1u));
+				for (auto& byte : input) {
+					state ^= state << 13;
+					state ^= state >> 17;
+					state ^= state << 5;
+					byte = static_cast<std::uint8_t>(state);
+				}
+				LLVMFuzzerTestOneInput(input.data(), input.size());
+			}
+			std::cout << runs << " random inputs ran" << std::endl;
+			continue;
+		}
+		std::ifstream file{ path, std::ios_base::binary };
+		const std::vector<std::uint8_t> input{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+		LLVMFuzzerTestOneInput(input.data(), input.size());
+		std::cout << path << " ran" << std::endl;
+	}
+	return 0;
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// 64 bits FNV-1a; <seed> allows to chain several buffers into a single hash
+constexpr std::uint64_t fnv1a(const unsigned char* data, std::size_t size, std::uint64_t seed = 0xCBF29CE484222325u) noexcept {
+	for (std::size_t i{ 0u }; i < size; i++) {
+		seed ^= data[i];
+		seed *= 0x100000001B3u;
+	}
+	return seed;
+}
+
+// 64 bits hash reading 32 bytes at a time in 4 independent lanes, several times faster than fnv1a on large buffers
+// only meant for in-memory use (deduplication), its values aren't stable across versions like fnv1a's
+constexpr std::uint64_t hash64(const unsigned char* data, std::size_t size, std::uint64_t seed = 0x9E3779B97F4A7C15u) noexcept {
+	constexpr std::uint64_t prime1{ 0x9E3779B185EBCA87u };
+	constexpr std::uint64_t prime2{ 0xC2B2AE3D27D4EB4Fu };
+	const auto word{ [data](std::size_t i) {
+		std::uint64_t value{};
+		if (std::is_constant_evaluated()) {
+			for (std::size_t byte{ 0u }; byte < 8u; byte++) {
+				value |= std::uint64_t{ data[i + byte] } << (8u * byte);
+			}
+		}
+		else {
+			std::memcpy(&value, data + i, sizeof(value));
+		}
+		return value;
+	} };
+	const auto round{ [](std::uint64_t lane, std::uint64_t value) {
+		return std::rotl(lane + value * prime2, 31) * prime1;
+	} };
+
+	std::uint64_t lanes[4]{ seed + prime1 + prime2, seed + prime2, seed, seed - prime1 };
+	std::size_t i{ 0u };
+	for (; i + 32u <= size; i += 32u) {
+		for (std::size_t lane{ 0u }; lane < 4u; lane++) {
+			lanes[lane] = round(lanes[lane], word(i + 8u * lane));
+		}
+	}
+	std::uint64_t hash{ std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18) + size };
+	for (; i + 8u <= size; i += 8u) {
+		hash = std::rotl(hash ^ round(0u, word(i)), 27) * prime1;
+	}
+	for (; i < size; i++) {
+		hash = std::rotl(hash ^ (data[i] * prime1), 11) * prime2;
+	}
+	// final avalanche, so that every input bit affects every output bit
+	hash ^= hash >> 33;
+	hash *= prime2;
+	hash ^= hash >> 29;
+	hash *= 0x165667B19E3779F9u;
+	hash ^= hash >> 32;
+	return hash;
+}
\ No newline at end of file
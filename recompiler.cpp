@@ -0,0 +1,253 @@
+#include "recompiler.hpp"
+#include "hash.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace {
+	using address_t = Recompiler::address_t;
+
+	// where pc goes after an instruction
+	enum class Flow {
+		next,		// next instruction
+		jump,		// 1NNN
+		call,		// 2NNN, unless the stack is full
+		skip,		// next or the one after
+		wait,		// FX0A : next, or the same one again until a key is held
+		computed	// 00EE, BNNN : only known at runtime
+	};
+
+	Flow flowOf(address_t opcode) noexcept {
+		const unsigned NN{ opcode & 0xFFu };
+		switch (opcode >> 12) {
+		case 0x0: return opcode == 0x00EE ? Flow::computed : Flow::next;
+		case 0x1: return Flow::jump;
+		case 0x2: return Flow::call;
+		case 0x3:
+		case 0x4: return Flow::skip;
+		case 0x5:
+		case 0x9: return (opcode & 0xFu) == 0x0 ? Flow::skip : Flow::next;
+		case 0xB: return Flow::computed;
+		case 0xE: return NN == 0x9E || NN == 0xA1 ? Flow::skip : Flow::next;
+		case 0xF: return NN == 0x0A ? Flow::wait : Flow::next;
+		}
+		return Flow::next;
+	}
+
+	std::string hex(std::uint64_t value, int width) {
+		std::ostringstream ostream{};
+		ostream << "0x" << std::setw(width) << std::setfill('0') << std::hex << std::uppercase << value;
+		return ostream.str();
+	}
+
+	std::string label(address_t address) {
+		std::ostringstream ostream{};
+		ostream << 'a' << std::hex << std::uppercase << address;
+		return ostream.str();
+	}
+
+	// valid C++ identifier from a ROM file name
+	std::string functionName(const std::string& ROM) {
+		std::string name{ std::filesystem::path(ROM).stem().string() };
+		std::replace_if(name.begin(), name.end(), [](unsigned char c) { return !std::isalnum(c); }, '_');
+		if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0]))) {
+			name.insert(name.begin(), '_');
+		}
+		return name + "StepFrame";
+	}
+}
+
+Recompiler::Stats Recompiler::translate(const byte_t* image, std::size_t size, const std::string& function, const std::string& ROMname, std::ostream& out) {
+	size = std::min<std::size_t>(size, CPU::memoryUsableSize);
+	const std::size_t end{ CPU::memoryStart + size };
+	const auto opcodeAt{ [image](std::size_t address) {
+		return static_cast<address_t>(image[address - CPU::memoryStart] << 8 | image[address + 1u - CPU::memoryStart]);
+	} };
+	// only the image's instructions are recompiled; 0000 is left to the interpreter, which ends emulation on it
+	const auto recompilable{ [end, &opcodeAt](std::size_t address) {
+		return address >= CPU::memoryStart && address + 1u < end && opcodeAt(address) != 0u;
+	} };
+
+	// instructions reachable from memoryStart without running anything
+	std::array<bool, CPU::memorySize> reachable{};
+	std::vector<address_t> pending{ CPU::memoryStart };
+	while (!pending.empty()) {
+		const auto address{ pending.back() };
+		pending.pop_back();
+		if (!recompilable(address) || reachable[address]) {
+			continue;
+		}
+		reachable[address] = true;
+		const auto opcode{ opcodeAt(address) };
+		const auto NNN{ static_cast<address_t>(opcode & 0xFFFu) };
+		switch (flowOf(opcode)) {
+		case Flow::next:
+		case Flow::wait:
+			pending.push_back(static_cast<address_t>(address + 2u));
+			break;
+		case Flow::jump:
+			pending.push_back(NNN);
+			break;
+		case Flow::call:
+			pending.push_back(NNN);
+			pending.push_back(static_cast<address_t>(address + 2u)); // where 00EE comes back
+			break;
+		case Flow::skip:
+			pending.push_back(static_cast<address_t>(address + 2u));
+			pending.push_back(static_cast<address_t>(address + 4u));
+			break;
+		case Flow::computed:
+			break;
+		}
+	}
+	std::vector<address_t> instructions{};
+	for (std::size_t address{ CPU::memoryStart }; address < end; address++) {
+		if (reachable[address]) {
+			instructions.push_back(static_cast<address_t>(address));
+		}
+	}
+
+	// code written after an instruction to continue at <target> : the following case, a goto, or the switch
+	std::array<bool, CPU::memorySize> labelled{};
+	const auto continueAt{ [&reachable, &labelled](address_t target, address_t following) -> std::string {
+		if (target == following && reachable[target]) {
+			return "[[fallthrough]];";
+		}
+		if (target < CPU::memorySize && reachable[target]) {
+			labelled[target] = true;
+			return "goto " + label(target) + ';';
+		}
+		return "continue;";
+	} };
+
+	std::ostringstream body{};
+	for (std::size_t i{ 0u }; i < instructions.size(); i++) {
+		const auto address{ instructions[i] };
+		const auto following{ static_cast<address_t>(i + 1u < instructions.size() ? instructions[i + 1u] : 0u) };
+		const auto opcode{ opcodeAt(address) };
+		const auto next{ static_cast<address_t>(address + 2u) };
+		body << "\t\tcase " << hex(address, 3) << ":\n"
+			<< "\t\t" << label(address) << ":\n"
+			<< "\t\t\tif (memory[" << hex(address, 3) << "] != " << hex(opcode >> 8, 2) << " || memory[" << hex(address + 1u, 3) << "] != " << hex(opcode & 0xFFu, 2) << ") {\n"
+			<< "\t\t\t\tbreak;\n"
+			<< "\t\t\t}\n"
+			<< "\t\t\tcore.interpretOpcode(" << hex(opcode, 4) << ");\n"
+			<< "\t\t\tif (!--budget) {\n"
+			<< "\t\t\t\tgoto done;\n"
+			<< "\t\t\t}\n";
+		switch (flowOf(opcode)) {
+		case Flow::next:
+			body << "\t\t\t" << continueAt(next, following) << '\n';
+			break;
+		case Flow::jump:
+			body << "\t\t\t" << continueAt(opcode & 0xFFFu, following) << '\n';
+			break;
+		case Flow::call:
+			body << "\t\t\tif (core.fault() != CPU::Fault::none) {\n"
+				<< "\t\t\t\tcontinue;\n"
+				<< "\t\t\t}\n"
+				<< "\t\t\t" << continueAt(opcode & 0xFFFu, following) << '\n';
+			break;
+		case Flow::skip:
+			body << "\t\t\tif (core.pc() != " << hex(next, 3) << ") {\n"
+				<< "\t\t\t\t" << continueAt(static_cast<address_t>(address + 4u), 0u) << '\n'
+				<< "\t\t\t}\n"
+				<< "\t\t\t" << continueAt(next, following) << '\n';
+			break;
+		case Flow::wait:
+			body << "\t\t\tif (core.pc() == " << hex(address, 3) << ") {\n"
+				<< "\t\t\t\t" << continueAt(address, 0u) << '\n'
+				<< "\t\t\t}\n"
+				<< "\t\t\t" << continueAt(next, following) << '\n';
+			break;
+		case Flow::computed:
+			body << "\t\t\tcontinue;\n";
+			break;
+		}
+	}
+
+	// labels nobody jumps to would be warned about
+	std::string code{ body.str() };
+	Stats stats{ instructions.size(), 0u };
+	for (const auto address : instructions) {
+		if (labelled[address]) {
+			stats.labels++;
+			continue;
+		}
+		const std::string unused{ "\t\t" + label(address) + ":\n" };
+		code.erase(code.find(unused), unused.size());
+	}
+
+	out << "// Recompiled from " << ROMname << " (FNV-1a " << hex(fnv1a(image, size), 16) << ") by Chip8 --recompile, do not edit.\n"
+		<< "// " << stats.instructions << " instructions recompiled, see recompiler.hpp.\n"
+		<< "\n"
+		<< "#include \"core.hpp\"\n"
+		<< "\n"
+		<< "// runs one frame on <core>, which must have loaded " << ROMname << "; same as core.stepFrame()\n"
+		<< "bool " << function << "(Core& core) {\n"
+		<< "\tconst auto& memory{ core.getMemory() };\n"
+		<< "\tunsigned budget{ CPU::opcodesPerFrame };\n"
+		<< "\tfor (;;) {\n"
+		<< "\t\tif (core.fault() != CPU::Fault::none) {\n"
+		<< "\t\t\treturn false;\n"
+		<< "\t\t}\n"
+		<< "\t\tswitch (core.pc()) {\n"
+		<< code
+		<< "\t\tdefault:\n"
+		<< "\t\t\tbreak;\n"
+		<< "\t\t}\n"
+		<< "\t\t// not recompiled, or overwritten by the program\n"
+		<< "\t\tif (!core.step()) {\n"
+		<< "\t\t\treturn false;\n"
+		<< "\t\t}\n"
+		<< "\t\tif (!--budget) {\n"
+		<< "\t\t\tgoto done;\n"
+		<< "\t\t}\n"
+		<< "\t}\n"
+		<< "done:\n"
+		<< "\tcore.endFrame();\n"
+		<< "\treturn true;\n"
+		<< "}\n";
+	return stats;
+}
+
+bool Recompiler::recompile(const std::string& ROM, const std::string& output, std::string function) {
+	std::ifstream ROMfile{ ROM, std::ios_base::binary };
+	if (!ROMfile) {
+		std::cerr << "Error cannot open ROM " << ROM << " !" << std::endl;
+		return false;
+	}
+	const std::vector<byte_t> image(std::istreambuf_iterator<char>{ ROMfile }, std::istreambuf_iterator<char>{});
+	if (image.size() > CPU::memoryUsableSize) {
+		std::cerr << "Error ROM " << ROM << " is too big (" << image.size() << " bytes) !" << std::endl;
+		return false;
+	}
+	if (function.empty()) {
+		function = functionName(ROM);
+	}
+	std::ofstream file{ output, std::ios_base::trunc };
+	const auto ROMname{ std::filesystem::path(ROM).filename().string() };
+	const auto stats{ translate(image.data(), image.size(), function, ROMname, file) };
+	if (!file) {
+		std::cerr << "Error cannot write file " << output << " !" << std::endl;
+		return false;
+	}
+	std::cout << stats.instructions << " instructions of " << ROMname << " recompiled into " << function << "() in " << output << std::endl;
+	return true;
+}
\ No newline at end of file
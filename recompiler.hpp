@@ -0,0 +1,42 @@
+#pragma once
+
+#include "cpu.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <iosfwd>
+#include <string>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// Ahead-of-time translation of a ROM to C++ : the output defines bool <function>(Core& core), which runs one frame as Core::stepFrame().
+// Every instruction reachable from memoryStart becomes a case of a switch on pc, followed straight by its successor, so that
+// known jumps are gotos and only computed targets (00EE, BNNN, taken skips) go back through the switch.
+// Each instruction is Core::interpretOpcode() with a constant opcode, inlined by the compiler : the semantics are Core::execute(), which CPU runs too.
+// recompiler_check.cpp runs a recompiled test ROM against CPU frame by frame.
+// The interpreter takes over wherever the code isn't recompiled : computed targets outside of the recompiled set,
+// instructions the program overwrote (each one checks its opcode is still in memory), and faults.
+// Usage of the output, linked against core.hpp only :
+//	Core core{};
+//	core.loadImage(image, size);
+//	while (<function>(core)) {}
+class Recompiler {
+public:
+	using byte_t = CPU::byte_t;
+	using address_t = CPU::address_t;
+
+	struct Stats {
+		std::size_t instructions{};	// recompiled instructions
+		std::size_t labels{};		// instructions which are the target of a goto
+	};
+
+	// writes the C++ source recompiled from <image> to <out>
+	static Stats translate(const byte_t* image, std::size_t size, const std::string& function, const std::string& ROMname, std::ostream& out);
+
+	// recompiles the ROM file <ROM> to <output>; the function is named after the ROM unless <function> is given
+	static bool recompile(const std::string& ROM, const std::string& output, std::string function = "");
+};
\ No newline at end of file
@@ -0,0 +1,164 @@
+// Recompiler check : the recompiled test ROM must run as the interpreter, frame by frame.
+//	translation	: Recompiler::translate() of testROM must still give recompiler_check_rom.cpp, which is checked in
+//	lockstep	: recompiler_check_rom.cpp on a Core against a headless CPU, with Conformance::lockstepFrames()
+//	speed		: microseconds per frame of recompiler_check_rom.cpp and of CPU::stepFrame() on testROM, and their ratio, only reported
+// testROM covers every opcode but FX0A, a call, skips taken and not, BNNN, a timer wait, a sprite and an instruction the ROM overwrites.
+// Exits with 1 if anything fails.
+//
+// Not part of Chip8.vcxproj's build, as it has its own main :
+//	g++ -std=c++20 -O2 -DNDEBUG recompiler_check.cpp recompiler_check_rom.cpp recompiler.cpp conformance.cpp cpu.cpp debugger.cpp sharedframes.cpp upscale.cpp capture.cpp telemetry.cpp -lsfml-graphics -lsfml-window -lsfml-system -lsfml-audio -pthread -o chip8-recompiler-check
+//	./chip8-recompiler-check
+// After a change of the recompiler's output, ./chip8-recompiler-check --generate rewrites recompiler_check_rom.cpp, then build again.
+
+#include "conformance.hpp"
+#include "core.hpp"
+#include "recompiler.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// recompiler_check_rom.cpp
+bool recompilerCheckStepFrame(Core& core);
+
+namespace {
+	constexpr std::size_t frames{ 600u };
+	constexpr std::size_t timedFrames{ 100'000u }; // testROM loops forever
+	constexpr std::size_t repeats{ 15u };
+	constexpr const char* functionName{ "recompilerCheckStepFrame" };
+	constexpr const char* ROMname{ "recompiler_check.ch8" };
+
+	constexpr std::array<CPU::byte_t, 135> testROM{
+		0x00, 0xE0, 0x6A, 0x00, 0x6B, 0x00, 0x6E, 0x0A, 0xFE, 0x15, 0xA2, 0x7E, 0xDA, 0xB5, 0x7A, 0x07,
+		0x7B, 0x03, 0xCC, 0x1F, 0x22, 0x7A, 0xA2, 0x83, 0xF2, 0x55, 0xFC, 0x33, 0xF2, 0x65, 0xA2, 0x83,
+		0xFC, 0x33, 0xF2, 0x65, 0x60, 0x12, 0x61, 0x34, 0x62, 0xF6, 0x80, 0x14, 0x80, 0x15, 0x80, 0x16,
+		0x80, 0x1E, 0x80, 0x23, 0x80, 0x11, 0x80, 0x12, 0x80, 0x17, 0x82, 0x06, 0x90, 0x10, 0x70, 0x01,
+		0x30, 0x00, 0x70, 0x02, 0x40, 0x00, 0x70, 0x03, 0x50, 0x10, 0x70, 0x04, 0x63, 0x05, 0xE3, 0xA1,
+		0x70, 0x05, 0xE3, 0x9E, 0x70, 0x06, 0xA2, 0x83, 0xF0, 0x1E, 0xF3, 0x29, 0x60, 0x61, 0x61, 0x42,
+		0xA2, 0x64, 0xF1, 0x55, 0x61, 0x00, 0x60, 0x02, 0xB2, 0x6A, 0x12, 0x6A, 0x12, 0x6E, 0xF8, 0x07,
+		0x38, 0x00, 0x12, 0x6E, 0x6E, 0x0A, 0xFE, 0x15, 0x12, 0x0A, 0x7D, 0x01, 0x00, 0xEE, 0xF0, 0x90,
+		0x90, 0x90, 0xF0, 0x00, 0x00, 0x00, 0x00
+	};
+
+	// the recompiled ROM as a Conformance engine
+	struct Recompiled {
+		Core core{};
+
+		bool stepFrame() {
+			return recompilerCheckStepFrame(core);
+		}
+
+		CPU::Registers registers() const noexcept {
+			return core.registers();
+		}
+
+		const std::array<CPU::byte_t, CPU::memorySize>& getMemory() const noexcept {
+			return core.getMemory();
+		}
+
+		Core::Screen getScreen() const noexcept {
+			return core.getScreen();
+		}
+	};
+
+	std::filesystem::path generatedPath() {
+		return std::filesystem::path{ __FILE__ }.parent_path() / "recompiler_check_rom.cpp";
+	}
+
+	std::string translate() {
+		std::ostringstream out{};
+		Recompiler::translate(testROM.data(), testROM.size(), functionName, ROMname, out);
+		return out.str();
+	}
+
+	// median over <repeats> of the microseconds per frame of a fresh <Engine> running testROM for <timedFrames> frames
+	template <typename Engine, typename Load>
+	double microsPerFrame(Load load) {
+		std::vector<double> samples{};
+		for (std::size_t repeat{ 0u }; repeat < repeats; repeat++) {
+			Engine engine{};
+			load(engine);
+			const auto start{ std::chrono::steady_clock::now() };
+			std::size_t frame{ 0u };
+			for (; frame < timedFrames && engine.stepFrame(); frame++) {}
+			const std::chrono::duration<double, std::micro> elapsed{ std::chrono::steady_clock::now() - start };
+			samples.push_back(elapsed.count() / static_cast<double>(std::max<std::size_t>(frame, 1u)));
+		}
+		std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(repeats / 2u), samples.end());
+		return samples[repeats / 2u];
+	}
+
+	// the checkout may use CRLF and drop the last newline
+	std::string normalized(std::string source) {
+		source.erase(std::remove(source.begin(), source.end(), '\r'), source.end());
+		while (!source.empty() && source.back() == '\n') {
+			source.pop_back();
+		}
+		return source;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	if (argc > 1 && std::string{ argv[1] } == "--generate") {
+		std::ofstream file{ generatedPath(), std::ios_base::binary | std::ios_base::trunc };
+		file << translate();
+		if (!file) {
+			std::cerr << "Error cannot write file " << generatedPath() << " !" << std::endl;
+			return 1;
+		}
+		std::cout << "Generated " << generatedPath().string() << std::endl;
+		return 0;
+	}
+
+	std::size_t failures{ 0u };
+	std::ifstream file{ generatedPath(), std::ios_base::binary };
+	const std::string generated(std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{});
+	if (normalized(generated) != normalized(translate())) {
+		std::cerr << "FAILED translation : " << generatedPath().string() << " is out of date, run --generate" << std::endl;
+		failures++;
+	}
+
+	CPU cpu{};
+	cpu.seed(Conformance::seed);
+	Recompiled recompiled{};
+	recompiled.core.seed(Conformance::seed);
+	if (!cpu.loadImage(testROM.data(), testROM.size()) || !recompiled.core.loadImage(testROM.data(), testROM.size())) {
+		std::cerr << "FAILED loading the test ROM" << std::endl;
+		return 1;
+	}
+	if (const auto divergence{ Conformance::lockstepFrames(cpu, recompiled, frames) }) {
+		std::cerr << "FAILED lockstep at frame " << divergence->frame << " : " << divergence->what << std::endl;
+		failures++;
+	}
+
+	const double interpreted{ microsPerFrame<CPU>([](CPU& engine) {
+		engine.seed(Conformance::seed);
+		engine.loadImage(testROM.data(), testROM.size());
+	}) };
+	const double recompiledSpeed{ microsPerFrame<Recompiled>([](Recompiled& engine) {
+		engine.core.seed(Conformance::seed);
+		engine.core.loadImage(testROM.data(), testROM.size());
+	}) };
+	std::cout << std::fixed << std::setprecision(3)
+		<< "interpreter  " << std::setw(8) << interpreted << " microseconds per frame" << std::endl
+		<< "recompiled   " << std::setw(8) << recompiledSpeed << " microseconds per frame, " << std::setprecision(1) << interpreted / recompiledSpeed << " times faster" << std::endl;
+
+	std::cout << (failures ? "FAIL" : "PASS") << ' ' << frames << " frames of " << ROMname << " recompiled" << std::endl;
+	return failures ? 1 : 0;
+}
\ No newline at end of file
@@ -0,0 +1,552 @@
+// Recompiled from recompiler_check.ch8 (FNV-1a 0xEEC009BEE8B63ED6) by Chip8 --recompile, do not edit.
+// 55 instructions recompiled, see recompiler.hpp.
+
+#include "core.hpp"
+
+// runs one frame on <core>, which must have loaded recompiler_check.ch8; same as core.stepFrame()
+bool recompilerCheckStepFrame(Core& core) {
+	const auto& memory{ core.getMemory() };
+	unsigned budget{ CPU::opcodesPerFrame };
+	for (;;) {
+		if (core.fault() != CPU::Fault::none) {
+			return false;
+		}
+		switch (core.pc()) {
+		case 0x200:
+			if (memory[0x200] != 0x00 || memory[0x201] != 0xE0) {
+				break;
+			}
+			core.interpretOpcode(0x00E0);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x202:
+			if (memory[0x202] != 0x6A || memory[0x203] != 0x00) {
+				break;
+			}
+			core.interpretOpcode(0x6A00);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x204:
+			if (memory[0x204] != 0x6B || memory[0x205] != 0x00) {
+				break;
+			}
+			core.interpretOpcode(0x6B00);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x206:
+			if (memory[0x206] != 0x6E || memory[0x207] != 0x0A) {
+				break;
+			}
+			core.interpretOpcode(0x6E0A);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x208:
+			if (memory[0x208] != 0xFE || memory[0x209] != 0x15) {
+				break;
+			}
+			core.interpretOpcode(0xFE15);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x20A:
+			if (memory[0x20A] != 0xA2 || memory[0x20B] != 0x7E) {
+				break;
+			}
+			core.interpretOpcode(0xA27E);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x20C:
+			if (memory[0x20C] != 0xDA || memory[0x20D] != 0xB5) {
+				break;
+			}
+			core.interpretOpcode(0xDAB5);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x20E:
+			if (memory[0x20E] != 0x7A || memory[0x20F] != 0x07) {
+				break;
+			}
+			core.interpretOpcode(0x7A07);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x210:
+			if (memory[0x210] != 0x7B || memory[0x211] != 0x03) {
+				break;
+			}
+			core.interpretOpcode(0x7B03);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x212:
+			if (memory[0x212] != 0xCC || memory[0x213] != 0x1F) {
+				break;
+			}
+			core.interpretOpcode(0xCC1F);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x214:
+			if (memory[0x214] != 0x22 || memory[0x215] != 0x7A) {
+				break;
+			}
+			core.interpretOpcode(0x227A);
+			if (!--budget) {
+				goto done;
+			}
+			if (core.fault() != CPU::Fault::none) {
+				continue;
+			}
+			goto a27A;
+		case 0x216:
+			if (memory[0x216] != 0xA2 || memory[0x217] != 0x83) {
+				break;
+			}
+			core.interpretOpcode(0xA283);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x218:
+			if (memory[0x218] != 0xF2 || memory[0x219] != 0x55) {
+				break;
+			}
+			core.interpretOpcode(0xF255);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x21A:
+			if (memory[0x21A] != 0xFC || memory[0x21B] != 0x33) {
+				break;
+			}
+			core.interpretOpcode(0xFC33);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x21C:
+			if (memory[0x21C] != 0xF2 || memory[0x21D] != 0x65) {
+				break;
+			}
+			core.interpretOpcode(0xF265);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x21E:
+			if (memory[0x21E] != 0xA2 || memory[0x21F] != 0x83) {
+				break;
+			}
+			core.interpretOpcode(0xA283);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x220:
+			if (memory[0x220] != 0xFC || memory[0x221] != 0x33) {
+				break;
+			}
+			core.interpretOpcode(0xFC33);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x222:
+			if (memory[0x222] != 0xF2 || memory[0x223] != 0x65) {
+				break;
+			}
+			core.interpretOpcode(0xF265);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x224:
+			if (memory[0x224] != 0x60 || memory[0x225] != 0x12) {
+				break;
+			}
+			core.interpretOpcode(0x6012);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x226:
+			if (memory[0x226] != 0x61 || memory[0x227] != 0x34) {
+				break;
+			}
+			core.interpretOpcode(0x6134);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x228:
+			if (memory[0x228] != 0x62 || memory[0x229] != 0xF6) {
+				break;
+			}
+			core.interpretOpcode(0x62F6);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x22A:
+			if (memory[0x22A] != 0x80 || memory[0x22B] != 0x14) {
+				break;
+			}
+			core.interpretOpcode(0x8014);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x22C:
+			if (memory[0x22C] != 0x80 || memory[0x22D] != 0x15) {
+				break;
+			}
+			core.interpretOpcode(0x8015);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x22E:
+			if (memory[0x22E] != 0x80 || memory[0x22F] != 0x16) {
+				break;
+			}
+			core.interpretOpcode(0x8016);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x230:
+			if (memory[0x230] != 0x80 || memory[0x231] != 0x1E) {
+				break;
+			}
+			core.interpretOpcode(0x801E);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x232:
+			if (memory[0x232] != 0x80 || memory[0x233] != 0x23) {
+				break;
+			}
+			core.interpretOpcode(0x8023);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x234:
+			if (memory[0x234] != 0x80 || memory[0x235] != 0x11) {
+				break;
+			}
+			core.interpretOpcode(0x8011);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x236:
+			if (memory[0x236] != 0x80 || memory[0x237] != 0x12) {
+				break;
+			}
+			core.interpretOpcode(0x8012);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x238:
+			if (memory[0x238] != 0x80 || memory[0x239] != 0x17) {
+				break;
+			}
+			core.interpretOpcode(0x8017);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x23A:
+			if (memory[0x23A] != 0x82 || memory[0x23B] != 0x06) {
+				break;
+			}
+			core.interpretOpcode(0x8206);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x23C:
+			if (memory[0x23C] != 0x90 || memory[0x23D] != 0x10) {
+				break;
+			}
+			core.interpretOpcode(0x9010);
+			if (!--budget) {
+				goto done;
+			}
+			if (core.pc() != 0x23E) {
+				goto a240;
+			}
+			[[fallthrough]];
+		case 0x23E:
+			if (memory[0x23E] != 0x70 || memory[0x23F] != 0x01) {
+				break;
+			}
+			core.interpretOpcode(0x7001);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x240:
+		a240:
+			if (memory[0x240] != 0x30 || memory[0x241] != 0x00) {
+				break;
+			}
+			core.interpretOpcode(0x3000);
+			if (!--budget) {
+				goto done;
+			}
+			if (core.pc() != 0x242) {
+				goto a244;
+			}
+			[[fallthrough]];
+		case 0x242:
+			if (memory[0x242] != 0x70 || memory[0x243] != 0x02) {
+				break;
+			}
+			core.interpretOpcode(0x7002);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x244:
+		a244:
+			if (memory[0x244] != 0x40 || memory[0x245] != 0x00) {
+				break;
+			}
+			core.interpretOpcode(0x4000);
+			if (!--budget) {
+				goto done;
+			}
+			if (core.pc() != 0x246) {
+				goto a248;
+			}
+			[[fallthrough]];
+		case 0x246:
+			if (memory[0x246] != 0x70 || memory[0x247] != 0x03) {
+				break;
+			}
+			core.interpretOpcode(0x7003);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x248:
+		a248:
+			if (memory[0x248] != 0x50 || memory[0x249] != 0x10) {
+				break;
+			}
+			core.interpretOpcode(0x5010);
+			if (!--budget) {
+				goto done;
+			}
+			if (core.pc() != 0x24A) {
+				goto a24C;
+			}
+			[[fallthrough]];
+		case 0x24A:
+			if (memory[0x24A] != 0x70 || memory[0x24B] != 0x04) {
+				break;
+			}
+			core.interpretOpcode(0x7004);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x24C:
+		a24C:
+			if (memory[0x24C] != 0x63 || memory[0x24D] != 0x05) {
+				break;
+			}
+			core.interpretOpcode(0x6305);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x24E:
+			if (memory[0x24E] != 0xE3 || memory[0x24F] != 0xA1) {
+				break;
+			}
+			core.interpretOpcode(0xE3A1);
+			if (!--budget) {
+				goto done;
+			}
+			if (core.pc() != 0x250) {
+				goto a252;
+			}
+			[[fallthrough]];
+		case 0x250:
+			if (memory[0x250] != 0x70 || memory[0x251] != 0x05) {
+				break;
+			}
+			core.interpretOpcode(0x7005);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x252:
+		a252:
+			if (memory[0x252] != 0xE3 || memory[0x253] != 0x9E) {
+				break;
+			}
+			core.interpretOpcode(0xE39E);
+			if (!--budget) {
+				goto done;
+			}
+			if (core.pc() != 0x254) {
+				goto a256;
+			}
+			[[fallthrough]];
+		case 0x254:
+			if (memory[0x254] != 0x70 || memory[0x255] != 0x06) {
+				break;
+			}
+			core.interpretOpcode(0x7006);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x256:
+		a256:
+			if (memory[0x256] != 0xA2 || memory[0x257] != 0x83) {
+				break;
+			}
+			core.interpretOpcode(0xA283);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x258:
+			if (memory[0x258] != 0xF0 || memory[0x259] != 0x1E) {
+				break;
+			}
+			core.interpretOpcode(0xF01E);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x25A:
+			if (memory[0x25A] != 0xF3 || memory[0x25B] != 0x29) {
+				break;
+			}
+			core.interpretOpcode(0xF329);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x25C:
+			if (memory[0x25C] != 0x60 || memory[0x25D] != 0x61) {
+				break;
+			}
+			core.interpretOpcode(0x6061);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x25E:
+			if (memory[0x25E] != 0x61 || memory[0x25F] != 0x42) {
+				break;
+			}
+			core.interpretOpcode(0x6142);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x260:
+			if (memory[0x260] != 0xA2 || memory[0x261] != 0x64) {
+				break;
+			}
+			core.interpretOpcode(0xA264);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x262:
+			if (memory[0x262] != 0xF1 || memory[0x263] != 0x55) {
+				break;
+			}
+			core.interpretOpcode(0xF155);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x264:
+			if (memory[0x264] != 0x61 || memory[0x265] != 0x00) {
+				break;
+			}
+			core.interpretOpcode(0x6100);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x266:
+			if (memory[0x266] != 0x60 || memory[0x267] != 0x02) {
+				break;
+			}
+			core.interpretOpcode(0x6002);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x268:
+			if (memory[0x268] != 0xB2 || memory[0x269] != 0x6A) {
+				break;
+			}
+			core.interpretOpcode(0xB26A);
+			if (!--budget) {
+				goto done;
+			}
+			continue;
+		case 0x27A:
+		a27A:
+			if (memory[0x27A] != 0x7D || memory[0x27B] != 0x01) {
+				break;
+			}
+			core.interpretOpcode(0x7D01);
+			if (!--budget) {
+				goto done;
+			}
+			[[fallthrough]];
+		case 0x27C:
+			if (memory[0x27C] != 0x00 || memory[0x27D] != 0xEE) {
+				break;
+			}
+			core.interpretOpcode(0x00EE);
+			if (!--budget) {
+				goto done;
+			}
+			continue;
+		default:
+			break;
+		}
+		// not recompiled, or overwritten by the program
+		if (!core.step()) {
+			return false;
+		}
+		if (!--budget) {
+			goto done;
+		}
+	}
+done:
+	core.endFrame();
+	return true;
+}
\ No newline at end of file
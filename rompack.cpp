@@ -0,0 +1,215 @@
+#include "rompack.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#define PACK_ERROR(msg, path) std::cerr << "Error " << (msg) << " (pack " << std::quoted(path) << ") !" << std::endl
+
+RomPack::~RomPack() {
+	close();
+}
+
+bool RomPack::open(const std::string& path) {
+	close();
+#ifdef _WIN32
+	file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file_ == INVALID_HANDLE_VALUE) {
+		file_ = nullptr;
+		PACK_ERROR("Cannot open file", path);
+		return false;
+	}
+	LARGE_INTEGER fileSize{};
+	GetFileSizeEx(file_, &fileSize);
+	size_ = static_cast<std::size_t>(fileSize.QuadPart);
+	mapping_ = size_ ? CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+	base_ = mapping_ ? static_cast<const byte_t*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+#else
+	const int fd{ ::open(path.c_str(), O_RDONLY) };
+	if (fd < 0) {
+		PACK_ERROR("Cannot open file", path);
+		return false;
+	}
+	struct stat status {};
+	if (fstat(fd, &status) == 0 && status.st_size > 0) {
+		size_ = static_cast<std::size_t>(status.st_size);
+		void* const address{ mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0) };
+		base_ = address == MAP_FAILED ? nullptr : static_cast<const byte_t*>(address);
+	}
+	::close(fd); // the mapping keeps its own reference to the file
+#endif
+	if (!base_) {
+		PACK_ERROR("Cannot map file", path);
+		close();
+		return false;
+	}
+	if (!validate(path)) {
+		close();
+		return false;
+	}
+	return true;
+}
+
+void RomPack::close() noexcept {
+#ifdef _WIN32
+	if (base_) {
+		UnmapViewOfFile(base_);
+	}
+	if (mapping_) {
+		CloseHandle(mapping_);
+	}
+	if (file_) {
+		CloseHandle(file_);
+	}
+	mapping_ = nullptr;
+	file_ = nullptr;
+#else
+	if (base_) {
+		munmap(const_cast<byte_t*>(base_), size_);
+	}
+#endif
+	base_ = nullptr;
+	size_ = 0u;
+}
+
+bool RomPack::validate(const std::string& path) const {
+	if (size_ < sizeof(Header) || header().magic != magic) {
+		PACK_ERROR("Not a ROM pack", path);
+		return false;
+	}
+	if (header().version != version) {
+		PACK_ERROR("Unsupported pack version " + std::to_string(header().version), path);
+		return false;
+	}
+	// entries are read in place : a misaligned index would be undefined behaviour
+	if ((reinterpret_cast<std::uintptr_t>(base_) + sizeof(Header)) % alignof(Entry) != 0u) {
+		PACK_ERROR("Index is misaligned", path);
+		return false;
+	}
+	if (header().count > (size_ - sizeof(Header)) / sizeof(Entry)) {
+		PACK_ERROR("Index is truncated", path);
+		return false;
+	}
+	for (const auto& entry : *this) {
+		const bool terminated{ std::find(entry.name.cbegin(), entry.name.cend(), '\0') != entry.name.cend() };
+		if (!terminated || entry.size > maxImageSize || std::size_t{ entry.offset } + entry.size > size_) {
+			PACK_ERROR("Entry " + std::to_string(&entry - begin()) + " is corrupted", path);
+			return false;
+		}
+	}
+	// find() is a binary search
+	if (!std::is_sorted(begin(), end(), [](const Entry& lhs, const Entry& rhs) { return name(lhs) < name(rhs); })) {
+		PACK_ERROR("Index isn't sorted by name", path);
+		return false;
+	}
+	return true;
+}
+
+const RomPack::Entry* RomPack::find(std::string_view ROMname) const noexcept {
+	const auto entry{ std::lower_bound(begin(), end(), ROMname, [](const Entry& lhs, std::string_view rhs) { return name(lhs) < rhs; }) };
+	return entry != end() && name(*entry) == ROMname ? entry : nullptr;
+}
+
+const RomPack::Entry* RomPack::findByHash(std::uint64_t hash) const noexcept {
+	const auto entry{ std::find_if(begin(), end(), [hash](const Entry& entry) { return entry.hash == hash; }) };
+	return entry != end() ? entry : nullptr;
+}
+
+void RomPack::list(std::ostream& ostream) const {
+	const auto flags{ ostream.flags() };
+	for (const auto& entry : *this) {
+		ostream << std::setw(5) << std::setfill(' ') << std::dec << &entry - begin() << "  "
+			<< std::hex << std::uppercase << std::setfill('0') << std::setw(16) << entry.hash << "  "
+			<< std::dec << std::setfill(' ') << std::setw(4) << entry.size << " bytes at " << std::setw(8) << entry.offset << "  "
+			<< "quirks " << std::hex << std::setfill('0') << std::setw(4) << entry.quirks << "  "
+			<< name(entry) << std::endl;
+	}
+	ostream.flags(flags);
+}
+
+bool RomPack::build(const std::string& packPath, const std::vector<std::string>& ROMs, std::uint16_t quirks) {
+	struct Pending {
+		Entry				entry;
+		std::vector<byte_t>	image;
+	};
+	std::vector<Pending> pending{};
+	pending.reserve(ROMs.size());
+	for (const auto& ROM : ROMs) {
+		const std::string ROMname{ std::filesystem::path(ROM).filename().string() };
+		if (ROMname.size() >= nameSize) {
+			PACK_ERROR("Name of " + ROM + " is longer than " + std::to_string(nameSize - 1u) + " characters", packPath);
+			return false;
+		}
+		std::ifstream ROMfile{ ROM, std::ios_base::binary };
+		if (!ROMfile) {
+			PACK_ERROR("Cannot open ROM " + ROM, packPath);
+			return false;
+		}
+		Pending rom{};
+		rom.image.assign(std::istreambuf_iterator<char>{ ROMfile }, std::istreambuf_iterator<char>{});
+		if (rom.image.size() > maxImageSize) {
+			PACK_ERROR("ROM " + ROM + " is too big (" + std::to_string(rom.image.size()) + " bytes)", packPath);
+			return false;
+		}
+		std::copy(ROMname.cbegin(), ROMname.cend(), rom.entry.name.begin());
+		rom.entry.hash = hash(rom.image.data(), rom.image.size());
+		rom.entry.size = static_cast<std::uint16_t>(rom.image.size());
+		rom.entry.quirks = quirks;
+		pending.push_back(std::move(rom));
+	}
+
+	std::sort(pending.begin(), pending.end(), [](const Pending& lhs, const Pending& rhs) { return name(lhs.entry) < name(rhs.entry); });
+	const auto duplicate{ std::adjacent_find(pending.cbegin(), pending.cend(), [](const Pending& lhs, const Pending& rhs) { return name(lhs.entry) == name(rhs.entry); }) };
+	if (duplicate != pending.cend()) {
+		PACK_ERROR("ROM name " + std::string(name(duplicate->entry)) + " appears twice", packPath);
+		return false;
+	}
+
+	std::size_t offset{ sizeof(Header) + pending.size() * sizeof(Entry) };
+	for (auto& rom : pending) {
+		rom.entry.offset = static_cast<std::uint32_t>(offset);
+		offset += rom.image.size();
+	}
+	if (offset > UINT32_MAX) {
+		PACK_ERROR("Pack would exceed 4 GiB", packPath);
+		return false;
+	}
+
+	std::ofstream pack{ packPath, std::ios_base::binary | std::ios_base::trunc };
+	const Header header{ magic, version, 0u, static_cast<std::uint32_t>(pending.size()), 0u };
+	pack.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	for (const auto& rom : pending) {
+		pack.write(reinterpret_cast<const char*>(&rom.entry), sizeof(rom.entry));
+	}
+	for (const auto& rom : pending) {
+		pack.write(reinterpret_cast<const char*>(rom.image.data()), static_cast<std::streamsize>(rom.image.size()));
+	}
+	if (!pack) {
+		PACK_ERROR("Cannot write file", packPath);
+		return false;
+	}
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "hash.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// Archive of many ROM images, memory-mapped once and shared by every emulator loading from it.
+// No syscall is made per ROM : images are copied straight from the mapping into the emulator memory.
+//
+// Layout (native little-endian, every offset is from the beginning of the file) :
+//	Header					magic, version and number of entries
+//	Entry[count]			index, sorted by name to allow binary search
+//	images					raw ROM bytes, one after another
+class RomPack {
+public:
+	using byte_t = unsigned char;
+
+	// compatibility behaviours a ROM expects, stored as a bitmask in its entry
+	// CPU::emulate() runs an entry with them (CPU::setQuirks(), Core::execute()), vipTiming through CPU::setTiming()
+	enum Quirk : std::uint16_t {
+		none					= 0,
+		shiftUsesVY				= 1 << 0,	// 8XY6 and 8XYE shift VY (instead of VX) into VX
+		loadStoreIncrementsI	= 1 << 1,	// FX55 and FX65 leave I = I + X + 1
+		jumpUsesVX				= 1 << 2,	// BNNN jumps to VX + NNN (instead of V0 + NNN)
+		clipSprites				= 1 << 3,	// DXYN clips sprites at the screen borders instead of wrapping
+		resetVF					= 1 << 4,	// 8XY1, 8XY2 and 8XY3 reset VF
+		vipTiming				= 1 << 5	// opcodes are timed like on the COSMAC VIP (CPU::Timing::cosmacVip)
+	};
+
+	static constexpr std::array<char, 4> magic{ 'C', '8', 'P', 'K' };
+	static constexpr std::uint16_t version{ 2 }; // 2 : Header padded so that the index is aligned for Entry::hash
+	static constexpr std::size_t nameSize{ 48 }; // including the terminating '\0'
+	static constexpr std::size_t maxImageSize{ 0x1000 - 0x200 }; // same as CPU::memoryUsableSize
+
+	struct Header {
+		std::array<char, 4>	magic;
+		std::uint16_t		version;
+		std::uint16_t		reserved;
+		std::uint32_t		count;
+		std::uint32_t		padding;	// 0, the index right after the header must be aligned for Entry
+	};
+
+	struct Entry {
+		std::array<char, nameSize>	name;	// file name of the ROM, '\0'-terminated
+		std::uint64_t				hash;	// FNV-1a of the image
+		std::uint32_t				offset;
+		std::uint16_t				size;
+		std::uint16_t				quirks;	// combination of Quirk
+	};
+
+	static_assert(sizeof(Header) == 16, "Header must be packed, it is written as is");
+	static_assert(sizeof(Entry) == 64, "Entry must be packed, it is written as is");
+	static_assert(sizeof(Header) % alignof(Entry) == 0, "the index is read in place from the mapping");
+
+private:
+	const byte_t*	base_{};
+	std::size_t		size_{};
+
+#ifdef _WIN32
+	void*			file_{};
+	void*			mapping_{};
+#endif
+
+	const Header& header() const noexcept {
+		return *reinterpret_cast<const Header*>(base_);
+	}
+
+	// checks the whole file once, so that loading an entry never has to
+	bool validate(const std::string& path) const;
+
+public:
+	RomPack() = default;
+
+	RomPack(const RomPack&)				= delete;
+	RomPack(RomPack&&)					= delete;
+
+	RomPack& operator=(const RomPack&)	= delete;
+	RomPack& operator=(RomPack&&)		= delete;
+
+	~RomPack();
+
+	bool open(const std::string& path);
+
+	void close() noexcept;
+
+	inline bool isOpen() const noexcept {
+		return base_ != nullptr;
+	}
+
+	inline std::size_t size() const noexcept {
+		return isOpen() ? header().count : 0u;
+	}
+
+	inline const Entry* begin() const noexcept {
+		return isOpen() ? reinterpret_cast<const Entry*>(base_ + sizeof(Header)) : nullptr;
+	}
+
+	inline const Entry* end() const noexcept {
+		return begin() + size();
+	}
+
+	inline const Entry& operator[](std::size_t index) const noexcept {
+		return begin()[index];
+	}
+
+	inline const byte_t* image(const Entry& entry) const noexcept {
+		return base_ + entry.offset;
+	}
+
+	static inline std::string_view name(const Entry& entry) noexcept {
+		return { entry.name.data() };
+	}
+
+	// returns nullptr if not found
+	const Entry* find(std::string_view ROMname) const noexcept;
+
+	// returns nullptr if not found; linear, prefer find() or indices for hot paths
+	const Entry* findByHash(std::uint64_t hash) const noexcept;
+
+	void list(std::ostream& ostream) const;
+
+	static constexpr std::uint64_t hash(const byte_t* data, std::size_t size) noexcept {
+		return fnv1a(data, size);
+	}
+
+	// writes a new pack from ROM files, every ROM gets the same quirks
+	static bool build(const std::string& packPath, const std::vector<std::string>& ROMs, std::uint16_t quirks = none);
+};
\ No newline at end of file
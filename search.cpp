@@ -0,0 +1,235 @@
+#include "search.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace {
+	using input_t = StateSearch::input_t;
+
+	// the search tree only keeps how each state was reached, states themselves only live while they wait for expansion
+	struct Node {
+		std::uint32_t	parent;
+		input_t			input;
+	};
+
+	struct Pending {
+		CPU::State		state;
+		std::uint32_t	node;
+		std::size_t		depth;
+		double			score;
+	};
+
+	// hashes of every state seen, split in shards so that threads rarely wait for each other
+	class Seen {
+		static constexpr std::size_t nShards{ 64u };
+
+		struct Shard {
+			std::mutex						mutex{};
+			std::unordered_set<std::uint64_t>	hashes{};
+		};
+
+		std::array<Shard, nShards> shards_{};
+
+	public:
+		// returns false if <hash> was already seen
+		bool insert(std::uint64_t hash) {
+			auto& shard{ shards_[hash >> 58] };
+			std::lock_guard lock{ shard.mutex };
+			return shard.hashes.insert(hash).second;
+		}
+	};
+
+	static_assert(std::uint64_t{ 1 } << (64 - 58) == 64u, "Seen::insert() picks a shard with the 6 highest bits");
+
+	struct Shared {
+		const StateSearch::Options&				options;
+		Seen									seen{};
+
+		std::mutex								mutex{};
+		std::condition_variable					wakeUp{};
+		std::deque<std::unique_ptr<Pending>>	fifo{};		// breadth-first
+		std::vector<std::unique_ptr<Pending>>	heap{};		// best-first
+		std::vector<Node>						nodes{};
+		std::size_t								active{};	// threads expanding a state
+		bool									stop{ false };
+		StateSearch::Result						result{};
+
+		bool empty() const noexcept {
+			return fifo.empty() && heap.empty();
+		}
+
+		void push(std::unique_ptr<Pending> pending) {
+			if (options.order == StateSearch::Order::breadthFirst) {
+				fifo.push_back(std::move(pending));
+				return;
+			}
+			heap.push_back(std::move(pending));
+			std::push_heap(heap.begin(), heap.end(), [](const auto& lhs, const auto& rhs) { return lhs->score < rhs->score; });
+		}
+
+		std::unique_ptr<Pending> pop() {
+			std::unique_ptr<Pending> pending{};
+			if (options.order == StateSearch::Order::breadthFirst) {
+				pending = std::move(fifo.front());
+				fifo.pop_front();
+				return pending;
+			}
+			std::pop_heap(heap.begin(), heap.end(), [](const auto& lhs, const auto& rhs) { return lhs->score < rhs->score; });
+			pending = std::move(heap.back());
+			heap.pop_back();
+			return pending;
+		}
+
+		std::vector<input_t> path(std::uint32_t node) const {
+			std::vector<input_t> inputs{};
+			for (; node != 0u; node = nodes[node].parent) {
+				inputs.push_back(nodes[node].input);
+			}
+			std::reverse(inputs.begin(), inputs.end());
+			return inputs;
+		}
+	};
+
+	void expandLoop(Shared& shared) {
+		const auto& options{ shared.options };
+		CPU cpu{};
+		cpu.setQuirks(options.quirks);
+		cpu.setTiming(options.timing);
+		struct Child {
+			std::unique_ptr<Pending>	pending;
+			input_t						input;
+			bool						alive;
+			bool						goal;
+		};
+		std::vector<Child> children{};
+		children.reserve(options.inputs.size());
+
+		while (true) {
+			std::unique_ptr<Pending> parent{};
+			{
+				std::unique_lock lock{ shared.mutex };
+				shared.wakeUp.wait(lock, [&shared] { return shared.stop || !shared.empty() || shared.active == 0u; });
+				if (shared.stop || shared.empty()) {
+					shared.stop = true; // nothing left and nobody expanding, so nothing will come
+					shared.wakeUp.notify_all();
+					return;
+				}
+				parent = shared.pop();
+				shared.active++;
+			}
+
+			children.clear();
+			std::size_t duplicates{ 0u };
+			for (const auto input : options.inputs) {
+				cpu.restore(parent->state);
+				cpu.setKeys(input);
+				bool alive{ true };
+				for (std::size_t frame{ 0u }; frame < options.framesPerInput && alive; frame++) {
+					alive = cpu.stepFrame();
+				}
+				auto child{ std::make_unique<Pending>() };
+				child->state = cpu.snapshot();
+				if (!shared.seen.insert(child->state.hash())) {
+					duplicates++;
+					continue;
+				}
+				child->depth = parent->depth + 1u;
+				child->score = options.score ? options.score(child->state) : 0.;
+				const bool goal{ options.goal && options.goal(child->state) };
+				children.push_back({ std::move(child), input, alive, goal });
+			}
+
+			std::lock_guard lock{ shared.mutex };
+			auto& result{ shared.result };
+			result.expanded++;
+			result.duplicates += duplicates;
+			for (auto& child : children) {
+				if (shared.stop) {
+					break;
+				}
+				const auto node{ static_cast<std::uint32_t>(shared.nodes.size()) };
+				shared.nodes.push_back({ parent->node, child.input });
+				child.pending->node = node;
+				result.unique++;
+				result.depth = std::max(result.depth, child.pending->depth);
+				if (child.goal) {
+					result.goal = shared.path(node);
+					shared.stop = true;
+				}
+				else if (!child.alive) {
+					const auto fault{ child.pending->state.fault };
+					if (fault == CPU::Fault::none) {
+						result.ended++;
+					}
+					else if (result.faulted++ == 0u) {
+						result.fault = shared.path(node);
+						result.faultType = fault;
+					}
+				}
+				else if (child.pending->depth < options.maxDepth) {
+					shared.push(std::move(child.pending));
+				}
+				if (result.unique >= options.maxStates) {
+					shared.stop = true;
+				}
+			}
+			shared.active--;
+			shared.wakeUp.notify_all();
+		}
+	}
+}
+
+std::vector<StateSearch::input_t> StateSearch::singleKeys(input_t keys) {
+	std::vector<input_t> inputs{ 0u };
+	for (unsigned key{ 0u }; key < 0x10; key++) {
+		if ((keys >> key) & 1u) {
+			inputs.push_back(static_cast<input_t>(1u << key));
+		}
+	}
+	return inputs;
+}
+
+StateSearch::Result StateSearch::run(const CPU::State& root, const Options& options) {
+	const auto start{ std::chrono::steady_clock::now() };
+	Shared shared{ options };
+	shared.seen.insert(root.hash());
+	shared.nodes.push_back({ 0u, 0u });
+	shared.result.unique = 1u;
+	auto first{ std::make_unique<Pending>() };
+	first->state = root;
+	first->node = 0u;
+	first->depth = 0u;
+	first->score = options.score ? options.score(root) : 0.;
+	if (options.goal && options.goal(root)) {
+		shared.result.goal = std::vector<input_t>{};
+	}
+	else if (options.maxDepth > 0u) {
+		shared.push(std::move(first));
+	}
+
+	const std::size_t nThreads{ options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency()) };
+	std::vector<std::thread> threads{};
+	threads.reserve(nThreads);
+	for (std::size_t i{ 0u }; i < nThreads; i++) {
+		threads.emplace_back(expandLoop, std::ref(shared));
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	shared.result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return shared.result;
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "cpu.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// Explores the states reachable from a snapshot by holding keypad inputs.
+// Every expanded state is forked once per input, each fork emulates framesPerInput frames headless on a pool of CPUs.
+// States are deduplicated with CPU::State::hash(), a collision (about 2^-64 per pair) merges two different states.
+class StateSearch {
+public:
+	using input_t = std::uint16_t; // keys held, bit N = key N
+
+	enum class Order {
+		breadthFirst,
+		bestFirst	// highest Options::score first
+	};
+
+	struct Options {
+		std::vector<input_t>					inputs{ singleKeys() };
+		std::size_t								framesPerInput{ 10u };
+		std::size_t								maxDepth{ std::numeric_limits<std::size_t>::max() };
+		std::size_t								maxStates{ 1'000'000u };	// stops after that many unique states
+		std::size_t								threads{ 0u };				// 0 for one per hardware thread
+		Order									order{ Order::breadthFirst };
+		std::uint16_t							quirks{ RomPack::none };	// RomPack::Quirk every CPU runs with, e.g. a pack entry's
+		CPU::Timing								timing{ CPU::Timing::flat };
+		std::function<double(const CPU::State&)>	score{};
+		std::function<bool(const CPU::State&)>		goal{};						// stops at the first state for which it's true
+	};
+
+	struct Result {
+		std::size_t							expanded{};
+		std::size_t							unique{};
+		std::size_t							duplicates{};
+		std::size_t							ended{};	// states where the program ended normally
+		std::size_t							faulted{};
+		std::size_t							depth{};	// deepest unique state
+		double								seconds{};
+		std::optional<std::vector<input_t>>	goal{};		// inputs from the root to the first state meeting Options::goal
+		std::optional<std::vector<input_t>>	fault{};	// inputs from the root to the first faulting state
+		CPU::Fault							faultType{ CPU::Fault::none };
+	};
+
+	// no key, then every key alone; <keys> restricts them (bit N = key N)
+	static std::vector<input_t> singleKeys(input_t keys = 0xFFFF);
+
+	static Result run(const CPU::State& root, const Options& options);
+};
\ No newline at end of file
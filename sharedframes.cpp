@@ -0,0 +1,155 @@
+#include "sharedframes.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <thread>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#define SHARED_ERROR(msg, name) std::cerr << "Error " << (msg) << " (shared memory " << std::quoted(name) << ") !" << std::endl
+
+SharedFrames::~SharedFrames() {
+	close();
+}
+
+bool SharedFrames::open(const std::string& name, std::size_t slots) {
+	close();
+	if (name.empty() || name.find('/') != std::string::npos || slots == 0u || slots > UINT16_MAX) {
+		SHARED_ERROR("Invalid name or slot count", name);
+		return false;
+	}
+	const std::size_t size{ sizeof(Header) + slots * sizeof(Slot) };
+	void* base{};
+#ifdef _WIN32
+	const std::string path{ "Local\\" + name };
+	mapping_ = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, static_cast<DWORD>(size), path.c_str());
+	base = mapping_ ? MapViewOfFile(mapping_, FILE_MAP_ALL_ACCESS, 0, 0, size) : nullptr;
+#else
+	const std::string path{ '/' + name };
+	shm_unlink(path.c_str()); // a previous run may have crashed without removing it
+	const int fd{ shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600) };
+	if (fd < 0) {
+		SHARED_ERROR("Cannot create segment", name);
+		return false;
+	}
+	if (ftruncate(fd, static_cast<off_t>(size)) == 0) {
+		void* const address{ mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) };
+		base = address == MAP_FAILED ? nullptr : address;
+	}
+	::close(fd); // the mapping keeps its own reference to the segment
+#endif
+	name_ = name;
+	size_ = size;
+	if (!base) {
+		SHARED_ERROR("Cannot map segment", name);
+		close();
+		return false;
+	}
+
+	// readers check the magic last, once everything else is there
+	header_ = new (base) Header{};
+	slots_ = static_cast<Slot*>(static_cast<void*>(static_cast<byte_t*>(base) + sizeof(Header)));
+	for (std::size_t slot{ 0u }; slot < slots; slot++) {
+		new (slots_ + slot) Slot{};
+	}
+	slotCount_ = slots;
+	inputSequence_ = 0u;
+	header_->version = version;
+	header_->slotCount = static_cast<std::uint16_t>(slots);
+	header_->slotSize = sizeof(Slot);
+	std::atomic_thread_fence(std::memory_order_release);
+	header_->magic = magic;
+	return true;
+}
+
+void SharedFrames::close() noexcept {
+#ifdef _WIN32
+	if (header_) {
+		UnmapViewOfFile(header_);
+	}
+	if (mapping_) {
+		CloseHandle(mapping_);
+	}
+	mapping_ = nullptr;
+#else
+	if (header_) {
+		munmap(header_, size_);
+	}
+	if (!name_.empty()) {
+		shm_unlink(('/' + name_).c_str());
+	}
+#endif
+	header_ = nullptr;
+	slots_ = nullptr;
+	slotCount_ = 0u;
+	size_ = 0u;
+	name_.clear();
+}
+
+void SharedFrames::publish(const Screen::Frame& screen, const CPU::Registers& registers) noexcept {
+	if (!isOpen()) {
+		return;
+	}
+	const auto frame{ header_->published.load(std::memory_order_relaxed) };
+	Slot& slot{ slots_[frame % slotCount_] };
+	slot.sequence.store(2u * frame + 1u, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	slot.frame = frame;
+	slot.screen = screen;
+	slot.V = registers.V;
+	slot.I = registers.I;
+	slot.pc = registers.pc;
+	slot.gameTimer = registers.gameTimer;
+	slot.soundTimer = registers.soundTimer;
+	slot.stackSize = registers.stackSize;
+	slot.sequence.store(2u * frame + 2u, std::memory_order_release);
+	header_->published.store(frame + 1u, std::memory_order_release);
+}
+
+std::optional<std::uint16_t> SharedFrames::input() noexcept {
+	if (!isOpen()) {
+		return std::nullopt;
+	}
+	const auto sequence{ header_->inputSequence.load(std::memory_order_acquire) };
+	if (sequence == inputSequence_) {
+		return std::nullopt;
+	}
+	inputSequence_ = sequence;
+	return static_cast<std::uint16_t>(header_->keys.load(std::memory_order_relaxed));
+}
+
+bool SharedFrames::waitInput(std::chrono::milliseconds timeout) const noexcept {
+	if (!isOpen()) {
+		return false;
+	}
+	const auto deadline{ std::chrono::steady_clock::now() + timeout };
+	// a reader driving frames as fast as it can answers within microseconds, don't give the core away before
+	for (std::size_t spin{ 1u }; header_->inputSequence.load(std::memory_order_acquire) == inputSequence_; spin++) {
+		if (spin % 1024u == 0u) {
+			if (std::chrono::steady_clock::now() > deadline) {
+				return false;
+			}
+			std::this_thread::yield();
+		}
+	}
+	return true;
+}
\ No newline at end of file
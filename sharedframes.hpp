@@ -0,0 +1,108 @@
+#pragma once
+
+#include "cpu.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// Exports every frame stepped by a CPU (through CPU::share()) to other processes, in a named shared memory segment :
+// a Header followed by slotCount Slots, frame N being written to slot N % slotCount.
+// Slots are seqlocks : sequence is odd while the slot is written, then 2 * (frame + 1). A reader loads published,
+// reads the latest slot in place and checks its sequence didn't change meanwhile, so that it needs neither copies nor syscalls.
+// The reader drives the keypad back through the same segment : it writes keys, then increments inputSequence;
+// the CPU applies them at the start of its next frame. The segment is /dev/shm/<name> on POSIX systems, Local\<name> on Windows.
+class SharedFrames {
+public:
+	using byte_t = CPU::byte_t;
+
+	static constexpr std::array<char, 4> magic{ 'C', '8', 'S', 'F' };
+	static constexpr std::uint16_t version{ 1u };
+	static constexpr std::size_t defaultSlots{ 64u };
+
+	struct alignas(64) Header {
+		std::array<char, 4>				magic;
+		std::uint16_t					version;
+		std::uint16_t					slotCount;
+		std::uint32_t					slotSize;		// sizeof(Slot)
+		std::uint32_t					reserved;
+		std::atomic<std::uint64_t>		published;		// frames published so far, the latest is in slot (published - 1) % slotCount
+		std::atomic<std::uint32_t>		keys;			// written by the reader, bit N = key N held
+		std::atomic<std::uint32_t>		inputSequence;	// incremented by the reader once keys are written
+	};
+
+	struct alignas(64) Slot {
+		std::atomic<std::uint64_t>		sequence;
+		std::uint64_t					frame;
+		Screen::Frame					screen;			// row by row, most significant bit = leftmost pixel
+		std::array<byte_t, 0x10>		V;
+		std::uint16_t					I;
+		std::uint16_t					pc;
+		std::uint8_t					gameTimer;
+		std::uint8_t					soundTimer;
+		std::uint8_t					stackSize;
+		std::uint8_t					reserved;
+	};
+
+	// the layout is read by other processes, possibly in other languages
+	static_assert(std::atomic<std::uint64_t>::is_always_lock_free && std::atomic<std::uint32_t>::is_always_lock_free,
+		"atomics must be lock free to be shared between processes");
+	static_assert(sizeof(Header) == 64, "Header must be packed, it is read by other processes");
+	static_assert(sizeof(Slot) == 320, "Slot must be packed, it is read by other processes");
+
+private:
+	Header*			header_{};
+	Slot*			slots_{};
+	std::size_t		slotCount_{};
+	std::size_t		size_{};
+	std::string		name_{};
+	std::uint32_t	inputSequence_{};	// the last one applied
+
+#ifdef _WIN32
+	void*			mapping_{};
+#endif
+
+public:
+	SharedFrames() = default;
+
+	SharedFrames(const SharedFrames&)				= delete;
+	SharedFrames(SharedFrames&&)					= delete;
+
+	SharedFrames& operator=(const SharedFrames&)	= delete;
+	SharedFrames& operator=(SharedFrames&&)			= delete;
+
+	~SharedFrames();
+
+	// creates the segment <name>, replacing any previous one
+	bool open(const std::string& name, std::size_t slots = defaultSlots);
+
+	// removes the segment, readers keep their mapping until they unmap it
+	void close() noexcept;
+
+	inline bool isOpen() const noexcept {
+		return header_ != nullptr;
+	}
+
+	inline std::uint64_t published() const noexcept {
+		return isOpen() ? header_->published.load(std::memory_order_relaxed) : 0u;
+	}
+
+	void publish(const Screen::Frame& screen, const CPU::Registers& registers) noexcept;
+
+	// keys the reader wrote since the last call, if any
+	std::optional<std::uint16_t> input() noexcept;
+
+	// lockstep : spins until the reader writes new input, returns false if it didn't within <timeout>
+	bool waitInput(std::chrono::milliseconds timeout) const noexcept;
+};
\ No newline at end of file
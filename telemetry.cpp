@@ -0,0 +1,298 @@
+#include "telemetry.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string_view>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace {
+	// snapshots waiting longer than that are dropped, so that a stalled reader cannot make the queue grow forever
+	constexpr std::size_t maxQueued{ 64u };
+
+	constexpr std::string_view unixPrefix{ "unix:" };
+
+	// 3*5 font of the overlay, one row per element, the most significant of the 3 bits is the leftmost pixel
+	constexpr std::string_view glyphs{ "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ./+-%:" };
+	constexpr std::array<std::array<std::uint8_t, 5>, glyphs.size()> font{ {
+		{ 07, 05, 05, 05, 07 }, { 02, 06, 02, 02, 07 }, { 07, 01, 07, 04, 07 }, { 07, 01, 07, 01, 07 }, { 05, 05, 07, 01, 01 },
+		{ 07, 04, 07, 01, 07 }, { 07, 04, 07, 05, 07 }, { 07, 01, 01, 01, 01 }, { 07, 05, 07, 05, 07 }, { 07, 05, 07, 01, 07 },
+		{ 02, 05, 07, 05, 05 }, { 06, 05, 06, 05, 06 }, { 03, 04, 04, 04, 03 }, { 06, 05, 05, 05, 06 }, { 07, 04, 06, 04, 07 },
+		{ 07, 04, 06, 04, 04 }, { 03, 04, 05, 05, 03 }, { 05, 05, 07, 05, 05 }, { 07, 02, 02, 02, 07 }, { 01, 01, 01, 05, 02 },
+		{ 05, 05, 06, 05, 05 }, { 04, 04, 04, 04, 07 }, { 05, 07, 07, 05, 05 }, { 06, 05, 05, 05, 05 }, { 02, 05, 05, 05, 02 },
+		{ 06, 05, 06, 04, 04 }, { 02, 05, 05, 06, 03 }, { 06, 05, 06, 05, 05 }, { 03, 04, 02, 01, 06 }, { 07, 02, 02, 02, 02 },
+		{ 05, 05, 05, 05, 07 }, { 05, 05, 05, 05, 02 }, { 05, 05, 07, 07, 05 }, { 05, 05, 02, 05, 05 }, { 05, 05, 02, 02, 02 },
+		{ 07, 01, 02, 04, 07 }, { 00, 00, 00, 00, 02 }, { 01, 01, 02, 04, 04 }, { 00, 02, 07, 02, 00 }, { 00, 00, 07, 00, 00 },
+		{ 05, 01, 02, 04, 05 }, { 00, 02, 00, 02, 00 }
+	} };
+
+	constexpr float dot{ 2.f };				// size of a font pixel
+	constexpr float margin{ 4.f };
+	constexpr float advance{ 4.f * dot };	// 3 pixels and a space
+	constexpr float lineHeight{ 7.f * dot };
+	constexpr float barWidth{ 6.f };
+	constexpr float barHeight{ 24.f };
+
+	const sf::Color background{ 0, 0, 0, 0xC0 };
+	const sf::Color foreground{ 0x40, 0xFF, 0x40 };
+
+	void addRectangle(sf::VertexArray& vertices, float x, float y, float width, float height, sf::Color color) {
+		vertices.append(sf::Vertex({ x, y }, color));
+		vertices.append(sf::Vertex({ x + width, y }, color));
+		vertices.append(sf::Vertex({ x + width, y + height }, color));
+		vertices.append(sf::Vertex({ x, y + height }, color));
+	}
+
+	void addText(sf::VertexArray& vertices, std::string_view text, float x, float y) {
+		for (const char character : text) {
+			const auto glyph{ glyphs.find(character) };
+			if (glyph != std::string_view::npos) {
+				for (std::size_t row{ 0u }; row < 5u; row++) {
+					for (std::size_t column{ 0u }; column < 3u; column++) {
+						if ((font[glyph][row] >> (2u - column)) & 1u) {
+							addRectangle(vertices, x + column * dot, y + row * dot, dot, dot, foreground);
+						}
+					}
+				}
+			}
+			x += advance;
+		}
+	}
+
+	double micros(Telemetry::clock::duration duration) noexcept {
+		return std::chrono::duration<double, std::micro>(duration).count();
+	}
+
+	std::string fixed(double value, int precision) {
+		std::ostringstream ostream{};
+		ostream << std::fixed << std::setprecision(precision) << value;
+		return ostream.str();
+	}
+}
+
+Telemetry::~Telemetry() {
+	close();
+}
+
+bool Telemetry::exportTo(const std::string& target) {
+	close();
+	int socket{ -1 };
+	if (target.starts_with(unixPrefix)) {
+#ifdef _WIN32
+		std::cerr << "Error telemetry export to a unix socket isn't supported on Windows !" << std::endl;
+		return false;
+#else
+		const std::string path{ target.substr(unixPrefix.size()) };
+		sockaddr_un address{};
+		address.sun_family = AF_UNIX;
+		if (path.size() >= sizeof(address.sun_path)) {
+			std::cerr << "Error telemetry socket path " << std::quoted(path) << " is too long !" << std::endl;
+			return false;
+		}
+		path.copy(address.sun_path, path.size());
+		socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+		if (socket < 0 || connect(socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+			if (socket >= 0) {
+				::close(socket);
+			}
+			std::cerr << "Error cannot connect to telemetry socket " << std::quoted(path) << " !" << std::endl;
+			return false;
+		}
+#endif
+	}
+	else {
+		file_.open(target, std::ios_base::trunc);
+		if (!file_) {
+			std::cerr << "Error cannot create telemetry file " << std::quoted(target) << " !" << std::endl;
+			return false;
+		}
+	}
+	target_ = target;
+	closing_ = false;
+	exporter_ = std::thread{ &Telemetry::exportLoop, this, socket };
+	return true;
+}
+
+void Telemetry::close() {
+	if (!exporter_.joinable()) {
+		return;
+	}
+	{
+		std::lock_guard lock{ mutex_ };
+		closing_ = true;
+	}
+	wakeUp_.notify_one();
+	exporter_.join();
+	file_.close();
+}
+
+void Telemetry::exportLoop(int socket) {
+	std::unique_lock lock{ mutex_ };
+	bool failed{ false };
+	while (true) {
+		wakeUp_.wait(lock, [this] { return closing_ || !queue_.empty(); });
+		if (queue_.empty()) {
+			break; // closing and nothing left
+		}
+		const std::string line{ std::move(queue_.front()) };
+		queue_.pop_front();
+		if (failed) {
+			continue;
+		}
+		lock.unlock();
+		if (socket < 0) {
+			failed = !(file_ << line << std::flush);
+		}
+		else {
+#ifndef _WIN32
+#ifdef MSG_NOSIGNAL
+			constexpr int flags{ MSG_NOSIGNAL }; // a closed reader mustn't kill the emulator with SIGPIPE
+#else
+			constexpr int flags{ 0 };
+#endif
+			for (std::size_t sent{ 0u }; !failed && sent < line.size();) {
+				const auto written{ send(socket, line.data() + sent, line.size() - sent, flags) };
+				failed = written <= 0;
+				sent += failed ? 0u : static_cast<std::size_t>(written);
+			}
+#endif
+		}
+		if (failed) {
+			std::cerr << "Error telemetry export to " << std::quoted(target_) << " failed, it is stopped !" << std::endl;
+		}
+		lock.lock();
+	}
+#ifndef _WIN32
+	if (socket >= 0) {
+		::close(socket);
+	}
+#endif
+}
+
+void Telemetry::start(double targetHz, double targetIps) {
+	const auto now{ clock::now() };
+	start_ = periodStart_ = now;
+	instructions_ = frames_ = periodInstructions_ = periodFrames_ = rendered_ = dropped_ = skipped_ = 0u;
+	work_ = workMax_ = overshoot_ = overshootMax_ = render_ = present_ = clock::duration::zero();
+	histogram_ = {};
+	targetHz_ = targetHz;
+	targetIps_ = targetIps;
+	last_ = Snapshot{};
+	last_.targetHz = targetHz;
+	last_.targetIps = targetIps;
+	buildOverlay();
+}
+
+void Telemetry::flush(clock::time_point now) {
+	const double elapsed{ std::chrono::duration<double>(now - periodStart_).count() };
+	const double frames{ static_cast<double>(periodFrames_) };
+	const double rendered{ static_cast<double>(rendered_ ? rendered_ : 1u) };
+	last_ = Snapshot{
+		std::chrono::duration<double>(now - start_).count(),
+		instructions_,
+		frames_,
+		static_cast<double>(periodInstructions_) / elapsed,
+		targetIps_,
+		frames / elapsed,
+		targetHz_,
+		micros(work_) / frames,
+		micros(workMax_),
+		histogram_,
+		micros(overshoot_) / frames,
+		micros(overshootMax_),
+		micros(render_) / rendered,
+		micros(present_) / rendered,
+		dropped_,
+		skipped_
+	};
+
+	periodStart_ = now;
+	periodInstructions_ = periodFrames_ = rendered_ = dropped_ = skipped_ = 0u;
+	work_ = workMax_ = overshoot_ = overshootMax_ = render_ = present_ = clock::duration::zero();
+	histogram_ = {};
+
+	buildOverlay();
+	if (exporter_.joinable()) {
+		{
+			std::lock_guard lock{ mutex_ };
+			if (queue_.size() >= maxQueued) {
+				queue_.pop_front();
+			}
+			queue_.push_back(toJSON(last_));
+		}
+		wakeUp_.notify_one();
+	}
+}
+
+std::string Telemetry::toJSON(const Snapshot& snapshot) {
+	std::ostringstream json{};
+	json << std::fixed << std::setprecision(1)
+		<< "{\"t\":" << snapshot.seconds
+		<< ",\"instructions\":" << snapshot.instructions
+		<< ",\"frames\":" << snapshot.frames
+		<< ",\"ips\":" << snapshot.ips
+		<< ",\"target_ips\":" << snapshot.targetIps
+		<< ",\"hz\":" << snapshot.hz
+		<< ",\"target_hz\":" << snapshot.targetHz
+		<< ",\"work_us\":{\"mean\":" << snapshot.workMean << ",\"max\":" << snapshot.workMax << ",\"histogram\":[";
+	for (std::size_t bucket{ 0u }; bucket < nBuckets; bucket++) {
+		json << (bucket ? "," : "") << snapshot.workHistogram[bucket];
+	}
+	json << "]},\"sleep_overshoot_us\":{\"mean\":" << snapshot.overshootMean << ",\"max\":" << snapshot.overshootMax << '}'
+		<< ",\"render_us\":" << snapshot.renderMean
+		<< ",\"present_us\":" << snapshot.presentMean
+		<< ",\"dropped_frames\":" << snapshot.dropped
+		<< ",\"skipped_frames\":" << snapshot.skipped
+		<< "}\n";
+	return json.str();
+}
+
+void Telemetry::buildOverlay() {
+	const auto& s{ last_ };
+	const std::array<std::string, 6> lines{
+		"IPS " + fixed(s.ips, 0) + (s.targetIps > 0. ? '/' + fixed(s.targetIps, 0) : ""),
+		"HZ " + fixed(s.hz, 1) + '/' + fixed(s.targetHz, 0),
+		"WORK " + fixed(s.workMean, 0) + " MAX " + fixed(s.workMax, 0) + " US",
+		"SLEEP +" + fixed(s.overshootMean, 0) + " MAX " + fixed(s.overshootMax, 0) + " US",
+		"DRAW " + fixed(s.renderMean, 0) + " SHOW " + fixed(s.presentMean, 0) + " US",
+		"DROP " + std::to_string(s.dropped) + " SKIP " + std::to_string(s.skipped)
+	};
+	std::size_t longest{ 0u };
+	for (const auto& line : lines) {
+		longest = std::max(longest, line.size());
+	}
+	const float width{ std::max(longest * advance, nBuckets * barWidth) + 2.f * margin };
+	const float height{ lines.size() * lineHeight + barHeight + 3.f * margin };
+
+	text_.clear();
+	addRectangle(text_, 0.f, 0.f, width, height, background);
+	for (std::size_t i{ 0u }; i < lines.size(); i++) {
+		addText(text_, lines[i], margin, margin + i * lineHeight);
+	}
+	// work-time histogram, from 1 µs on the left to 32 ms and above on the right
+	const auto highest{ *std::max_element(s.workHistogram.cbegin(), s.workHistogram.cend()) };
+	const float bottom{ height - margin };
+	for (std::size_t bucket{ 0u }; highest && bucket < nBuckets; bucket++) {
+		const float bar{ barHeight * static_cast<float>(s.workHistogram[bucket]) / static_cast<float>(highest) };
+		addRectangle(text_, margin + bucket * barWidth, bottom - bar, barWidth - 1.f, bar, foreground);
+	}
+}
+
+void Telemetry::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+	if (overlay_) {
+		target.draw(text_, states);
+	}
+}
\ No newline at end of file
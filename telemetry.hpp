@@ -0,0 +1,171 @@
+#pragma once
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <SFML/Graphics.hpp>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// Live performance counters of the windowed emulation loop.
+// The loop only adds a few durations per frame to plain counters, nothing is measured per instruction.
+// Once per period they become a Snapshot, which the overlay shows and a background thread exports as a JSON line.
+class Telemetry : public sf::Drawable {
+public:
+	using clock = std::chrono::steady_clock;
+
+	// bucket N counts the frames whose work took [2^N ; 2^(N+1)[ µs, the first one also counts 0 µs and the last one everything above
+	static constexpr std::size_t nBuckets{ 16u };
+
+	static constexpr clock::duration period{ std::chrono::seconds(1) };
+
+	// what the emulation loop measured for one frame
+	struct Frame {
+		std::size_t		instructions{};
+		clock::duration	work{};			// emulation of the frame
+		clock::duration	render{};		// clear and draw
+		clock::duration	present{};		// display
+		clock::duration	overshoot{};	// how late the sleep woke up
+		bool			skipped{ false };	// not rendered, to catch up
+	};
+
+	// durations are in µs, rates and means are over the last period only
+	struct Snapshot {
+		double							seconds{};		// since start()
+		std::uint64_t					instructions{};	// since start()
+		std::uint64_t					frames{};		// since start()
+		double							ips{};
+		double							targetIps{};
+		double							hz{};
+		double							targetHz{};
+		double							workMean{};
+		double							workMax{};
+		std::array<std::uint32_t, nBuckets>	workHistogram{};
+		double							overshootMean{};
+		double							overshootMax{};
+		double							renderMean{};
+		double							presentMean{};
+		std::uint64_t					dropped{};		// emulated frames given up because the loop fell too far behind
+		std::uint64_t					skipped{};		// emulated frames which weren't rendered
+	};
+
+private:
+	// current period
+	clock::time_point					start_{};
+	clock::time_point					periodStart_{};
+	std::uint64_t						instructions_{};
+	std::uint64_t						frames_{};
+	std::uint64_t						periodInstructions_{};
+	std::uint64_t						periodFrames_{};
+	std::uint64_t						rendered_{};
+	clock::duration						work_{};
+	clock::duration						workMax_{};
+	clock::duration						overshoot_{};
+	clock::duration						overshootMax_{};
+	clock::duration						render_{};
+	clock::duration						present_{};
+	std::array<std::uint32_t, nBuckets>	histogram_{};
+	std::uint64_t						dropped_{};
+	std::uint64_t						skipped_{};
+	double								targetHz_{};
+	double								targetIps_{};
+
+	Snapshot							last_{};
+
+	bool								overlay_{ false };
+	sf::VertexArray						text_{ sf::Quads };	// overlay of last_, rebuilt once per period
+
+	// export
+	std::mutex							mutex_{};
+	std::condition_variable				wakeUp_{};
+	std::deque<std::string>				queue_{};
+	bool								closing_{ false };
+	std::thread							exporter_{};
+	std::string							target_{};
+	std::ofstream						file_{};	// unused when exporting to a socket
+
+	void flush(clock::time_point now);
+
+	void exportLoop(int socket);
+
+	void buildOverlay();
+
+	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const;
+
+public:
+	Telemetry() = default;
+
+	Telemetry(const Telemetry&)				= delete;
+	Telemetry(Telemetry&&)					= delete;
+
+	Telemetry& operator=(const Telemetry&)	= delete;
+	Telemetry& operator=(Telemetry&&)		= delete;
+
+	~Telemetry();
+
+	// every snapshot is written as a JSON line to <target>, a file path or unix:<socket path>
+	bool exportTo(const std::string& target);
+
+	// stops exporting once every queued snapshot is written
+	void close();
+
+	// resets every counter, the rates will be compared to the given targets; a target of 0 means there's none
+	void start(double targetHz, double targetIps);
+
+	// called once per emulated frame
+	inline void record(const Frame& frame, clock::time_point now) {
+		instructions_ += frame.instructions;
+		periodInstructions_ += frame.instructions;
+		frames_++;
+		periodFrames_++;
+		work_ += frame.work;
+		workMax_ = std::max(workMax_, frame.work);
+		overshoot_ += frame.overshoot;
+		overshootMax_ = std::max(overshootMax_, frame.overshoot);
+		const auto micros{ static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(frame.work).count()) };
+		histogram_[std::min<std::size_t>(std::bit_width(micros | 1u) - 1u, nBuckets - 1u)]++;
+		if (frame.skipped) {
+			skipped_++;
+		}
+		else {
+			rendered_++;
+			render_ += frame.render;
+			present_ += frame.present;
+		}
+		if (now - periodStart_ >= period) {
+			flush(now);
+		}
+	}
+
+	inline void drop(std::uint64_t frames) noexcept {
+		dropped_ += frames;
+	}
+
+	inline const Snapshot& last() const noexcept {
+		return last_;
+	}
+
+	inline bool overlay() const noexcept {
+		return overlay_;
+	}
+
+	inline void showOverlay(bool show) noexcept {
+		overlay_ = show;
+	}
+
+	static std::string toJSON(const Snapshot& snapshot);
+};
\ No newline at end of file
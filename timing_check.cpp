@@ -0,0 +1,117 @@
+// Timing check : what Timing::cosmacVip costs against flat timing, headless on a ROM executing every opcode.
+// Each round runs the ROM for the same number of opcodes with flat timing, then with cosmacVip : the overhead is the median
+// over the rounds of the timed run's cost per opcode over the flat run's. Alternating makes a change of load or clock hit both,
+// the median ignores the spikes. Per opcode, so that running more opcodes per frame doesn't hide it.
+// Flat frames are shorter, so the end of the frame weighs more on each of their opcodes : the overhead is rather underestimated.
+// Exits with 1 above 10 % overhead, or above --max-overhead <percent>.
+//
+// Not part of Chip8.vcxproj's build, as it has its own main :
+//	g++ -std=c++20 -O2 -DNDEBUG timing_check.cpp capture.cpp cpu.cpp debugger.cpp rompack.cpp sharedframes.cpp telemetry.cpp upscale.cpp
+//		-lsfml-audio -lsfml-graphics -lsfml-window -lsfml-system -pthread -o chip8-timing-check
+//	./chip8-timing-check [--max-overhead <percent>]
+// NDEBUG is required : debug builds log every opcode, which would be measured instead.
+
+#include "cpu.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace {
+	constexpr std::size_t opcodes{ 1'000'000u };
+	constexpr std::size_t rounds{ 41u };
+	constexpr double defaultMaxOverhead{ 10. }; // percent
+
+	// every opcode but 0NNN, then BNNN back to the start; key 5 is held so that FX0A never waits (same ROM as alloc_check.cpp)
+	constexpr CPU::byte_t everyOpcode[]{
+		0x00, 0xE0, 0x60, 0x05, 0x61, 0x03, 0xA2, 0x50, 0xD0, 0x15, 0x22, 0x4E, 0x70, 0x01, 0x80, 0x14, // 00E0 6XNN ANNN DXYN 2NNN 7XNN 8XY4
+		0x80, 0x15, 0x80, 0x16, 0x80, 0x17, 0x80, 0x1E, 0x80, 0x11, 0x80, 0x12, 0x80, 0x13, 0x80, 0x10, // 8XY5 8XY6 8XY7 8XYE 8XY1 8XY2 8XY3 8XY0
+		0x30, 0x00, 0x40, 0x00, 0x50, 0x10, 0x90, 0x10, 0xC0, 0xFF, 0x62, 0x05, 0xE2, 0x9E, 0x73, 0x00, // 3XNN 4XNN 5XY0 9XY0 CXNN EX9E
+		0xE2, 0xA1, 0x73, 0x00, 0xF4, 0x0A, 0x63, 0x10, 0xF3, 0x15, 0xF3, 0x18, 0xF3, 0x07, 0xF3, 0x1E, // EXA1 FX0A FX15 FX18 FX07 FX1E
+		0xF0, 0x29, 0xA2, 0x55, 0xF3, 0x33, 0xF3, 0x55, 0xF3, 0x65, 0x60, 0x00, 0xB2, 0x00, 0x00, 0xEE, // FX29 FX33 FX55 FX65 BNNN 00EE
+		0xF0, 0x90, 0xF0, 0x90, 0xF0, 0x00, 0x00, 0x00, 0x00											 // sprite, FX33 buffer
+	};
+
+	struct Run {
+		double		nanoseconds;	// per opcode
+		std::size_t	opcodesPerFrame;
+	};
+
+	// one run of at least <opcodes> opcodes
+	Run measure(CPU::Timing timing) {
+		CPU cpu{};
+		cpu.seed(1u);
+		cpu.setTiming(timing);
+		cpu.loadImage(everyOpcode, sizeof(everyOpcode));
+		cpu.setKey(0x5, true);
+		std::size_t executed{ 0u };
+		std::size_t frames{ 0u };
+		const auto start{ std::chrono::steady_clock::now() };
+		for (; executed < opcodes && cpu.stepFrame(); frames++) {
+			executed += cpu.lastFrameOpcodes();
+		}
+		const std::chrono::duration<double, std::nano> elapsed{ std::chrono::steady_clock::now() - start };
+		return { elapsed.count() / static_cast<double>(std::max<std::size_t>(executed, 1u)), executed / std::max<std::size_t>(frames, 1u) };
+	}
+
+	double median(std::vector<double> values) {
+		std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2u), values.end());
+		return values[values.size() / 2u];
+	}
+}
+
+int main(int argc, char* argv[]) {
+	double maxOverhead{ defaultMaxOverhead };
+	bool usage{ argc != 1 };
+	if (argc == 3 && std::string{ argv[1] } == "--max-overhead") {
+		try {
+			maxOverhead = std::stod(argv[2]);
+			usage = maxOverhead < 0.;
+		}
+		catch (const std::logic_error&) {} // std::stod
+	}
+	if (usage) {
+		std::cerr << "Usage : " << argv[0] << " [--max-overhead <percent>]" << std::endl;
+		return 1;
+	}
+
+	// flat and timed runs alternate, so that a change of load or clock hits both; medians ignore the spikes
+	std::vector<double> flatRuns{};
+	std::vector<double> vipRuns{};
+	std::vector<double> overheads{};
+	std::size_t flatOpcodes{ 0u };
+	std::size_t vipOpcodes{ 0u };
+	for (std::size_t round{ 0u }; round < rounds; round++) {
+		const auto flatRun{ measure(CPU::Timing::flat) };
+		const auto vipRun{ measure(CPU::Timing::cosmacVip) };
+		flatRuns.push_back(flatRun.nanoseconds);
+		vipRuns.push_back(vipRun.nanoseconds);
+		overheads.push_back((vipRun.nanoseconds / flatRun.nanoseconds - 1.) * 100.);
+		flatOpcodes = flatRun.opcodesPerFrame;
+		vipOpcodes = vipRun.opcodesPerFrame;
+	}
+	const double flat{ median(flatRuns) };
+	const double vip{ median(vipRuns) };
+	const double overhead{ median(overheads) };
+	std::cout << std::fixed << std::setprecision(2)
+		<< "flat       " << std::setw(8) << flat << " ns per opcode, " << flatOpcodes << " opcodes per frame" << std::endl
+		<< "cosmacVip  " << std::setw(8) << vip << " ns per opcode, " << vipOpcodes << " opcodes per frame" << std::endl
+		<< "overhead   " << std::setw(8) << overhead << " %" << std::endl;
+	if (overhead > maxOverhead) {
+		std::cerr << "FAILED overhead above " << maxOverhead << " %" << std::endl;
+		return 1;
+	}
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,323 @@
+#include "upscale.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define UPSCALE_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// GCC and Clang only emit SIMD instructions in functions targeting them, MSVC always does
+#if defined(__GNUC__) || defined(__clang__)
+#define TARGET(isa) __attribute__((target(isa)))
+#else
+#define TARGET(isa)
+#endif
+
+namespace {
+	// bytes of a row byte's 8 pixels, leftmost first once stored in memory (little endian)
+	constexpr std::array<std::uint64_t, 0x100> pixelBytes{ [] {
+		std::array<std::uint64_t, 0x100> bytes{};
+		for (std::size_t bits{ 0u }; bits < bytes.size(); bits++) {
+			for (std::size_t pixel{ 0u }; pixel < 8u; pixel++) {
+				if ((bits >> (7u - pixel)) & 1u) {
+					bytes[bits] |= std::uint64_t{ 0xFF } << (8u * pixel);
+				}
+			}
+		}
+		return bytes;
+	}() };
+
+	// bit N of <half> to bit 2N
+	constexpr std::uint64_t spread(std::uint64_t half) noexcept {
+		half &= 0xFFFF'FFFFu;
+		half = (half | half << 16u) & 0x0000'FFFF'0000'FFFFu;
+		half = (half | half << 8u) & 0x00FF'00FF'00FF'00FFu;
+		half = (half | half << 4u) & 0x0F0F'0F0F'0F0F'0F0Fu;
+		half = (half | half << 2u) & 0x3333'3333'3333'3333u;
+		half = (half | half << 1u) & 0x5555'5555'5555'5555u;
+		return half;
+	}
+
+	constexpr std::uint32_t alpha{ 0xFF00'0000u };
+
+	void expandScalar(const std::uint8_t* source, const std::uint16_t* bases, const std::uint8_t* shuffles, std::size_t width, std::uint8_t* out) {
+		for (std::size_t x{ 0u }; x < width; x++) {
+			out[x] = source[bases[x / 16u] + shuffles[x]];
+		}
+	}
+
+	void fadeScalar(std::uint8_t* phosphor, const std::uint8_t* line, std::size_t width, std::uint8_t decay) {
+		for (std::size_t x{ 0u }; x < width; x++) {
+			phosphor[x] = std::max(line[x], static_cast<std::uint8_t>(phosphor[x] > decay ? phosphor[x] - decay : 0u));
+		}
+	}
+
+	void toRGBAScalar(const std::uint8_t* line, std::size_t width, std::uint32_t* out) {
+		for (std::size_t x{ 0u }; x < width; x++) {
+			out[x] = line[x] * 0x01'01'01u | alpha;
+		}
+	}
+
+#ifdef UPSCALE_X86
+	// a block of output bytes is a shuffle of the 16 source bytes from its base
+	TARGET("ssse3") void expandSSE(const std::uint8_t* source, const std::uint16_t* bases, const std::uint8_t* shuffles, std::size_t width, std::uint8_t* out) {
+		for (std::size_t block{ 0u }; block < width / 16u; block++) {
+			const __m128i bytes{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + bases[block])) };
+			const __m128i shuffle{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(shuffles + 16u * block)) };
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16u * block), _mm_shuffle_epi8(bytes, shuffle));
+		}
+	}
+
+	TARGET("ssse3") void fadeSSE(std::uint8_t* phosphor, const std::uint8_t* line, std::size_t width, std::uint8_t decay) {
+		const __m128i decays{ _mm_set1_epi8(static_cast<char>(decay)) };
+		for (std::size_t x{ 0u }; x < width; x += 16u) {
+			const __m128i faded{ _mm_subs_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(phosphor + x)), decays) };
+			const __m128i lit{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(line + x)) };
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(phosphor + x), _mm_max_epu8(faded, lit));
+		}
+	}
+
+	// each luminance byte to R G B, the alpha byte is shuffled in as 0 then set
+	TARGET("ssse3") void toRGBASSE(const std::uint8_t* line, std::size_t width, std::uint32_t* out) {
+		const __m128i alphas{ _mm_set1_epi32(static_cast<int>(alpha)) };
+		const __m128i shuffles[4]{ // std::array would drop the vector type's alignment attribute
+			_mm_setr_epi8(0, 0, 0, -1, 1, 1, 1, -1, 2, 2, 2, -1, 3, 3, 3, -1),
+			_mm_setr_epi8(4, 4, 4, -1, 5, 5, 5, -1, 6, 6, 6, -1, 7, 7, 7, -1),
+			_mm_setr_epi8(8, 8, 8, -1, 9, 9, 9, -1, 10, 10, 10, -1, 11, 11, 11, -1),
+			_mm_setr_epi8(12, 12, 12, -1, 13, 13, 13, -1, 14, 14, 14, -1, 15, 15, 15, -1)
+		};
+		for (std::size_t x{ 0u }; x < width; x += 16u) {
+			const __m128i luminance{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(line + x)) };
+			for (std::size_t quarter{ 0u }; quarter < 4u; quarter++) {
+				const __m128i pixels{ _mm_or_si128(_mm_shuffle_epi8(luminance, shuffles[quarter]), alphas) };
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + x + 4u * quarter), pixels);
+			}
+		}
+	}
+
+	// AVX2 shuffles stay within 128 bits lanes : each lane gets its own block
+	TARGET("avx2") void expandAVX2(const std::uint8_t* source, const std::uint16_t* bases, const std::uint8_t* shuffles, std::size_t width, std::uint8_t* out) {
+		for (std::size_t block{ 0u }; block < width / 16u; block += 2u) {
+			const __m256i bytes{ _mm256_inserti128_si256(
+				_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + bases[block]))),
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + bases[block + 1u])), 1) };
+			const __m256i shuffle{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(shuffles + 16u * block)) };
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 16u * block), _mm256_shuffle_epi8(bytes, shuffle));
+		}
+	}
+
+	TARGET("avx2") void fadeAVX2(std::uint8_t* phosphor, const std::uint8_t* line, std::size_t width, std::uint8_t decay) {
+		const __m256i decays{ _mm256_set1_epi8(static_cast<char>(decay)) };
+		for (std::size_t x{ 0u }; x < width; x += 32u) {
+			const __m256i faded{ _mm256_subs_epu8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(phosphor + x)), decays) };
+			const __m256i lit{ _mm256_loadu_si256(reinterpret_cast<const __m256i*>(line + x)) };
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(phosphor + x), _mm256_max_epu8(faded, lit));
+		}
+	}
+
+	TARGET("avx2") void toRGBAAVX2(const std::uint8_t* line, std::size_t width, std::uint32_t* out) {
+		const __m256i alphas{ _mm256_set1_epi32(static_cast<int>(alpha)) };
+		// 16 luminance bytes in both lanes, the low lane makes the first 4 pixels, the high one the next 4
+		const __m256i low{ _mm256_setr_epi8(
+			0, 0, 0, -1, 1, 1, 1, -1, 2, 2, 2, -1, 3, 3, 3, -1,
+			4, 4, 4, -1, 5, 5, 5, -1, 6, 6, 6, -1, 7, 7, 7, -1) };
+		const __m256i high{ _mm256_setr_epi8(
+			8, 8, 8, -1, 9, 9, 9, -1, 10, 10, 10, -1, 11, 11, 11, -1,
+			12, 12, 12, -1, 13, 13, 13, -1, 14, 14, 14, -1, 15, 15, 15, -1) };
+		for (std::size_t x{ 0u }; x < width; x += 16u) {
+			const __m256i luminance{ _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(line + x))) };
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + x), _mm256_or_si256(_mm256_shuffle_epi8(luminance, low), alphas));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + x + 8u), _mm256_or_si256(_mm256_shuffle_epi8(luminance, high), alphas));
+		}
+	}
+#endif
+}
+
+Upscaler::Upscaler() : isa_{ detectIsa() }, kernels_{ kernels(isa_) } {
+	configure(options_);
+}
+
+Upscaler::Isa Upscaler::detectIsa() noexcept {
+#if defined(UPSCALE_X86) && (defined(__GNUC__) || defined(__clang__))
+	if (__builtin_cpu_supports("avx2")) {
+		return Isa::avx2;
+	}
+	if (__builtin_cpu_supports("ssse3")) {
+		return Isa::sse;
+	}
+#elif defined(UPSCALE_X86) && defined(_MSC_VER)
+	std::array<int, 4> registers{};
+	__cpuid(registers.data(), 0);
+	const int maxLeaf{ registers[0] };
+	__cpuid(registers.data(), 1);
+	const bool ssse3{ (registers[2] & (1 << 9)) != 0 };
+	// AVX2 also needs the OS to save the YMM registers
+	const bool ymmSaved{ (registers[2] & (1 << 27)) != 0 && (_xgetbv(0) & 6u) == 6u };
+	if (maxLeaf >= 7 && ymmSaved) {
+		__cpuidex(registers.data(), 7, 0);
+		if (registers[1] & (1 << 5)) {
+			return Isa::avx2;
+		}
+	}
+	if (ssse3) {
+		return Isa::sse;
+	}
+#endif
+	return Isa::scalar;
+}
+
+const char* Upscaler::isaName(Isa isa) noexcept {
+	switch (isa) {
+	case Isa::scalar:	return "scalar";
+	case Isa::sse:		return "SSSE3";
+	case Isa::avx2:		return "AVX2";
+	}
+	return "unknown";
+}
+
+Upscaler::Kernels Upscaler::kernels(Isa isa) noexcept {
+#ifdef UPSCALE_X86
+	if (isa == Isa::avx2) {
+		return { expandAVX2, fadeAVX2, toRGBAAVX2 };
+	}
+	if (isa == Isa::sse) {
+		return { expandSSE, fadeSSE, toRGBASSE };
+	}
+#endif
+	static_cast<void>(isa);
+	return { expandScalar, fadeScalar, toRGBAScalar };
+}
+
+bool Upscaler::setIsa(Isa isa) noexcept {
+	if (static_cast<int>(isa) > static_cast<int>(detectIsa())) {
+		return false;
+	}
+	isa_ = isa;
+	kernels_ = kernels(isa);
+	return true;
+}
+
+bool Upscaler::configure(const Options& options) {
+	const std::size_t minScale{ options.filter == Filter::epx ? 2u : 1u };
+	if (options.scale < minScale || options.scale > maxScale) {
+		std::cerr << "Error upscaling scale " << options.scale << " is out of range (" << minScale << " to " << maxScale << ") !" << std::endl;
+		return false;
+	}
+	options_ = options;
+	const std::size_t factor{ options.filter == Filter::epx ? 2u : 1u };
+	sourceWidth_ = Screen::widthInPixels * factor;
+	sourceHeight_ = Screen::heightInPixels * factor;
+
+	// output pixels are mapped to the nearest source pixel on their left, a block spans at most 16 source bytes since scale >= factor
+	const std::size_t outWidth{ width() };
+	bases_.assign(outWidth / block, 0u);
+	shuffles_.assign(outWidth, 0u);
+	for (std::size_t x{ 0u }; x < outWidth; x++) {
+		const std::size_t sourceX{ x * sourceWidth_ / outWidth };
+		if (x % block == 0u) {
+			bases_[x / block] = static_cast<std::uint16_t>(sourceX);
+		}
+		shuffles_[x] = static_cast<std::uint8_t>(sourceX - bases_[x / block]);
+	}
+
+	// the last quarter of an emulated row is a scanline, at least one output row once there are two
+	const std::size_t outHeight{ height() };
+	const std::size_t dimmed{ options.scanlines && options.scale >= 2u ? std::max<std::size_t>(options.scale / 4u, 1u) : 0u };
+	sourceRows_.assign(outHeight, 0u);
+	scanlines_.assign(outHeight, 0u);
+	for (std::size_t y{ 0u }; y < outHeight; y++) {
+		sourceRows_[y] = static_cast<std::uint16_t>(y * sourceHeight_ / outHeight);
+		scanlines_[y] = y % options.scale >= options.scale - dimmed;
+	}
+
+	line_.assign(outWidth, 0u);
+	phosphor_.assign(2u * sourceHeight_ * source_.size(), 0u);
+	pixels_.assign(outWidth * outHeight, alpha);
+	return true;
+}
+
+void Upscaler::unpack(const Row& row, std::uint8_t on) noexcept {
+	const std::uint64_t mask{ on * 0x0101'0101'0101'0101u };
+	for (std::size_t byte{ 0u }; byte < sourceWidth_ / 8u; byte++) {
+		const auto bits{ (row[byte / 8u] >> (56u - 8u * (byte % 8u))) & 0xFFu };
+		const std::uint64_t pixels{ pixelBytes[bits] & mask };
+		std::memcpy(source_.data() + 8u * byte, &pixels, sizeof(pixels));
+	}
+}
+
+// Scale2x : each pixel P becomes 4, a corner taking the color of its two neighbours when they agree and the others don't
+//	  A			1 2
+//	C P B	=>	3 4		1 = A if C == A, C != D, A != B; 2 = B if A == B, A != C, B != D
+//	  D					3 = C if D == C, D != B, C != A; 4 = D if B == D, B != A, D != C
+// pixels out of the screen are the edge ones; 64 pixels are processed at once, one per bit
+Upscaler::Bitmap Upscaler::epx(const Screen::Frame& frame) noexcept {
+	Bitmap bitmap{};
+	constexpr std::uint64_t leftmost{ std::uint64_t{ 1u } << 63u };
+	for (std::size_t y{ 0u }; y < Screen::heightInPixels; y++) {
+		const std::uint64_t P{ frame[y] };
+		const std::uint64_t A{ frame[y ? y - 1u : y] };
+		const std::uint64_t D{ frame[y + 1u < Screen::heightInPixels ? y + 1u : y] };
+		const std::uint64_t B{ P << 1u | (P & 1u) };
+		const std::uint64_t C{ P >> 1u | (P & leftmost) };
+		const auto pick{ [P](std::uint64_t when, std::uint64_t color) { return (when & color) | (~when & P); } };
+		const std::uint64_t E1{ pick(~(C ^ A) & (C ^ D) & (A ^ B), A) };
+		const std::uint64_t E2{ pick(~(A ^ B) & (A ^ C) & (B ^ D), B) };
+		const std::uint64_t E3{ pick(~(D ^ C) & (D ^ B) & (C ^ A), C) };
+		const std::uint64_t E4{ pick(~(B ^ D) & (B ^ A) & (D ^ C), D) };
+		// left subpixels on odd bits, right ones on even bits
+		bitmap[2u * y] = { spread(E1 >> 32u) << 1u | spread(E2 >> 32u), spread(E1) << 1u | spread(E2) };
+		bitmap[2u * y + 1u] = { spread(E3 >> 32u) << 1u | spread(E4 >> 32u), spread(E3) << 1u | spread(E4) };
+	}
+	return bitmap;
+}
+
+const std::vector<std::uint32_t>& Upscaler::upscale(const Screen::Frame& frame) {
+	if (options_.filter == Filter::epx) {
+		bitmap_ = epx(frame);
+	}
+	else {
+		for (std::size_t y{ 0u }; y < Screen::heightInPixels; y++) {
+			bitmap_[y] = { frame[y], 0u };
+		}
+	}
+	const std::size_t outWidth{ width() };
+	std::size_t previousRow{ std::numeric_limits<std::size_t>::max() };
+	std::uint8_t previousOn{};
+	for (std::size_t y{ 0u }; y < height(); y++) {
+		const std::size_t row{ sourceRows_[y] };
+		const std::uint8_t on{ scanlines_[y] ? scanline : white };
+		std::uint32_t* const out{ pixels_.data() + y * outWidth };
+		if (row == previousRow && on == previousOn) {
+			std::copy_n(out - outWidth, outWidth, out);
+			continue;
+		}
+		unpack(bitmap_[row], on);
+		const std::uint8_t* luminance{ source_.data() };
+		if (options_.phosphorDecay) {
+			// the phosphor fades before the expansion, once per source row instead of once per output pixel
+			std::uint8_t* const phosphor{ phosphor_.data() + (2u * row + (on != white)) * source_.size() };
+			kernels_.fade(phosphor, source_.data(), sourceWidth_, options_.phosphorDecay);
+			luminance = phosphor;
+		}
+		kernels_.expand(luminance, bases_.data(), shuffles_.data(), outWidth, line_.data());
+		kernels_.toRGBA(line_.data(), outWidth, out);
+		previousRow = row;
+		previousOn = on;
+	}
+	return pixels_;
+}
\ No newline at end of file
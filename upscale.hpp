@@ -0,0 +1,124 @@
+#pragma once
+
+#include "pixel.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// Turns a Screen::Frame into an RGBA image on the CPU, at scales too large to draw each Pixel as a rectangle.
+// A frame goes through :
+//	EPX, optional		: the 1-bit frame is smoothed to twice its resolution (Scale2x), a whole row of bits at a time
+//	scanlines, optional	: the last output rows of each emulated row are dimmed
+//	phosphor, optional	: pixels turned off fade out over the next frames instead of disappearing at once; it is kept
+//						  per source pixel, as fading commutes with the expansion, so that each source row fades once
+//	expansion			: each output row is a row of the (smoothed) frame stretched to the output width, as luminance
+//	conversion			: luminance to opaque gray RGBA, byte order R G B A as sf::Texture::update() expects
+// Output rows of the same source row and brightness are copied from the previous one.
+// Expansion, phosphor and conversion have SSSE3 and AVX2 kernels picked from the CPU at runtime, and a scalar fallback;
+// they all give the same image. upscale_check.cpp benchmarks them and checks them against golden images.
+class Upscaler {
+public:
+	enum class Filter {
+		nearest,
+		epx
+	};
+
+	enum class Isa {
+		scalar,
+		sse,	// SSSE3
+		avx2
+	};
+
+	struct Options {
+		std::size_t		scale{ Pixel::size };	// output pixels per emulated pixel, 2 at least with Filter::epx
+		Filter			filter{ Filter::nearest };
+		bool			scanlines{ false };
+		std::uint8_t	phosphorDecay{ 0u };	// luminance a pixel turned off loses per frame, 0 turns persistence off
+	};
+
+	static constexpr std::size_t maxScale{ 64u };
+
+	static constexpr std::uint8_t white{ 0xFF };
+	static constexpr std::uint8_t scanline{ 0x80 };	// luminance of a white pixel on a scanline
+
+private:
+	// rows of the frame to stretch, 128 pixels wide at most (EPX), most significant bit = leftmost pixel
+	using Row = std::array<std::uint64_t, 2u>;
+	using Bitmap = std::array<Row, 2u * Screen::heightInPixels>;
+
+	// a 16 bytes block of an expanded row reads up to 16 bytes from its base; the source row is padded as much
+	static constexpr std::size_t block{ 16u };
+
+	struct Kernels {
+		void (*expand)(const std::uint8_t* source, const std::uint16_t* bases, const std::uint8_t* shuffles, std::size_t width, std::uint8_t* out);
+		void (*fade)(std::uint8_t* phosphor, const std::uint8_t* line, std::size_t width, std::uint8_t decay);
+		void (*toRGBA)(const std::uint8_t* line, std::size_t width, std::uint32_t* out);
+	};
+
+	Options							options_{};
+	Isa								isa_{ Isa::scalar };
+	Kernels							kernels_{};
+
+	std::size_t						sourceWidth_{};
+	std::size_t						sourceHeight_{};
+	Bitmap							bitmap_{};
+
+	std::vector<std::uint16_t>		bases_{};		// first source byte of each output block
+	std::vector<std::uint8_t>		shuffles_{};	// source byte of each output byte, from its block's base
+	std::vector<std::uint16_t>		sourceRows_{};	// source row of each output row
+	std::vector<std::uint8_t>		scanlines_{};	// 1 if the output row is dimmed
+
+	std::array<std::uint8_t, 2u * Screen::widthInPixels + block>	source_{};	// unpacked source row, one byte per pixel
+	std::vector<std::uint8_t>		line_{};		// expanded source row
+	std::vector<std::uint8_t>		phosphor_{};	// luminance of every source pixel with persistence, a padded row per source row and brightness
+	std::vector<std::uint32_t>		pixels_{};
+
+	static Kernels kernels(Isa isa) noexcept;
+
+	void unpack(const Row& row, std::uint8_t on) noexcept;
+
+	static Bitmap epx(const Screen::Frame& frame) noexcept;
+
+public:
+	Upscaler();
+
+	// false (and unchanged) if <options> are out of range; the phosphor starts black again
+	bool configure(const Options& options);
+
+	inline const Options& options() const noexcept {
+		return options_;
+	}
+
+	inline std::size_t width() const noexcept {
+		return Screen::widthInPixels * options_.scale;
+	}
+
+	inline std::size_t height() const noexcept {
+		return Screen::heightInPixels * options_.scale;
+	}
+
+	// the best kernels this CPU runs
+	static Isa detectIsa() noexcept;
+
+	static const char* isaName(Isa isa) noexcept;
+
+	inline Isa isa() const noexcept {
+		return isa_;
+	}
+
+	// picks other kernels, e.g. to compare them; false if this CPU can't run them
+	bool setIsa(Isa isa) noexcept;
+
+	// width() * height() pixels, row by row, valid until the next call
+	const std::vector<std::uint32_t>& upscale(const Screen::Frame& frame);
+};
\ No newline at end of file
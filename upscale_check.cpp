@@ -0,0 +1,317 @@
+// Upscaler check : golden images, kernels against each other, and a benchmark of every scale and filter.
+//	golden images	: pixels derived by hand (nearest, EPX corners, scanlines, phosphor fading), then FNV-1a hashes of whole images
+//	kernels			: every kernel this CPU runs must give the scalar image, for every scale and filter, on random frames
+//	benchmark		: microseconds per frame for each kernel, scale and filter, the median of several repeats so that load spikes don't count;
+//					  the best kernels fail above 1000 microseconds per frame, or above --max-us <microseconds>
+// Exits with 1 if anything fails.
+//
+// Not part of Chip8.vcxproj's build, as it has its own main :
+//	g++ -std=c++20 -O2 -DNDEBUG upscale_check.cpp upscale.cpp -lsfml-graphics -lsfml-window -lsfml-system -o chip8-upscale-check
+//	./chip8-upscale-check [--max-us <microseconds>]
+// After a deliberate change of the output, ./chip8-upscale-check --print-golden prints the new hashes for goldenImages.
+
+#include "hash.hpp"
+#include "upscale.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace {
+	using Filter = Upscaler::Filter;
+	using Isa = Upscaler::Isa;
+	using Options = Upscaler::Options;
+
+	constexpr double defaultMaxMicros{ 1000. }; // per frame, for the best kernels
+	constexpr std::size_t repeats{ 15u };
+
+	std::size_t failures{ 0u };
+
+	void check(bool condition, const std::string& what) {
+		if (!condition) {
+			std::cerr << "FAILED " << what << std::endl;
+			failures++;
+		}
+	}
+
+	Screen::Frame& set(Screen::Frame& frame, std::size_t x, std::size_t y) {
+		frame[y] |= std::uint64_t{ 1u } << (Screen::widthInPixels - 1u - x);
+		return frame;
+	}
+
+	bool isSet(const Screen::Frame& frame, std::size_t x, std::size_t y) {
+		return (frame[y] >> (Screen::widthInPixels - 1u - x)) & 1u;
+	}
+
+	// border, diagonals, a filled block, a checkerboard and lone pixels
+	Screen::Frame testFrame() {
+		Screen::Frame frame{};
+		frame.front() = frame.back() = ~std::uint64_t{ 0u };
+		for (std::size_t y{ 0u }; y < Screen::heightInPixels; y++) {
+			set(frame, 0u, y);
+			set(frame, Screen::widthInPixels - 1u, y);
+			set(frame, 4u + y, y);
+			set(frame, 40u - y / 2u, y);
+		}
+		for (std::size_t y{ 20u }; y < 26u; y++) {
+			frame[y] |= std::uint64_t{ 0xFF } << 8u;
+			frame[y] |= (y % 2u ? 0xAAu : 0x55u) << 20u;
+		}
+		set(set(frame, 50u, 5u), 52u, 9u);
+		return frame;
+	}
+
+	Screen::Frame randomFrame(std::mt19937_64& random) {
+		Screen::Frame frame{};
+		for (auto& row : frame) {
+			row = random() & random(); // sparse, like most screens
+		}
+		return frame;
+	}
+
+	std::uint8_t luminance(const Upscaler& upscaler, const std::vector<std::uint32_t>& image, std::size_t x, std::size_t y) {
+		return static_cast<std::uint8_t>(image[y * upscaler.width() + x] & 0xFFu);
+	}
+
+	std::uint64_t imageHash(const std::vector<std::uint32_t>& image) {
+		return fnv1a(reinterpret_cast<const unsigned char*>(image.data()), image.size() * sizeof(std::uint32_t));
+	}
+
+	std::string describe(const Options& options) {
+		return "x" + std::to_string(options.scale) + (options.filter == Filter::epx ? " epx" : "") +
+			(options.scanlines ? " scanlines" : "") + (options.phosphorDecay ? " phosphor " + std::to_string(options.phosphorDecay) : "");
+	}
+
+	void checkHandDerived() {
+		const auto frame{ testFrame() };
+		Upscaler upscaler{};
+
+		// nearest : each emulated pixel is a scale * scale square, white or black, opaque
+		upscaler.configure({ 3u, Filter::nearest, false, 0u });
+		const auto nearest{ upscaler.upscale(frame) };
+		bool squares{ true };
+		for (std::size_t y{ 0u }; y < upscaler.height(); y++) {
+			for (std::size_t x{ 0u }; x < upscaler.width(); x++) {
+				const std::uint32_t expected{ isSet(frame, x / 3u, y / 3u) ? 0xFFFF'FFFFu : 0xFF00'0000u };
+				squares &= nearest[y * upscaler.width() + x] == expected;
+			}
+		}
+		check(squares, "nearest x3 pixels are the emulated ones");
+
+		// EPX at x2 : a lone diagonal step gets its inner corners filled, lone pixels stay square
+		Screen::Frame diagonal{};
+		set(set(diagonal, 10u, 10u), 11u, 11u);
+		set(diagonal, 30u, 20u);
+		upscaler.configure({ 2u, Filter::epx, false, 0u });
+		const auto smoothed{ upscaler.upscale(diagonal) };
+		const auto white{ [&](std::size_t x, std::size_t y) { return luminance(upscaler, smoothed, x, y) == Upscaler::white; } };
+		check(white(20u, 20u) && white(21u, 20u) && white(20u, 21u) && white(21u, 21u), "EPX keeps a set pixel whole");
+		check(white(22u, 21u), "EPX fills the bottom left corner of the pixel right of a diagonal step");
+		check(white(21u, 22u), "EPX fills the top right corner of the pixel below a diagonal step");
+		check(!white(23u, 20u) && !white(20u, 23u), "EPX leaves the outer corners of a diagonal step black");
+		check(white(60u, 40u) && white(61u, 41u) && !white(62u, 40u) && !white(59u, 41u), "EPX keeps a lone pixel square");
+
+		// scanlines : at x8, the last 2 output rows of each emulated row are dimmed
+		upscaler.configure({ 8u, Filter::nearest, true, 0u });
+		const auto scanlined{ upscaler.upscale(frame) };
+		check(luminance(upscaler, scanlined, 0u, 5u) == Upscaler::white && luminance(upscaler, scanlined, 0u, 6u) == Upscaler::scanline
+			&& luminance(upscaler, scanlined, 0u, 7u) == Upscaler::scanline && luminance(upscaler, scanlined, 0u, 8u) == Upscaler::white,
+			"scanlines dim the last quarter of each emulated row");
+
+		// phosphor : a pixel turned off loses decay per frame, one turned on is lit at once
+		upscaler.configure({ 1u, Filter::nearest, false, 0x50u });
+		Screen::Frame lit{};
+		set(lit, 7u, 7u);
+		upscaler.upscale(lit);
+		const auto once{ upscaler.upscale(Screen::Frame{}) };
+		check(luminance(upscaler, once, 7u, 7u) == 0xFF - 0x50, "phosphor fades a pixel turned off");
+		upscaler.upscale(Screen::Frame{});
+		upscaler.upscale(Screen::Frame{});
+		const auto faded{ upscaler.upscale(Screen::Frame{}) };
+		check(luminance(upscaler, faded, 7u, 7u) == 0u, "phosphor ends black");
+		check(luminance(upscaler, upscaler.upscale(lit), 7u, 7u) == Upscaler::white, "phosphor lights a pixel at once");
+	}
+
+	struct Golden {
+		Options			options;
+		std::uint64_t	hash;		// of the image of testFrame(), after 3 frames for the phosphor
+	};
+
+	const std::vector<Golden> goldenImages{
+		{ { 1u, Filter::nearest, false, 0u }, 0x0DEA0CF96053463Cu },
+		{ { 8u, Filter::nearest, false, 0u }, 0xB2F827B0AF1D5E25u },
+		{ { 16u, Filter::nearest, true, 0u }, 0x8205DB9231E0B425u },
+		{ { 5u, Filter::epx, false, 0u }, 0x88AC8D53FD1E9E75u },
+		{ { 32u, Filter::epx, true, 0u }, 0x6398618BFBCFF125u },
+		{ { 12u, Filter::nearest, false, 0x30u }, 0xA248C64037E43025u },
+		{ { 24u, Filter::epx, true, 0x40u }, 0x51A1139383BB7925u }
+	};
+
+	// the phosphor's frames : testFrame() comes last, after two others
+	std::uint64_t goldenHash(Upscaler& upscaler, const Options& options) {
+		upscaler.configure(options);
+		if (options.phosphorDecay) {
+			Screen::Frame inverted{ testFrame() };
+			for (auto& row : inverted) {
+				row = ~row;
+			}
+			upscaler.upscale(inverted);
+			upscaler.upscale(Screen::Frame{});
+		}
+		return imageHash(upscaler.upscale(testFrame()));
+	}
+
+	void checkGolden(bool print) {
+		Upscaler upscaler{};
+		upscaler.setIsa(Isa::scalar);
+		for (const auto& golden : goldenImages) {
+			const auto hash{ goldenHash(upscaler, golden.options) };
+			if (print) {
+				std::cout << describe(golden.options) << " : 0x" << std::hex << std::uppercase << hash << std::dec << std::nouppercase << std::endl;
+				continue;
+			}
+			check(hash == golden.hash, "golden image " + describe(golden.options));
+		}
+	}
+
+	std::vector<Options> everyOptions() {
+		std::vector<Options> options{};
+		for (std::size_t scale{ 1u }; scale <= Upscaler::maxScale; scale++) {
+			for (const auto filter : { Filter::nearest, Filter::epx }) {
+				if (filter == Filter::epx && scale < 2u) {
+					continue;
+				}
+				options.push_back({ scale, filter, scale % 3u == 0u, static_cast<std::uint8_t>(scale % 5u == 0u ? 0x40u : 0u) });
+			}
+		}
+		return options;
+	}
+
+	void checkKernels() {
+		std::mt19937_64 random{ 0xC8u };
+		std::vector<Screen::Frame> frames{ testFrame() };
+		for (std::size_t i{ 0u }; i < 4u; i++) {
+			frames.push_back(randomFrame(random));
+		}
+		for (const auto isa : { Isa::sse, Isa::avx2 }) {
+			Upscaler candidate{};
+			if (!candidate.setIsa(isa)) {
+				std::cout << Upscaler::isaName(isa) << " kernels skipped, unsupported by this CPU" << std::endl;
+				continue;
+			}
+			Upscaler reference{};
+			reference.setIsa(Isa::scalar);
+			std::size_t compared{ 0u };
+			for (const auto& options : everyOptions()) {
+				reference.configure(options);
+				candidate.configure(options);
+				bool same{ true };
+				for (const auto& frame : frames) {
+					same &= reference.upscale(frame) == candidate.upscale(frame);
+				}
+				check(same, std::string{ Upscaler::isaName(isa) } + " kernels against scalar ones, " + describe(options));
+				compared++;
+			}
+			std::cout << Upscaler::isaName(isa) << " kernels compared on " << compared << " configurations" << std::endl;
+		}
+	}
+
+	void benchmark(double maxMicros) {
+		using clock = std::chrono::steady_clock;
+		std::mt19937_64 random{ 0x5CA1Eu };
+		std::vector<Screen::Frame> frames{};
+		for (std::size_t i{ 0u }; i < 16u; i++) {
+			frames.push_back(randomFrame(random));
+		}
+		const std::vector<Options> benchmarked{
+			{ 8u, Filter::nearest, false, 0u },
+			{ 16u, Filter::nearest, false, 0u },
+			{ 32u, Filter::nearest, false, 0u },
+			{ 16u, Filter::epx, true, 0u },
+			{ 32u, Filter::epx, true, 0u },
+			{ 32u, Filter::nearest, true, 0x20u },
+			{ 32u, Filter::epx, true, 0x20u }
+		};
+		std::cout << std::left << std::setw(32) << "microseconds per frame";
+		for (const auto isa : { Isa::scalar, Isa::sse, Isa::avx2 }) {
+			std::cout << std::setw(10) << Upscaler::isaName(isa);
+		}
+		std::cout << std::endl;
+		for (const auto& options : benchmarked) {
+			std::cout << std::setw(32) << describe(options);
+			for (const auto isa : { Isa::scalar, Isa::sse, Isa::avx2 }) {
+				Upscaler upscaler{};
+				if (!upscaler.setIsa(isa)) {
+					std::cout << std::setw(10) << "-";
+					continue;
+				}
+				upscaler.configure(options);
+				upscaler.upscale(frames.front()); // warms the buffers up
+				std::vector<double> samples{};
+				for (std::size_t repeat{ 0u }; repeat < repeats; repeat++) {
+					std::size_t count{ 0u };
+					const auto start{ clock::now() };
+					auto elapsed{ clock::duration::zero() };
+					while (elapsed < std::chrono::milliseconds{ 15 }) {
+						upscaler.upscale(frames[count++ % frames.size()]);
+						elapsed = clock::now() - start;
+					}
+					samples.push_back(std::chrono::duration<double, std::micro>(elapsed).count() / static_cast<double>(count));
+				}
+				std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(repeats / 2u), samples.end());
+				const double micros{ samples[repeats / 2u] };
+				std::cout << std::setw(10) << std::fixed << std::setprecision(1) << micros;
+				// the scalar fallback is only there for correctness
+				if (isa == Upscaler::detectIsa()) {
+					check(micros <= maxMicros, "best kernels under " + std::to_string(maxMicros) + " microseconds per frame, " + describe(options));
+				}
+			}
+			std::cout << std::endl;
+		}
+	}
+}
+
+int main(int argc, char* argv[]) {
+	if (argc > 1 && std::string{ argv[1] } == "--print-golden") {
+		checkGolden(true);
+		return 0;
+	}
+	double maxMicros{ defaultMaxMicros };
+	bool usage{ argc != 1 };
+	if (argc == 3 && std::string{ argv[1] } == "--max-us") {
+		try {
+			maxMicros = std::stod(argv[2]);
+			usage = maxMicros < 0.;
+		}
+		catch (const std::logic_error&) {} // std::stod
+	}
+	if (usage) {
+		std::cerr << "Usage : " << argv[0] << " [--print-golden | --max-us <microseconds>]" << std::endl;
+		return 1;
+	}
+	std::cout << "Best kernels : " << Upscaler::isaName(Upscaler::detectIsa()) << std::endl;
+	checkHandDerived();
+	checkGolden(false);
+	checkKernels();
+	benchmark(maxMicros);
+	if (failures) {
+		std::cerr << failures << " checks failed" << std::endl;
+		return 1;
+	}
+	std::cout << "All checks passed" << std::endl;
+	return 0;
+}
\ No newline at end of file